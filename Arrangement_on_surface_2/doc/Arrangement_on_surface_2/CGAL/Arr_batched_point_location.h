@@ -35,4 +35,49 @@ OutputIterator locate (const Arrangement_2<Traits, Dcel>& arr,
                        InputIterator end,
                        OutputIterator oi);
 
+/*! \ingroup PkgArrangementOnSurface2PointLocation
+ *
+ * issues point-location queries with a given point-location object for a
+ * collection of query points, and inserts the query results into an output
+ * container given through an output iterator. Each query result is given as a
+ * pair of the query point and an object representing the arrangement feature
+ * that contains it. Unlike the batched point location above, the resulting
+ * pairs are in the order of the query points. The function must be called
+ * with an explicit `ConcurrencyTag` template argument, e.g.,
+ * `locate<CGAL::Parallel_tag>(pl, begin, end, oi)`.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel queries.
+ * Possible values are `Sequential_tag` and `Parallel_tag`. With
+ * `Parallel_tag`, the queries are issued concurrently.
+ * \tparam PointLocation a model of the concept `ArrangementPointLocation_2`.
+ *
+ * \param pl The point-location object, attached to the arrangement.
+ * \param begin The begin iterator of the container of input points.
+ * \param end The past-the-end iterator of the container of input points.
+ * \param oi The output iterator that points at the output container.
+ * \return The past-the-end iterator of the output container.
+ *
+ * \cgalHeading{Requirements}
+ *
+ * \pre The value type of `InputIterator` must be convertible to
+ * `Arrangement_2::Point_2`.
+ * \pre Dereferencing `oi` must yield an  object convertible to
+ * `std::pair<Arrangement_2::Point_2, Arr_point_location_result<Arrangement_2>::%Type>`.
+ * \pre With `Parallel_tag`, the queries of `pl` do not modify it, the
+ * arrangement is not modified during the queries, and the functors of its
+ * geometry traits can be used concurrently. The queries of
+ * `Arr_naive_point_location`, `Arr_walk_along_line_point_location`, and
+ * `Arr_landmarks_point_location` do not modify them. The queries of
+ * `Arr_trapezoid_ric_point_location` do not modify it in its read-only mode.
+ *
+ * \sa `CGAL::Arr_point_location_result<Arrangement>`
+ * \sa `CGAL::Arr_trapezoid_ric_point_location<Arrangement>::set_read_only()`
+ */
+template <typename ConcurrencyTag, typename PointLocation,
+          typename InputIterator, typename OutputIterator>
+OutputIterator locate(const PointLocation& pl,
+                      InputIterator begin,
+                      InputIterator end,
+                      OutputIterator oi);
+
 } /* namespace CGAL */
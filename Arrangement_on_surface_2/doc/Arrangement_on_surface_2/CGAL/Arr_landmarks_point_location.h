@@ -47,6 +47,9 @@ when the application frequently issues point-location queries on a
 rather static arrangement that the changes applied to it are mainly
 insertions of curves and not deletions of them.
 
+The queries do not modify the point-location object, so they may be issued
+concurrently, as long as the arrangement is not modified.
+
 \cgalModels{ArrangementPointLocation_2,ArrangementVerticalRayShoot_2}
 
 \sa `ArrangementPointLocation_2`
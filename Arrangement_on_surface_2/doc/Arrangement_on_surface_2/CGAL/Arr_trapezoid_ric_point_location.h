@@ -60,6 +60,21 @@ If with_guarantees is set to true, the structure will guarantee linear size and
 */
 void with_guarantees (bool with_guarantees);
 
+/*!
+If read_only is set to true, the queries do not modify the search structure. By default, the queries record the last located cells, which speeds up the following insertions of curves. In a read-only mode, queries may be issued concurrently, as long as the arrangement is not modified.
+*/
+void set_read_only (bool read_only);
+
+/// @}
+
+/// \name Access Functions
+/// @{
+
+/*!
+returns whether the queries are read-only.
+*/
+bool is_read_only () const;
+
 /// @}
 
 }; /* end Arr_trapezoid_ric_point_location */
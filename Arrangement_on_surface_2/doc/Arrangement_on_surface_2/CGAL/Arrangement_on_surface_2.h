@@ -1081,6 +1081,31 @@ void insert(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
             InputIterator first,
             InputIterator last);
 
+/*! Same as above, where the concurrency tag is given as the first template
+ * argument, as in `insert<CGAL::Parallel_tag>(arr, first, last)`.
+ *
+ * With `Parallel_tag`, the input curves are subdivided into \f$ x\f$-monotone
+ * curves, which are split into groups of curves that lie in vertical strips.
+ * The arrangements of the groups are constructed in parallel and then
+ * overlaid pairwise in parallel. The resulting arrangement is the same as
+ * the one constructed sequentially, and handles to the features of `arr`
+ * that existed before the insertion remain valid.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ * Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ *
+ * \pre The function objects of `GeometryTraits` can be used concurrently.
+ * \pre `arr` is not an arrangement with history.
+ *
+ * The function is defined in the header `CGAL/Arr_parallel_insertion.h`.
+ */
+template <typename ConcurrencyTag,
+          typename GeometryTraits, typename TopologyTraits,
+          typename InputIterator>
+void insert(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
+            InputIterator first,
+            InputIterator last);
+
 /// @}
 
 /*! \ingroup PkgArrangementOnSurface2Funcs
@@ -24,7 +24,17 @@
 #include <CGAL/Surface_sweep_2/No_overlap_event.h>
 #include <CGAL/Surface_sweep_2/No_overlap_subcurve.h>
 #include <CGAL/Surface_sweep_2/Arr_batched_pl_ss_visitor.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <boost/type_traits.hpp>
 
@@ -133,6 +143,77 @@ locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
   return oi;
 }
 
+namespace Arr_batched_point_location_internal {
+
+// Point-location strategies that cache the results of their queries, such as
+// the trapezoidal-map strategy, answer concurrent queries only in their
+// read-only mode. The other strategies are read-only by definition.
+template <typename PointLocation>
+auto is_read_only(const PointLocation& pl, int) -> decltype(pl.is_read_only())
+{ return pl.is_read_only(); }
+
+template <typename PointLocation>
+bool is_read_only(const PointLocation&, long) { return true; }
+
+} // namespace Arr_batched_point_location_internal
+
+/*! Issue point-location queries with a point-location object given an input
+ * range of points, with a concurrency tag. Unlike the batched point location
+ * above, the results are reported in the order of the query points. With
+ * `Parallel_tag`, the queries are issued concurrently.
+ * \param pl The point-location object, attached to the arrangement.
+ * \param points_begin An iterator for the range of query points.
+ * \param points_end A past-the-end iterator for the range of query points.
+ * \param oi Output: An output iterator for the query results.
+ * \pre The value-type of OutputIterator is pair<Point_2, Result>, where
+ *      Result is PointLocation::result_type.
+ * \pre With Parallel_tag, the queries of pl are read-only, the arrangement
+ *      is not modified during the queries, and the functors of its geometry
+ *      traits can be used concurrently.
+ */
+template <typename ConcurrencyTag, typename PointLocation,
+          typename PointsIterator, typename OutputIterator,
+          typename = std::enable_if_t<
+            std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+            std::is_same<ConcurrencyTag, Parallel_tag>::value> >
+OutputIterator
+locate(const PointLocation& pl,
+       PointsIterator points_begin, PointsIterator points_end,
+       OutputIterator oi)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    typedef typename std::iterator_traits<PointsIterator>::value_type
+                                                        Point_2;
+    typedef typename PointLocation::result_type        Result_type;
+
+    CGAL_precondition(Arr_batched_point_location_internal::is_read_only(pl, 0));
+
+    // Answer the queries into a vector indexed as the points, and report
+    // the results afterwards, as the output iterator is not thread safe.
+    const std::vector<Point_2> points(points_begin, points_end);
+    std::vector<Result_type> results(points.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, points.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for (std::size_t i = r.begin(); i != r.end(); ++i)
+        results[i] = pl.locate(points[i]);
+    });
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+      *oi++ = std::make_pair(points[i], results[i]);
+    return oi;
+  }
+#endif
+
+  for (PointsIterator it = points_begin; it != points_end; ++it)
+    *oi++ = std::make_pair(*it, pl.locate(*it));
+  return oi;
+}
+
 } // namespace CGAL
 
 #include <CGAL/enable_warnings.h>
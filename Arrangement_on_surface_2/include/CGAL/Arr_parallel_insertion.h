@@ -0,0 +1,292 @@
+// Copyright (c) 2025 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s): agent <agent@local>
+
+#ifndef CGAL_ARR_PARALLEL_INSERTION_H
+#define CGAL_ARR_PARALLEL_INSERTION_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+#include <CGAL/disable_warnings.h>
+
+/*! \file
+ * Aggregated insertion of a range of curves into an arrangement, with a
+ * concurrency tag. In parallel, the arrangements of groups of curves are
+ * constructed concurrently and then merged with a tree of overlays.
+ */
+
+#include <CGAL/Arrangement_on_surface_2.h>
+#include <CGAL/Arr_overlay_2.h>
+#include <CGAL/Surface_sweep_2/Surface_sweep_2_utils.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+
+namespace Arr_parallel_insertion_internal {
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// The minimal number of x-monotone curves of a group.
+const std::size_t min_group_size = 256;
+
+// Subdivides the curves into x-monotone curves and isolated points.
+template <typename GeometryTraits_2, typename Curve>
+void make_x_monotone(const std::vector<Curve>& curves,
+                     std::vector<typename GeometryTraits_2::X_monotone_curve_2>&
+                       xcurves,
+                     std::vector<typename GeometryTraits_2::Point_2>& iso_points,
+                     const GeometryTraits_2* geom_traits,
+                     std::false_type)
+{
+  typedef typename GeometryTraits_2::X_monotone_curve_2 X_monotone_curve_2;
+  typedef typename GeometryTraits_2::Point_2            Point_2;
+
+  const std::size_t n = curves.size();
+  const std::size_t nb_chunks =
+    (std::max)(std::size_t(1), (std::min)(n / min_group_size,
+      std::size_t(tbb::this_task_arena::max_concurrency())));
+  std::vector<std::vector<X_monotone_curve_2> > chunk_xcurves(nb_chunks);
+  std::vector<std::vector<Point_2> > chunk_points(nb_chunks);
+
+  tbb::parallel_for(std::size_t(0), nb_chunks, [&](std::size_t i)
+  {
+    Surface_sweep_2::make_x_monotone(curves.begin() + (i * n) / nb_chunks,
+                                     curves.begin() + ((i + 1) * n) / nb_chunks,
+                                     std::back_inserter(chunk_xcurves[i]),
+                                     std::back_inserter(chunk_points[i]),
+                                     geom_traits);
+  });
+
+  for (std::size_t i = 0; i < nb_chunks; ++i) {
+    xcurves.insert(xcurves.end(),
+                   chunk_xcurves[i].begin(), chunk_xcurves[i].end());
+    iso_points.insert(iso_points.end(),
+                      chunk_points[i].begin(), chunk_points[i].end());
+  }
+}
+
+// The curves are already x-monotone.
+template <typename GeometryTraits_2>
+void make_x_monotone(const std::vector<typename GeometryTraits_2::
+                                       X_monotone_curve_2>& curves,
+                     std::vector<typename GeometryTraits_2::X_monotone_curve_2>&
+                       xcurves,
+                     std::vector<typename GeometryTraits_2::Point_2>&,
+                     const GeometryTraits_2*,
+                     std::true_type)
+{ xcurves = curves; }
+
+// Orders the x-monotone curves by their left endpoints, such that the
+// groups of consecutive curves lie in vertical strips. Curves with an
+// unbounded end are left in their input order.
+template <typename TraitsAdaptor, typename XCurve>
+void sort_by_min_vertex(std::vector<XCurve>& xcurves,
+                        const TraitsAdaptor* traits, Arr_all_sides_oblivious_tag)
+{
+  auto min_vertex = traits->construct_min_vertex_2_object();
+  auto compare_xy = traits->compare_xy_2_object();
+  std::sort(xcurves.begin(), xcurves.end(),
+            [&](const XCurve& c1, const XCurve& c2)
+            { return compare_xy(min_vertex(c1), min_vertex(c2)) == SMALLER; });
+}
+
+template <typename TraitsAdaptor, typename XCurve>
+void sort_by_min_vertex(std::vector<XCurve>&, const TraitsAdaptor*,
+                        Arr_not_all_sides_oblivious_tag)
+{}
+
+// Constructs the arrangement of the given curves with a tree of overlays
+// of the arrangements of `nb_groups` >= 2 groups of curves. The result is
+// in `arr`, which must be empty.
+template <typename GeometryTraits_2, typename TopologyTraits,
+          typename XCurve, typename Point>
+void parallel_construct(Arrangement_on_surface_2<GeometryTraits_2,
+                                                 TopologyTraits>& arr,
+                        const std::vector<XCurve>& xcurves,
+                        const std::vector<Point>& iso_points,
+                        std::size_t nb_groups)
+{
+  typedef Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits> Arr;
+
+  const Arr& c_arr = arr;
+  const GeometryTraits_2* geom_traits = c_arr.geometry_traits();
+  const std::size_t n = xcurves.size();
+  const std::size_t m = iso_points.size();
+
+  // Construct the arrangement of each group with a surface sweep.
+  std::vector<std::unique_ptr<Arr> > arrs(nb_groups);
+  tbb::parallel_for(std::size_t(0), nb_groups, [&](std::size_t i)
+  {
+    arrs[i] = std::make_unique<Arr>(geom_traits);
+    insert_empty(*arrs[i],
+                 xcurves.begin() + (i * n) / nb_groups,
+                 xcurves.begin() + ((i + 1) * n) / nb_groups,
+                 iso_points.begin() + (i * m) / nb_groups,
+                 iso_points.begin() + ((i + 1) * m) / nb_groups);
+  });
+
+  // Overlay the arrangements of consecutive groups pairwise, until two
+  // arrangements are left, and overlay these two into arr.
+  while (arrs.size() > 2) {
+    std::vector<std::unique_ptr<Arr> > merged((arrs.size() + 1) / 2);
+    tbb::parallel_for(std::size_t(0), merged.size(), [&](std::size_t i)
+    {
+      if (2 * i + 1 == arrs.size()) {
+        merged[i] = std::move(arrs[2 * i]);
+        return;
+      }
+      merged[i] = std::make_unique<Arr>(geom_traits);
+      overlay(*arrs[2 * i], *arrs[2 * i + 1], *merged[i]);
+      arrs[2 * i].reset();
+      arrs[2 * i + 1].reset();
+    });
+    arrs.swap(merged);
+  }
+
+  overlay(*arrs[0], *arrs[1], arr);
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace Arr_parallel_insertion_internal
+
+/*! Insert a range of curves into the arrangement (aggregated insertion).
+ * The inserted curves may intersect one another and may also intersect the
+ * existing arrangement. This is the same as `insert(arr, begin, end)` when
+ * `ConcurrencyTag` is `Sequential_tag`.
+ *
+ * With `Parallel_tag`, the curves are subdivided into x-monotone curves in
+ * parallel, ordered by their left endpoints when they are bounded, and split
+ * into groups of consecutive curves, which lie in vertical strips. The
+ * arrangement of each group is constructed concurrently, and the arrangements
+ * of the groups are overlaid pairwise in parallel. The resulting arrangement
+ * is the same as the one constructed by the sequential insertion. When `arr`
+ * is not empty, the edges and isolated vertices of the arrangement of the
+ * new curves are inserted into `arr` with a single sweep, which keeps the
+ * handles to the existing features of `arr` valid.
+ *
+ * \pre The functors of the geometry traits of `arr` can be used concurrently.
+ */
+template <typename ConcurrencyTag,
+          typename GeometryTraits_2, typename TopologyTraits,
+          typename InputIterator,
+          typename = std::enable_if_t<
+            std::is_same<ConcurrencyTag, Sequential_tag>::value ||
+            std::is_same<ConcurrencyTag, Parallel_tag>::value> >
+void insert(Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
+            InputIterator begin, InputIterator end)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+  insert(arr, begin, end);
+#else
+  if (std::is_convertible<ConcurrencyTag, Sequential_tag>::value) {
+    insert(arr, begin, end);
+    return;
+  }
+
+  typedef GeometryTraits_2                              Gt2;
+  typedef TopologyTraits                                Tt;
+
+  typedef Arrangement_on_surface_2<Gt2, Tt>             Arr;
+  typedef typename Arr::Traits_adaptor_2                Traits_adaptor_2;
+  typedef typename Gt2::Point_2                         Point_2;
+  typedef typename Gt2::X_monotone_curve_2              X_monotone_curve_2;
+  typedef typename std::iterator_traits<InputIterator>::value_type
+                                                        Iterator_value_type;
+  typedef typename std::is_same<Iterator_value_type, X_monotone_curve_2>::type
+                                                        Is_x_monotone;
+
+  const Arr& c_arr = arr;
+  const Gt2* geom_traits = c_arr.geometry_traits();
+  const Traits_adaptor_2* traits_adaptor = c_arr.traits_adaptor();
+
+  // Subdivide the input curves into x-monotone subcurves and isolated points.
+  std::vector<Iterator_value_type> curves(begin, end);
+  std::vector<X_monotone_curve_2> xcurves;
+  std::vector<Point_2> iso_points;
+  Arr_parallel_insertion_internal::make_x_monotone(curves, xcurves, iso_points,
+                                                   geom_traits, Is_x_monotone());
+  curves.clear();
+
+  const std::size_t nb_groups =
+    (std::min)(xcurves.size() / Arr_parallel_insertion_internal::min_group_size,
+               std::size_t(tbb::this_task_arena::max_concurrency()));
+
+  // Obtain an arrangement accessor.
+  Arr_accessor<Arr> arr_access(arr);
+
+  // Notify the arrangement observers that a global operation is about to
+  // take place.
+  arr_access.notify_before_global_change();
+
+  if (nb_groups < 2) {
+    // Too few curves to benefit from several groups.
+    if (arr.is_empty()) insert_empty(arr, xcurves.begin(), xcurves.end(),
+                                     iso_points.begin(), iso_points.end());
+    else insert_non_empty(arr, xcurves.begin(), xcurves.end(),
+                          iso_points.begin(), iso_points.end());
+  }
+  else {
+    typedef typename Arr_all_sides_oblivious_category<
+      typename Traits_adaptor_2::Left_side_category,
+      typename Traits_adaptor_2::Bottom_side_category,
+      typename Traits_adaptor_2::Top_side_category,
+      typename Traits_adaptor_2::Right_side_category>::result
+                                                        All_sides_oblivious;
+    Arr_parallel_insertion_internal::sort_by_min_vertex(xcurves, traits_adaptor,
+                                                        All_sides_oblivious());
+
+    if (arr.is_empty())
+      Arr_parallel_insertion_internal::parallel_construct(arr, xcurves,
+                                                          iso_points,
+                                                          nb_groups);
+    else {
+      // Construct the arrangement of the new curves, and insert its edges,
+      // which are interior disjoint, and its isolated vertices into arr.
+      Arr new_arr(geom_traits);
+      Arr_parallel_insertion_internal::parallel_construct(new_arr, xcurves,
+                                                          iso_points,
+                                                          nb_groups);
+      xcurves.clear();
+      iso_points.clear();
+      for (auto eit = new_arr.edges_begin(); eit != new_arr.edges_end(); ++eit)
+        xcurves.push_back(eit->curve());
+      for (auto vit = new_arr.vertices_begin(); vit != new_arr.vertices_end();
+           ++vit)
+        if (vit->is_isolated()) iso_points.push_back(vit->point());
+      insert_non_empty(arr, xcurves.begin(), xcurves.end(),
+                       iso_points.begin(), iso_points.end());
+    }
+  }
+
+  // Notify the arrangement observers that the global operation has been
+  // completed.
+  arr_access.notify_after_global_change();
+#endif
+}
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif
@@ -173,6 +173,9 @@ public:
 
     if (begin != end) {
       m_tree = new Tree(begin, end);
+      // Build the tree now rather than in the first query, so that the
+      // queries do not modify it and may be issued concurrently.
+      m_tree->build();
       m_is_empty = false;
     }
     else {
@@ -1394,6 +1394,7 @@ public:
   {
     init();
     set_with_guarantees(with_guarantees);
+    set_read_only(false);
   }
 
   Trapezoidal_decomposition_2(const double& depth_th, const double& size_th,
@@ -1408,6 +1409,7 @@ public:
   {
     init();
     set_with_guarantees(with_guarantees);
+    set_read_only(false);
   }
 
   //MICHAL: problematic, should not be used
@@ -1652,7 +1654,7 @@ public:
   // Postcondition:
   //  the input locate type is set to the type of the output trapezoid.
   // Remark:
-  //  locate call may change the class
+  //  locate call may change the class, unless it is in a read-only mode
   Td_map_item& locate(const Point& p,Locate_type &t) const
   {
     //print_dag_addresses(*m_dag_root);
@@ -1683,7 +1685,7 @@ public:
 
 #ifndef CGAL_NO_TRAPEZOIDAL_DECOMPOSITION_2_OPTIMIZATION
 
-    locate_opt_push(curr.get_data());
+    if (! m_read_only) locate_opt_push(curr.get_data());
 
 #endif
 
@@ -1698,7 +1700,7 @@ public:
   // Postcondition:
   //  the input locate type is set to the type of the output trapezoid.
   // Remark:
-  //  locate call may change the class
+  //  locate call may change the class, unless it is in a read-only mode
   Td_map_item& locate(const Curve_end& ce, Locate_type& lt) const
   {
 
@@ -1725,7 +1727,7 @@ public:
 
 #ifndef CGAL_NO_TRAPEZOIDAL_DECOMPOSITION_2_OPTIMIZATION
 
-    locate_opt_push(curr.get_data());
+    if (! m_read_only) locate_opt_push(curr.get_data());
 
 #endif
 
@@ -2004,6 +2006,25 @@ public:
     return old;
   }
 
+  /*
+    Input: bool
+    Output: bool
+    Description:
+    sets whether the queries are read-only. In a read-only mode, locate()
+    does not record the last located items, which are used to speed up the
+    following insertions, so concurrent queries do not race on the
+    structure.
+    Returns the previous mode.
+  */
+  bool set_read_only(bool u)
+  {
+    bool old = m_read_only;
+    m_read_only = u;
+    return old;
+  }
+
+  bool is_read_only() const { return m_read_only; }
+
   //This method occasionally(!) checks the guarantees
   // It is currently not in use, since the guarantees are constantly checked in O(1) time
   bool needs_update()
@@ -2123,6 +2144,7 @@ protected:
   unsigned long m_largest_leaf_depth; //holds the leargest depth of a leaf in the DAG
   unsigned long m_number_of_dag_nodes; //holds the number of nodes in the DAG
   bool m_with_guarantees; //whether the structure holds logarithmic query time and linear size guarantees //m_needs_update;
+  bool m_read_only; //whether the queries leave the structure untouched, so they can be issued concurrently
   unsigned long m_number_of_curves;
   const Traits* traits;
   //Before_split_data m_before_split;
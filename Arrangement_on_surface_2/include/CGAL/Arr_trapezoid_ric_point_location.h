@@ -173,6 +173,15 @@ public:
     m_with_guarantees = with_guarantees;
   }
 
+  /*! defines whether the queries are read-only. In a read-only mode, the
+   *   queries do not modify the underlying search structure, and may be
+   *   issued concurrently as long as the arrangement is not modified.
+   */
+  void set_read_only(bool read_only) { td.set_read_only(read_only); }
+
+  /*! determines whether the queries are read-only */
+  bool is_read_only() const { return td.is_read_only(); }
+
   /*! returns the depth of the underlying search structure
    *    (the longest path in the DAG)
    */
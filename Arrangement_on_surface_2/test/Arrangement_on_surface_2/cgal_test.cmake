@@ -1436,12 +1436,14 @@ test_algebraic_traits_leda()
 compile_and_run(test_data_traits)
 
 compile_and_run(test_insertion)
+compile_and_run(test_parallel_insertion)
 compile_and_run(test_unbounded_rational_insertion)
 compile_and_run(test_unbounded_rational_direct_insertion)
 compile_and_run(test_rational_function_traits_2)
 compile_and_run(test_iso_verts)
 
 compile_and_run(test_vert_ray_shoot_vert_segments)
+compile_and_run(test_parallel_point_location)
 
 test_construction_segments()
 test_construction_linear_curves()
@@ -0,0 +1,137 @@
+// Testing the aggregated insertion with a concurrency tag against the
+// sequential aggregated insertion.
+
+#include <CGAL/Exact_rational.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_linear_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_parallel_insertion.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_rational                          Number_type;
+typedef CGAL::Simple_cartesian<Number_type>           Kernel;
+typedef Kernel::Point_2                               Point_2;
+typedef Kernel::Segment_2                             Segment_2;
+typedef Kernel::Line_2                                Line_2;
+
+typedef CGAL::Arr_segment_traits_2<Kernel>            Segment_traits_2;
+typedef CGAL::Arrangement_2<Segment_traits_2>         Segment_arrangement_2;
+typedef CGAL::Arr_linear_traits_2<Kernel>             Linear_traits_2;
+typedef Linear_traits_2::Curve_2                      Linear_curve_2;
+typedef CGAL::Arrangement_2<Linear_traits_2>          Linear_arrangement_2;
+
+// Checks that both arrangements have the same vertices and the same numbers
+// of edges and faces.
+template <typename Arrangement>
+bool same_arrangements(const Arrangement& arr1, const Arrangement& arr2)
+{
+  if (! is_valid(arr1) || ! is_valid(arr2)) return false;
+  if (arr1.number_of_vertices() != arr2.number_of_vertices() ||
+      arr1.number_of_edges() != arr2.number_of_edges() ||
+      arr1.number_of_faces() != arr2.number_of_faces() ||
+      arr1.number_of_isolated_vertices() != arr2.number_of_isolated_vertices())
+    return false;
+
+  std::vector<Point_2> pts1, pts2;
+  for (auto vit = arr1.vertices_begin(); vit != arr1.vertices_end(); ++vit)
+    if (! vit->is_at_open_boundary()) pts1.push_back(vit->point());
+  for (auto vit = arr2.vertices_begin(); vit != arr2.vertices_end(); ++vit)
+    if (! vit->is_at_open_boundary()) pts2.push_back(vit->point());
+  std::sort(pts1.begin(), pts1.end());
+  std::sort(pts2.begin(), pts2.end());
+  return pts1 == pts2;
+}
+
+template <typename ConcurrencyTag>
+bool test_segments(const std::vector<Segment_2>& segs)
+{
+  // Kernel segments go through make_x_monotone().
+  Segment_arrangement_2 seq_arr, arr;
+  insert(seq_arr, segs.begin(), segs.end());
+  CGAL::insert<ConcurrencyTag>(arr, segs.begin(), segs.end());
+  if (! same_arrangements(seq_arr, arr)) {
+    std::cerr << "Error: different arrangements of segments." << std::endl;
+    return false;
+  }
+
+  // x-monotone curves, inserted into a non-empty arrangement.
+  std::vector<Segment_traits_2::X_monotone_curve_2> xcvs(segs.begin() + 10,
+                                                          segs.end());
+  Segment_arrangement_2 seq_arr2, arr2;
+  insert(seq_arr2, segs.begin(), segs.begin() + 10);
+  insert(arr2, segs.begin(), segs.begin() + 10);
+  insert_point(seq_arr2, Point_2(-5, -5));
+  auto v = insert_point(arr2, Point_2(-5, -5));
+  insert(seq_arr2, xcvs.begin(), xcvs.end());
+  CGAL::insert<ConcurrencyTag>(arr2, xcvs.begin(), xcvs.end());
+  if (! same_arrangements(seq_arr2, arr2) || v->point() != Point_2(-5, -5) ||
+      ! v->is_isolated()) {
+    std::cerr << "Error: different arrangements after the insertion of "
+              << "segments into a non-empty arrangement." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+bool test_linear_curves(const std::vector<Segment_2>& segs)
+{
+  // Segments crossed by a few lines, which are unbounded.
+  std::vector<Linear_curve_2> cvs(segs.begin(), segs.end());
+  for (int i = 0; i < 10; ++i)
+    cvs.push_back(Line_2(Point_2(0, 100 * i), Point_2(1000, 100 * i + 7 * i)));
+
+  Linear_arrangement_2 seq_arr, arr;
+  insert(seq_arr, cvs.begin(), cvs.end());
+  CGAL::insert<ConcurrencyTag>(arr, cvs.begin(), cvs.end());
+  if (! same_arrangements(seq_arr, arr)) {
+    std::cerr << "Error: different arrangements of linear curves." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+bool test_all(const std::vector<Segment_2>& segs)
+{
+  return test_segments<ConcurrencyTag>(segs) &&
+         test_linear_curves<ConcurrencyTag>(segs);
+}
+
+int main()
+{
+  // Short segments in a square, some of them intersecting or overlapping.
+  CGAL::Random rnd(0);
+  std::vector<Segment_2> segs;
+  for (int i = 0; i < 1500; ++i) {
+    const int x = rnd.get_int(0, 1000), y = rnd.get_int(0, 1000);
+    segs.push_back(Segment_2(Point_2(x, y),
+                             Point_2(x + rnd.get_int(1, 30),
+                                     y + rnd.get_int(-30, 30))));
+  }
+  for (int i = 0; i < 20; ++i)
+    segs.push_back(Segment_2(Point_2(10 * i, 0), Point_2(10 * i + 50, 0)));
+
+  if (! test_all<CGAL::Sequential_tag>(segs)) return 1;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // Use several groups of curves, whatever the number of cores.
+  tbb::task_arena arena(4);
+  bool ok = true;
+  arena.execute([&] { ok = test_all<CGAL::Parallel_tag>(segs); });
+  if (! ok) return 1;
+#endif
+
+  std::cout << "Passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,146 @@
+// Testing the point-location queries issued with a concurrency tag against
+// the queries issued one by one, with the landmarks and the trapezoidal-map
+// strategies.
+
+#include <CGAL/Exact_rational.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_naive_point_location.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_trapezoid_ric_point_location.h>
+#include <CGAL/Arr_batched_point_location.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <variant>
+#include <vector>
+
+typedef CGAL::Exact_rational                          Number_type;
+typedef CGAL::Simple_cartesian<Number_type>           Kernel;
+typedef Kernel::Point_2                               Point_2;
+typedef Kernel::Segment_2                             Segment_2;
+
+typedef CGAL::Arr_segment_traits_2<Kernel>            Traits_2;
+typedef CGAL::Arrangement_2<Traits_2>                 Arrangement_2;
+typedef CGAL::Arr_naive_point_location<Arrangement_2> Naive_pl;
+typedef CGAL::Arr_landmarks_point_location<Arrangement_2>
+                                                      Landmarks_pl;
+typedef CGAL::Arr_trapezoid_ric_point_location<Arrangement_2>
+                                                      Trapezoid_ric_pl;
+typedef CGAL::Arr_point_location_result<Arrangement_2>::Type
+                                                      Result_type;
+typedef std::pair<Point_2, Result_type>               Query_result;
+
+// Checks that both results represent the same arrangement feature. A point
+// on an edge may be reported with either halfedge of the edge.
+bool same_feature(const Result_type& res1, const Result_type& res2)
+{
+  typedef Arrangement_2::Halfedge_const_handle          Halfedge_const_handle;
+  const Halfedge_const_handle* he1 = std::get_if<Halfedge_const_handle>(&res1);
+  const Halfedge_const_handle* he2 = std::get_if<Halfedge_const_handle>(&res2);
+  if (he1 != nullptr && he2 != nullptr)
+    return *he1 == *he2 || *he1 == (*he2)->twin();
+  return res1 == res2;
+}
+
+bool same_results(const std::vector<Query_result>& results1,
+                  const std::vector<Query_result>& results2)
+{
+  if (results1.size() != results2.size()) return false;
+  for (std::size_t i = 0; i < results1.size(); ++i)
+    if (results1[i].first != results2[i].first ||
+        ! same_feature(results1[i].second, results2[i].second))
+      return false;
+  return true;
+}
+
+template <typename ConcurrencyTag, typename PointLocation>
+bool test_pl(const PointLocation& pl, const std::vector<Point_2>& points,
+             const char* name)
+{
+  std::vector<Query_result> expected;
+  for (const Point_2& p : points)
+    expected.push_back(std::make_pair(p, pl.locate(p)));
+
+  std::vector<Query_result> results;
+  CGAL::locate<ConcurrencyTag>(pl, points.begin(), points.end(),
+                               std::back_inserter(results));
+  if (! same_results(results, expected)) {
+    std::cerr << "Error: different results of the " << name
+              << " point location." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <typename ConcurrencyTag>
+bool test_all(const Arrangement_2& arr, const std::vector<Point_2>& points)
+{
+  Landmarks_pl lm_pl(arr);
+  Trapezoid_ric_pl trap_pl(arr);
+  trap_pl.set_read_only(true);
+  return test_pl<ConcurrencyTag>(lm_pl, points, "landmarks") &&
+         test_pl<ConcurrencyTag>(trap_pl, points, "trapezoidal");
+}
+
+int main()
+{
+  // Short segments in a square, some of them intersecting or overlapping.
+  CGAL::Random rnd(0);
+  std::vector<Segment_2> segs;
+  for (int i = 0; i < 200; ++i) {
+    const int x = rnd.get_int(0, 1000), y = rnd.get_int(0, 1000);
+    segs.push_back(Segment_2(Point_2(x, y),
+                             Point_2(x + rnd.get_int(1, 100),
+                                     y + rnd.get_int(-100, 100))));
+  }
+  Arrangement_2 arr;
+  insert(arr, segs.begin(), segs.end());
+  insert_point(arr, Point_2(-10, -10));
+
+  // Query points in the faces, on vertices, and on edges.
+  std::vector<Point_2> points;
+  for (int i = 0; i < 1000; ++i)
+    points.push_back(Point_2(Number_type(rnd.get_int(-20000, 220000), 200),
+                             Number_type(rnd.get_int(-20000, 220000), 200)));
+  for (auto vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit)
+    points.push_back(vit->point());
+  for (auto eit = arr.edges_begin(); eit != arr.edges_end(); ++eit)
+    points.push_back(CGAL::midpoint(eit->source()->point(),
+                                    eit->target()->point()));
+
+  if (! test_all<CGAL::Sequential_tag>(arr, points)) return 1;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // Issue concurrent queries, whatever the number of cores.
+  tbb::task_arena arena(4);
+  bool ok = true;
+  arena.execute([&] { ok = test_all<CGAL::Parallel_tag>(arr, points); });
+  if (! ok) return 1;
+#endif
+
+  // The read-only mode leaves the trapezoidal map usable by insertions.
+  Trapezoid_ric_pl trap_pl(arr);
+  trap_pl.set_read_only(true);
+  insert(arr, Segment_2(Point_2(-5, -5), Point_2(1005, 1005)));
+  trap_pl.set_read_only(false);
+  insert(arr, Segment_2(Point_2(-5, 1005), Point_2(1005, -5)));
+  Naive_pl naive_pl(arr);
+  for (const Point_2& p : points)
+    if (! same_feature(trap_pl.locate(p), naive_pl.locate(p))) {
+      std::cerr << "Error: the trapezoidal map is invalid after updates."
+                << std::endl;
+      return 1;
+    }
+
+  std::cout << "Passed" << std::endl;
+  return 0;
+}
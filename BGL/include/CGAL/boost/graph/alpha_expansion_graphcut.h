@@ -64,10 +64,21 @@ struct Alpha_expansion_old_API_wrapper_graph
   typedef CGAL::Identity_property_map<std::size_t> Vertex_index_map;
   typedef CGAL::Pointer_property_map<std::size_t>::type Vertex_label_map;
 
+  // Column of the cost matrix, read in place instead of being copied
+  // into an `std::vector` for each access
+  struct Vertex_label_costs
+  {
+    const std::vector<std::vector<double> >* cost_matrix;
+    std::size_t idx;
+
+    double operator[] (std::size_t label) const { return (*cost_matrix)[label][idx]; }
+    std::size_t size() const { return cost_matrix->size(); }
+  };
+
   struct Vertex_label_cost_map
   {
     typedef std::size_t key_type;
-    typedef std::vector<double> value_type;
+    typedef Vertex_label_costs value_type;
     typedef value_type reference;
     typedef boost::readable_property_map_tag category;
 
@@ -79,11 +90,7 @@ struct Alpha_expansion_old_API_wrapper_graph
 
     friend value_type get (const Vertex_label_cost_map& pmap, key_type idx)
     {
-      std::vector<double> out;
-      out.reserve (pmap.cost_matrix->size());
-      for (std::size_t i = 0; i < pmap.cost_matrix->size(); ++ i)
-        out.push_back ((*pmap.cost_matrix)[i][idx]);
-      return out;
+      return Vertex_label_costs { pmap.cost_matrix, idx };
     }
   };
 
@@ -586,12 +593,15 @@ double alpha_expansion_graphcut (const InputGraph& input_graph,
         std::size_t vertex_i = get(vertex_index_map, vd);
         Vertex_descriptor new_vertex = alpha_expansion.add_vertex();
         inserted_vertices[vertex_i] = new_vertex;
-        double source_weight = get(vertex_label_cost_map, vd)[alpha];
+        // costs are read once per vertex (the map may return them by value)
+        const auto costs = get(vertex_label_cost_map, vd);
+        std::size_t label = std::size_t(get(vertex_label_map, vd));
+        double source_weight = costs[alpha];
         // since it is expansion move, current alpha labeled vertices will be assigned to alpha again,
         // making sink_weight 'infinity' guarantee this.
-        double sink_weight = (std::size_t(get(vertex_label_map, vd)) == alpha ?
+        double sink_weight = (label == alpha ?
                               (std::numeric_limits<double>::max)()
-                              : get(vertex_label_cost_map, vd)[get(vertex_label_map, vd)]);
+                              : costs[label]);
 
         alpha_expansion.add_tweight(new_vertex, source_weight, sink_weight);
       }
@@ -736,8 +746,9 @@ double alpha_expansion_graphcut (const InputGraph& input_graph,
       Vertex_descriptor new_vertex = graph.add_vertex();
       inserted_vertices[vertex_i] = new_vertex;
 
-      double source_weight = get(vertex_label_cost_map, vd)[0];
-      double sink_weight = get(vertex_label_cost_map, vd)[0];
+      const auto costs = get(vertex_label_cost_map, vd);
+      double source_weight = costs[0];
+      double sink_weight = costs[0];
 
       graph.add_tweight(new_vertex, source_weight, sink_weight);
     }
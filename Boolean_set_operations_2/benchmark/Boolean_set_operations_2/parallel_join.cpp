@@ -0,0 +1,63 @@
+// Times the union of many small footprint-like polygons scattered in the
+// plane, in random order, with the sequential and the parallel aggregated
+// join.
+//
+// Usage: parallel_join [number of polygons]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Polygon_set_2.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Point_2 Point_2;
+typedef CGAL::Polygon_2<Kernel>  Polygon_2;
+typedef CGAL::Polygon_set_2<Kernel> Polygon_set_2;
+
+template <typename ConcurrencyTag>
+void bench(const std::string& name, const std::vector<Polygon_2>& polygons,
+           ConcurrencyTag tag)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  Polygon_set_2 polygon_set;
+  polygon_set.join(polygons.begin(), polygons.end(), tag);
+  timer.stop();
+  std::cout << name << " join of " << polygons.size() << " polygons: "
+            << timer.time() << " sec. ("
+            << polygon_set.number_of_polygons_with_holes()
+            << " polygons with holes)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const int nb_poly = (argc > 1) ? std::stoi(argv[1]) : 20000;
+
+  // Rotated rectangles, some of them overlapping their neighbors.
+  CGAL::Random rnd(0);
+  std::vector<Polygon_2> polygons(nb_poly);
+  for (Polygon_2& polygon : polygons)
+  {
+    const double x = rnd.get_double(0, 1000), y = rnd.get_double(0, 1000);
+    const double w = rnd.get_double(0.5, 5), h = rnd.get_double(0.5, 5);
+    const double a = rnd.get_double(0, CGAL_PI);
+    const double c = std::cos(a), s = std::sin(a);
+    polygon.push_back(Point_2(x, y));
+    polygon.push_back(Point_2(x + w * c, y + w * s));
+    polygon.push_back(Point_2(x + w * c - h * s, y + w * s + h * c));
+    polygon.push_back(Point_2(x - h * s, y + h * c));
+  }
+
+  bench("Sequential", polygons, CGAL::Sequential_tag());
+#ifdef CGAL_LINKED_WITH_TBB
+  bench("Parallel  ", polygons, CGAL::Parallel_tag());
+#endif
+
+  return EXIT_SUCCESS;
+}
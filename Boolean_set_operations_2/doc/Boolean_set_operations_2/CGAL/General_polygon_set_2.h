@@ -261,6 +261,33 @@ void intersection(InputIterator1 pgn_begin, InputIterator1 pgn_end,
 InputIterator2 pgn_with_holes_begin,
 InputIterator2 pgn_with_holes_end);
 
+/*!
+same as above for a range of polygons (or polygons with holes).
+With `ConcurrencyTag` being `Parallel_tag`, the input is split into
+groups of nearby polygons, and the intersections of disjoint groups are
+computed in parallel.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\pre If `ConcurrencyTag` is `Parallel_tag`, the function objects of `Traits` can be used concurrently.
+*/
+template <class InputIterator, class ConcurrencyTag>
+void intersection(InputIterator begin, InputIterator end, ConcurrencyTag tag);
+
+/*!
+same as above for two ranges of polygons and polygons with holes.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\pre If `ConcurrencyTag` is `Parallel_tag`, the function objects of `Traits` can be used concurrently.
+*/
+template <class InputIterator1, class InputIterator2, class ConcurrencyTag>
+void intersection(InputIterator1 pgn_begin, InputIterator1 pgn_end,
+InputIterator2 pgn_with_holes_begin,
+InputIterator2 pgn_with_holes_end, ConcurrencyTag tag);
+
 /*!
 computes the union of `gps` and `other`.
 */
@@ -293,6 +320,33 @@ void join(InputIterator1 pgn_begin, InputIterator1 pgn_end,
 InputIterator2 pgn_with_holes_begin,
 InputIterator2 pgn_with_holes_end);
 
+/*!
+same as above for a range of polygons (or polygons with holes).
+With `ConcurrencyTag` being `Parallel_tag`, the input is split into
+groups of nearby polygons, and the unions of disjoint groups are
+computed in parallel.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\pre If `ConcurrencyTag` is `Parallel_tag`, the function objects of `Traits` can be used concurrently.
+*/
+template <class InputIterator, class ConcurrencyTag>
+void join(InputIterator begin, InputIterator end, ConcurrencyTag tag);
+
+/*!
+same as above for two ranges of polygons and polygons with holes.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\pre If `ConcurrencyTag` is `Parallel_tag`, the function objects of `Traits` can be used concurrently.
+*/
+template <class InputIterator1, class InputIterator2, class ConcurrencyTag>
+void join(InputIterator1 pgn_begin, InputIterator1 pgn_end,
+InputIterator2 pgn_with_holes_begin,
+InputIterator2 pgn_with_holes_end, ConcurrencyTag tag);
+
 /*!
 computes the difference between `gps` and `other`.
 */
@@ -342,6 +396,33 @@ void symmetric_difference(InputIterator1 pgn_begin, InputIterator1 pgn_end,
 InputIterator2 pgn_with_holes_begin,
 InputIterator2 pgn_with_holes_end);
 
+/*!
+same as above for a range of polygons (or polygons with holes).
+With `ConcurrencyTag` being `Parallel_tag`, the input is split into
+groups of nearby polygons, and the symmetric differences of disjoint groups are
+computed in parallel.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\pre If `ConcurrencyTag` is `Parallel_tag`, the function objects of `Traits` can be used concurrently.
+*/
+template <class InputIterator, class ConcurrencyTag>
+void symmetric_difference(InputIterator begin, InputIterator end, ConcurrencyTag tag);
+
+/*!
+same as above for two ranges of polygons and polygons with holes.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\pre If `ConcurrencyTag` is `Parallel_tag`, the function objects of `Traits` can be used concurrently.
+*/
+template <class InputIterator1, class InputIterator2, class ConcurrencyTag>
+void symmetric_difference(InputIterator1 pgn_begin, InputIterator1 pgn_end,
+InputIterator2 pgn_with_holes_begin,
+InputIterator2 pgn_with_holes_end, ConcurrencyTag tag);
+
 /// @}
 
 /// \name Bivariate Operations
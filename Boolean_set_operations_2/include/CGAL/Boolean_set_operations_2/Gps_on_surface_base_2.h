@@ -36,6 +36,15 @@
 #include <CGAL/Boolean_set_operations_2/Gps_polygon_simplifier.h>
 #include <CGAL/Boolean_set_operations_2/Ccb_curve_iterator.h>
 #include <CGAL/Union_find.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
 
 
 /*!
@@ -53,6 +62,13 @@ namespace CGAL {
 
 namespace Boolean_set_operation_2_internal
 {
+  // Selects the aggregated operations that take a concurrency tag.
+  template <typename Tag>
+  struct Is_concurrency_tag :
+    std::integral_constant<bool, std::is_same<Tag, Sequential_tag>::value ||
+                                 std::is_same<Tag, Parallel_tag>::value>
+  {};
+
   struct NoValidationPolicy
   {
    /*! is_valid - Checks if a Traits::Polygon_2 OR
@@ -628,13 +644,41 @@ public:
     this->_reset_faces();
   }
 
+  // join a range of polygons (see the comment below about k=5).
+  // With `ConcurrencyTag` being `Parallel_tag`, the input is split into
+  // groups of nearby polygons, and disjoint groups are merged concurrently.
+  template <typename InputIterator, typename ConcurrencyTag,
+            typename = std::enable_if_t<Boolean_set_operation_2_internal::
+                         Is_concurrency_tag<ConcurrencyTag>::value> >
+  void join(InputIterator begin, InputIterator end,
+            ConcurrencyTag tag, unsigned int k = 5)
+  {
+    typename std::iterator_traits<InputIterator>::value_type pgn;
+    this->join(begin, end, pgn, k, tag);
+    this->remove_redundant_edges();
+    this->_reset_faces();
+  }
+
+  template <typename InputIterator1, typename InputIterator2,
+            typename ConcurrencyTag,
+            typename = std::enable_if_t<Boolean_set_operation_2_internal::
+                         Is_concurrency_tag<ConcurrencyTag>::value> >
+  void join(InputIterator1 begin1, InputIterator1 end1,
+            InputIterator2 begin2, InputIterator2 end2,
+            ConcurrencyTag tag, unsigned int k = 5)
+  {
+    this->join(begin1, end1, begin2, end2, k, tag);
+  }
+
   // join range of simple polygons
   // 5 is the magic number in which we switch to a sweep-based algorithm
   // instead of a D&C algorithm. This point should be further studies, as
   // it is hard to believe that this is the best value for all applications.
-  template <typename InputIterator>
+  template <typename InputIterator,
+            typename ConcurrencyTag = Sequential_tag>
   inline void join(InputIterator begin, InputIterator end, Polygon_2&,
-                   unsigned int k = 5)
+                   unsigned int k = 5,
+                   ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin, end) + 1);
 
@@ -648,8 +692,7 @@ public:
     }
 
     Join_merge<Aos_2> join_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, join_merge);
+    _aggregate(arr_vec, k, join_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -657,9 +700,11 @@ public:
   }
 
   //join range of polygons with holes (see previous comment about k=5).
-  template <typename InputIterator>
+  template <typename InputIterator,
+            typename ConcurrencyTag = Sequential_tag>
   inline void join(InputIterator begin, InputIterator end,
-                   Polygon_with_holes_2&, unsigned int k = 5)
+                   Polygon_with_holes_2&, unsigned int k = 5,
+                   ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin, end) + 1);
     arr_vec[0].first = this->m_arr;
@@ -673,8 +718,7 @@ public:
     }
 
     Join_merge<Aos_2> join_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, join_merge);
+    _aggregate(arr_vec, k, join_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -682,10 +726,12 @@ public:
   }
 
   // (see previous comment about k=5).
-  template <typename InputIterator1, typename InputIterator2>
+  template <typename InputIterator1, typename InputIterator2,
+            typename ConcurrencyTag = Sequential_tag>
   inline void join(InputIterator1 begin1, InputIterator1 end1,
                    InputIterator2 begin2, InputIterator2 end2,
-                   unsigned int k = 5)
+                   unsigned int k = 5,
+                   ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin1, end1)+
                                     std::distance(begin2, end2)+1);
@@ -706,8 +752,7 @@ public:
     }
 
     Join_merge<Aos_2> join_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, join_merge);
+    _aggregate(arr_vec, k, join_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -728,11 +773,37 @@ public:
     this->_reset_faces();
   }
 
+  // intersect a range of polygons (see the join() above about ConcurrencyTag).
+  template <typename InputIterator, typename ConcurrencyTag,
+            typename = std::enable_if_t<Boolean_set_operation_2_internal::
+                         Is_concurrency_tag<ConcurrencyTag>::value> >
+  void intersection(InputIterator begin, InputIterator end,
+                    ConcurrencyTag tag, unsigned int k = 5)
+  {
+    typename std::iterator_traits<InputIterator>::value_type pgn;
+    this->intersection(begin, end, pgn, k, tag);
+    this->remove_redundant_edges();
+    this->_reset_faces();
+  }
+
+  template <typename InputIterator1, typename InputIterator2,
+            typename ConcurrencyTag,
+            typename = std::enable_if_t<Boolean_set_operation_2_internal::
+                         Is_concurrency_tag<ConcurrencyTag>::value> >
+  void intersection(InputIterator1 begin1, InputIterator1 end1,
+                    InputIterator2 begin2, InputIterator2 end2,
+                    ConcurrencyTag tag, unsigned int k = 5)
+  {
+    this->intersection(begin1, end1, begin2, end2, k, tag);
+  }
+
 
   // intersect range of simple polygons
-  template <typename InputIterator>
+  template <typename InputIterator,
+            typename ConcurrencyTag = Sequential_tag>
   inline void intersection(InputIterator begin, InputIterator end,
-                           Polygon_2&, unsigned int k)
+                           Polygon_2&, unsigned int k,
+                           ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin, end) + 1);
     arr_vec[0].first = this->m_arr;
@@ -746,8 +817,7 @@ public:
     }
 
     Intersection_merge<Aos_2> intersection_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, intersection_merge);
+    _aggregate(arr_vec, k, intersection_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -755,9 +825,11 @@ public:
   }
 
   //intersect range of polygons with holes
-  template <typename InputIterator>
+  template <typename InputIterator,
+            typename ConcurrencyTag = Sequential_tag>
   inline void intersection(InputIterator begin, InputIterator end,
-                           Polygon_with_holes_2&, unsigned int k)
+                           Polygon_with_holes_2&, unsigned int k,
+                           ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin, end) + 1);
     arr_vec[0].first = this->m_arr;
@@ -771,8 +843,7 @@ public:
     }
 
     Intersection_merge<Aos_2> intersection_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, intersection_merge);
+    _aggregate(arr_vec, k, intersection_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -780,10 +851,12 @@ public:
   }
 
 
-  template <typename InputIterator1, typename InputIterator2>
+  template <typename InputIterator1, typename InputIterator2,
+            typename ConcurrencyTag = Sequential_tag>
   inline void intersection(InputIterator1 begin1, InputIterator1 end1,
                            InputIterator2 begin2, InputIterator2 end2,
-                           unsigned int k = 5)
+                           unsigned int k = 5,
+                           ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin1, end1)+
                                     std::distance(begin2, end2)+1);
@@ -805,8 +878,7 @@ public:
     }
 
     Intersection_merge<Aos_2> intersection_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, intersection_merge);
+    _aggregate(arr_vec, k, intersection_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -829,11 +901,37 @@ public:
     this->_reset_faces();
   }
 
+  // symmetric_difference of a range of polygons (see the join() above).
+  template <typename InputIterator, typename ConcurrencyTag,
+            typename = std::enable_if_t<Boolean_set_operation_2_internal::
+                         Is_concurrency_tag<ConcurrencyTag>::value> >
+  void symmetric_difference(InputIterator begin, InputIterator end,
+                            ConcurrencyTag tag, unsigned int k = 5)
+  {
+    typename std::iterator_traits<InputIterator>::value_type pgn;
+    this->symmetric_difference(begin, end, pgn, k, tag);
+    this->remove_redundant_edges();
+    this->_reset_faces();
+  }
+
+  template <typename InputIterator1, typename InputIterator2,
+            typename ConcurrencyTag,
+            typename = std::enable_if_t<Boolean_set_operation_2_internal::
+                         Is_concurrency_tag<ConcurrencyTag>::value> >
+  void symmetric_difference(InputIterator1 begin1, InputIterator1 end1,
+                            InputIterator2 begin2, InputIterator2 end2,
+                            ConcurrencyTag tag, unsigned int k = 5)
+  {
+    this->symmetric_difference(begin1, end1, begin2, end2, k, tag);
+  }
+
 
   // intersect range of simple polygons (see previous comment about k=5).
-  template <typename InputIterator>
+  template <typename InputIterator,
+            typename ConcurrencyTag = Sequential_tag>
   inline void symmetric_difference(InputIterator begin, InputIterator end,
-                                   Polygon_2&, unsigned int k = 5)
+                                   Polygon_2&, unsigned int k = 5,
+                                   ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin, end) + 1);
     arr_vec[0].first = this->m_arr;
@@ -847,8 +945,7 @@ public:
     }
 
     Xor_merge<Aos_2> xor_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, xor_merge);
+    _aggregate(arr_vec, k, xor_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -856,9 +953,11 @@ public:
   }
 
   //intersect range of polygons with holes (see previous comment about k=5).
-  template <typename InputIterator>
+  template <typename InputIterator,
+            typename ConcurrencyTag = Sequential_tag>
     inline void symmetric_difference(InputIterator begin, InputIterator end,
-                                     Polygon_with_holes_2&, unsigned int k = 5)
+                                     Polygon_with_holes_2&, unsigned int k = 5,
+                                     ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin, end) + 1);
     arr_vec[0].first = this->m_arr;
@@ -872,8 +971,7 @@ public:
     }
 
     Xor_merge<Aos_2> xor_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, xor_merge);
+    _aggregate(arr_vec, k, xor_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -881,10 +979,12 @@ public:
   }
 
   // (see previous comment about k=5).
-  template <typename InputIterator1, typename InputIterator2>
+  template <typename InputIterator1, typename InputIterator2,
+            typename ConcurrencyTag = Sequential_tag>
   inline void symmetric_difference(InputIterator1 begin1, InputIterator1 end1,
                                    InputIterator2 begin2, InputIterator2 end2,
-                                   unsigned int k = 5)
+                                   unsigned int k = 5,
+                                   ConcurrencyTag tag = ConcurrencyTag())
   {
     std::vector<Arr_entry> arr_vec (std::distance(begin1, end1)+
                                     std::distance(begin2, end2)+1);
@@ -906,8 +1006,7 @@ public:
     }
 
     Xor_merge<Aos_2> xor_merge;
-    _build_sorted_vertices_vectors (arr_vec);
-    _divide_and_conquer(0, static_cast<unsigned int>(arr_vec.size()-1), arr_vec, k, xor_merge);
+    _aggregate(arr_vec, k, xor_merge, tag);
 
     //the result arrangement is at index 0
     this->m_arr = arr_vec[0].first;
@@ -1353,34 +1452,117 @@ protected:
     }
   }
 
+  void _build_sorted_vertices_vector (Arr_entry& entry,
+                                      const Less_vertex_handle& comp)
+  {
+    // Allocate a vector of handles to all vertices in the arrangement.
+    Aos_2*           p_arr = entry.first;
+    Vertex_iterator  vit;
+    std::size_t      j;
+
+    entry.second = new std::vector<Vertex_handle>;
+    entry.second->resize (p_arr->number_of_vertices());
+
+    for (j = 0, vit = p_arr->vertices_begin();
+         vit != p_arr->vertices_end();
+         j++, ++vit)
+    {
+      (*(entry.second))[j] = vit;
+    }
+
+    // Sort the vector.
+    std::sort (entry.second->begin(), entry.second->end(), comp);
+  }
+
   void _build_sorted_vertices_vectors (std::vector<Arr_entry>& arr_vec)
   {
     Less_vertex_handle    comp (m_traits->compare_xy_2_object());
-    Aos_2                 *p_arr;
-    Vertex_iterator       vit;
     const std::size_t     n = arr_vec.size();
-    std::size_t           i, j;
 
-    for (i = 0; i < n; i++)
-    {
-      // Allocate a vector of handles to all vertices in the current
-      // arrangement.
-      p_arr = arr_vec[i].first;
-      arr_vec[i].second = new std::vector<Vertex_handle>;
-      arr_vec[i].second->resize (p_arr->number_of_vertices());
-
-      for (j = 0, vit = p_arr->vertices_begin();
-           vit != p_arr->vertices_end();
-           j++, ++vit)
-      {
-        (*(arr_vec[i].second))[j] = vit;
-      }
+    for (std::size_t i = 0; i < n; i++)
+      _build_sorted_vertices_vector (arr_vec[i], comp);
+  }
 
-      // Sort the vector.
-      std::sort (arr_vec[i].second->begin(), arr_vec[i].second->end(), comp);
+  // Merges the arrangements of arr_vec into arr_vec[0].first.
+  template <class Merge, typename ConcurrencyTag>
+  void _aggregate (std::vector<Arr_entry>& arr_vec, unsigned int k,
+                   Merge merge_func, ConcurrencyTag)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      _parallel_aggregate (arr_vec, k, merge_func);
+      return;
     }
+#endif
+    _build_sorted_vertices_vectors (arr_vec);
+    _divide_and_conquer (0, static_cast<unsigned int>(arr_vec.size()-1),
+                         arr_vec, k, merge_func);
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  template <class Merge>
+  void _parallel_aggregate (std::vector<Arr_entry>& arr_vec, unsigned int k,
+                            Merge merge_func)
+  {
+    Less_vertex_handle    comp (m_traits->compare_xy_2_object());
+
+    tbb::parallel_for (std::size_t(0), arr_vec.size(), [&](std::size_t i)
+    {
+      _build_sorted_vertices_vector (arr_vec[i], comp);
+    });
+
+    // Order the input arrangements by their lexicographically smallest
+    // vertex (the current point set stays at index 0), such that each
+    // subtree of the divide-and-conquer merges a group of nearby polygons,
+    // and the sweeps of different subtrees run over disjoint groups.
+    std::sort (arr_vec.begin() + 1, arr_vec.end(),
+               [&comp](const Arr_entry& e1, const Arr_entry& e2)
+               {
+                 if (e2.second->empty())
+                   return false;
+                 if (e1.second->empty())
+                   return true;
+                 return comp (e1.second->front(), e2.second->front());
+               });
+
+    _parallel_divide_and_conquer (0,
+                                  static_cast<unsigned int>(arr_vec.size()-1),
+                                  arr_vec, k, merge_func);
+  }
+
+  // Same as _divide_and_conquer(), the k sub-ranges being merged
+  // concurrently. Each merge only accesses the entries of its own range,
+  // and all merges use the traits of the polygon set, whose function
+  // objects must then be usable concurrently (a documented precondition).
+  template <class Merge>
+  void _parallel_divide_and_conquer (unsigned int lower, unsigned int upper,
+                                     std::vector<Arr_entry>& arr_vec,
+                                     unsigned int k, Merge merge_func)
+  {
+    if ((upper - lower) < k)
+    {
+      merge_func(lower, upper, 1, arr_vec);
+      return;
+    }
+
+    const unsigned int sub_size = ((upper - lower + 1) / k);
+
+    tbb::parallel_for (0u, k, [&](unsigned int i)
+    {
+      const unsigned int curr_lower = lower + i * sub_size;
+      const unsigned int curr_upper =
+        (i == k-1) ? upper : curr_lower + sub_size - 1;
+      _parallel_divide_and_conquer (curr_lower, curr_upper, arr_vec, k,
+                                    merge_func);
+    });
+    merge_func (lower, lower + (k-1) * sub_size, sub_size, arr_vec);
+  }
+#endif
+
   template <class Merge>
   void _divide_and_conquer (unsigned int lower, unsigned int upper,
                             std::vector<Arr_entry>& arr_vec,
@@ -106,6 +106,20 @@ public:
     Base::intersection(begin1, end1, begin2, end2);
   }
 
+  template <class InputIterator, class ConcurrencyTag>
+  inline void intersection(InputIterator begin, InputIterator end, ConcurrencyTag tag)
+  {
+    Base::intersection(begin, end, tag);
+  }
+
+  template <class InputIterator1, class InputIterator2, class ConcurrencyTag>
+  inline void intersection(InputIterator1 begin1, InputIterator1 end1,
+                           InputIterator2 begin2, InputIterator2 end2,
+                           ConcurrencyTag tag)
+  {
+    Base::intersection(begin1, end1, begin2, end2, tag);
+  }
+
   inline void join(const Polygon_2& pgn)
   {
     Base::join(pgn);
@@ -139,6 +153,20 @@ public:
     Base::join(begin1, end1, begin2, end2);
   }
 
+  template <class InputIterator, class ConcurrencyTag>
+  inline void join(InputIterator begin, InputIterator end, ConcurrencyTag tag)
+  {
+    Base::join(begin, end, tag);
+  }
+
+  template <class InputIterator1, class InputIterator2, class ConcurrencyTag>
+  inline void join(InputIterator1 begin1, InputIterator1 end1,
+                   InputIterator2 begin2, InputIterator2 end2,
+                   ConcurrencyTag tag)
+  {
+    Base::join(begin1, end1, begin2, end2, tag);
+  }
+
   inline void difference(const Polygon_2& pgn)
   {
     Base::difference(pgn);
@@ -205,6 +233,20 @@ public:
     Base::symmetric_difference(begin1, end1, begin2, end2);
   }
 
+  template <class InputIterator, class ConcurrencyTag>
+  inline void symmetric_difference(InputIterator begin, InputIterator end, ConcurrencyTag tag)
+  {
+    Base::symmetric_difference(begin, end, tag);
+  }
+
+  template <class InputIterator1, class InputIterator2, class ConcurrencyTag>
+  inline void symmetric_difference(InputIterator1 begin1, InputIterator1 end1,
+                                   InputIterator2 begin2, InputIterator2 end2,
+                                   ConcurrencyTag tag)
+  {
+    Base::symmetric_difference(begin1, end1, begin2, end2, tag);
+  }
+
   inline bool do_intersect(const Polygon_2& pgn)
   {
     return (Base::do_intersect(pgn));
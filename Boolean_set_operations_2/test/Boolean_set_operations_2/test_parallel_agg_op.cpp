@@ -0,0 +1,106 @@
+// Tests the aggregated operations with Parallel_tag against the sequential
+// ones, on overlapping and disjoint squares.
+
+#include <CGAL/Exact_rational.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Boolean_set_operations_2.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_rational                       Number_type;
+typedef CGAL::Simple_cartesian<Number_type>        Kernel;
+typedef Kernel::Point_2                            Point_2;
+typedef CGAL::Polygon_2<Kernel>                    Polygon_2;
+typedef CGAL::Polygon_with_holes_2<Kernel>         Polygon_with_holes_2;
+typedef CGAL::Polygon_set_2<Kernel>                Polygon_set_2;
+
+Polygon_2 square(int x, int y, int size)
+{
+  Polygon_2 pgn;
+  pgn.push_back(Point_2(x, y));
+  pgn.push_back(Point_2(x + size, y));
+  pgn.push_back(Point_2(x + size, y + size));
+  pgn.push_back(Point_2(x, y + size));
+  return pgn;
+}
+
+bool same_point_set(const Polygon_set_2& ps1, const Polygon_set_2& ps2)
+{
+  Polygon_set_2 diff;
+  diff.symmetric_difference(ps1, ps2);
+  return diff.is_empty() &&
+         ps1.number_of_polygons_with_holes() ==
+           ps2.number_of_polygons_with_holes();
+}
+
+template <typename ConcurrencyTag>
+void test_aggregated_operations(const std::vector<Polygon_2>& pgns,
+                                const std::vector<Polygon_with_holes_2>& pwhs,
+                                ConcurrencyTag tag)
+{
+  // join
+  Polygon_set_2 seq_join, par_join;
+  seq_join.join(pgns.begin(), pgns.end());
+  par_join.join(pgns.begin(), pgns.end(), tag);
+  assert(same_point_set(seq_join, par_join));
+  assert(seq_join.arrangement().number_of_vertices() ==
+         par_join.arrangement().number_of_vertices());
+
+  // join of two ranges, starting from a non-empty set
+  Polygon_set_2 seq_join2(square(-10, -10, 5)), par_join2(square(-10, -10, 5));
+  seq_join2.join(pgns.begin(), pgns.end(), pwhs.begin(), pwhs.end());
+  par_join2.join(pgns.begin(), pgns.end(), pwhs.begin(), pwhs.end(), tag);
+  assert(same_point_set(seq_join2, par_join2));
+
+  // symmetric difference
+  Polygon_set_2 seq_xor, par_xor;
+  seq_xor.symmetric_difference(pgns.begin(), pgns.end());
+  par_xor.symmetric_difference(pgns.begin(), pgns.end(), tag);
+  assert(same_point_set(seq_xor, par_xor));
+
+  // intersection of the squares containing the origin
+  std::vector<Polygon_2> around_origin;
+  for (int i = 0; i < 40; ++i)
+    around_origin.push_back(square(-1 - i % 7, -1 - i % 5, 8 + i % 11));
+  Polygon_set_2 seq_inter(square(-20, -20, 40)), par_inter(square(-20, -20, 40));
+  seq_inter.intersection(around_origin.begin(), around_origin.end());
+  par_inter.intersection(around_origin.begin(), around_origin.end(), tag);
+  assert(same_point_set(seq_inter, par_inter));
+  assert(par_inter.number_of_polygons_with_holes() == 1);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  // clusters of overlapping squares, far from each other
+  std::vector<Polygon_2> pgns;
+  for (int c = 0; c < 6; ++c)
+    for (int i = 0; i < 25; ++i)
+      pgns.push_back(square(100 * c + rnd.get_int(0, 20),
+                            rnd.get_int(0, 20), rnd.get_int(1, 8)));
+
+  std::vector<Polygon_with_holes_2> pwhs;
+  Polygon_2 hole = square(4, 4, 2);
+  hole.reverse_orientation();
+  pwhs.push_back(Polygon_with_holes_2(square(0, 0, 10), &hole, &hole + 1));
+  pwhs.push_back(Polygon_with_holes_2(square(1000, 0, 10)));
+
+  test_aggregated_operations(pgns, pwhs, CGAL::Sequential_tag());
+#ifdef CGAL_LINKED_WITH_TBB
+  test_aggregated_operations(pgns, pwhs, CGAL::Parallel_tag());
+#endif
+
+  // an empty range
+  std::vector<Polygon_2> none;
+  Polygon_set_2 ps(square(0, 0, 1));
+  ps.join(none.begin(), none.end(), CGAL::Parallel_if_available_tag());
+  assert(ps.number_of_polygons_with_holes() == 1);
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
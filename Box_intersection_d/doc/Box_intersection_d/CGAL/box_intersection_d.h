@@ -248,19 +248,18 @@ void box_intersection_all_pairs_d(
   the algorithm is to be run in parallel, if `CGAL::Parallel_tag` is specified
   and \cgal has been linked with the Intel TBB library, or sequentially,
   if `CGAL::Sequential_tag` - the default value - is specified.
-  The parallelization of the algorithm is based on a divide-and-conquer
-  approach: the two ranges are split in a number of smaller ranges, and
-  all combinations of subranges are treated in parallel. It is thus
+  The parallelization of the algorithm follows the recursion of the
+  segment tree: the two subtrees of a node, as well as the trees built
+  for the intervals spanning a node, are processed in parallel tasks
+  as long as they contain enough boxes. One of the two tasks then works
+  on a copy of the boxes it shares with the other. It is thus
   recommended to use ranges of pointers to bounding boxes, to keep
   these copies light.
 
   \warning The parallel mode comes with a small overhead due to the
-  duplication and splitting of the input ranges. It is an improvement
-  for almost all inputs, but not all. A configuration where the two ranges
-  are small and entirely disjoint might result in a slightly worse
-  runtime when using the parallel version. Users should benchmark both
-  versions to verify that their data does not fall in this (small)
-  set of inputs.
+  duplication of the ranges of the parallel tasks. Small inputs, which
+  do not reach the size above which tasks are created, are processed
+  sequentially.
 
   \warning When using the parallel mode, the callback function must
   be threadsafe.
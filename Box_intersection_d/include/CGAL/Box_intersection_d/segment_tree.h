@@ -17,7 +17,9 @@
 #include <CGAL/license/Box_intersection_d.h>
 
 #include <CGAL/basic.h>
+#include <CGAL/tags.h>
 #include <CGAL/Box_intersection_d/box_limits.h>
+#include <CGAL/Box_intersection_d/Box_traits_d.h>
 
 #include <boost/random/linear_congruential.hpp>
 #include <boost/random/uniform_int.hpp>
@@ -30,6 +32,12 @@
 #include <cmath>
 #include <climits>
 #include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
 
 namespace CGAL {
 
@@ -83,6 +91,148 @@ void all_pairs( ForwardIter p_begin, ForwardIter p_end,
 }
 
 
+
+// The scans below test one box against runs of consecutive boxes of
+// a sorted range. For the default predicate traits on arithmetic
+// number types, the coordinates of the ranges are first copied into
+// one array per dimension, so that these tests read contiguous memory
+// instead of dereferencing each box (boxes are often given by
+// pointers, as in Polygon_mesh_processing).
+template< class Traits >
+struct Is_predicate_traits_d : public std::false_type {};
+
+template< class BoxTraits, bool closed >
+struct Is_predicate_traits_d< Predicate_traits_d<BoxTraits, closed> >
+  : public std::true_type {};
+
+template< class Traits >
+struct Use_coordinate_arrays
+  : public std::integral_constant<bool,
+      Is_predicate_traits_d<Traits>::value &&
+      std::is_arithmetic<typename Traits::NT>::value> {};
+
+// below this number of boxes, copying the coordinates does not pay off
+static constexpr std::ptrdiff_t coordinate_arrays_cutoff = 32;
+
+template< class NT >
+class Box_coordinate_arrays {
+    std::size_t size;
+    std::vector<NT> lo_coords, hi_coords;
+
+public:
+    template< class RandomAccessIter, class Traits >
+    Box_coordinate_arrays( RandomAccessIter begin, RandomAccessIter end,
+                           Traits, int last_dim )
+        : size( std::distance( begin, end ) ),
+          lo_coords( size * (last_dim + 1) ),
+          hi_coords( size * (last_dim + 1) )
+    {
+        for( std::size_t k = 0; k < size; ++k, ++begin )
+            for( int dim = 0; dim <= last_dim; ++dim ) {
+                lo_coords[dim * size + k] = Traits::min_coord( *begin, dim );
+                hi_coords[dim * size + k] = Traits::max_coord( *begin, dim );
+            }
+    }
+
+    const NT* lo( int dim ) const { return lo_coords.data() + dim * size; }
+    const NT* hi( int dim ) const { return hi_coords.data() + dim * size; }
+
+    // calls `f(k)` for each index `k` from `first` of a box whose low
+    // point in dimension 0 is less than the high point of `b` (the
+    // range being sorted along that dimension), and which intersects
+    // `b` in all dimensions `1..last_dim`
+    template< class Traits, class F >
+    void for_each_candidate( std::size_t first, typename Traits::Box_parameter b,
+                             Traits, int last_dim, const F& f ) const
+    {
+        const NT b_hi = Traits::max_coord( b, 0 );
+        const NT* l0 = lo( 0 );
+        for( std::size_t k = first;
+             k != size && Traits::hi_greater( b_hi, l0[k] ); ++k ) {
+            int dim = 1;
+            while( dim <= last_dim &&
+                   Traits::hi_greater( Traits::max_coord( b, dim ), lo( dim )[k] ) &&
+                   Traits::hi_greater( hi( dim )[k], Traits::min_coord( b, dim ) ) )
+                ++dim;
+            if( dim > last_dim )
+                f( k );
+        }
+    }
+};
+
+template< class RandomAccessIter1, class RandomAccessIter2,
+          class Callback, class Traits >
+void one_way_scan_on_coordinate_arrays(
+    RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
+    RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
+    Callback& callback, Traits traits, int last_dim, bool in_order )
+{
+    typedef typename Traits::NT NT;
+
+    const Box_coordinate_arrays<NT> p_coords( p_begin, p_end, traits, last_dim );
+    const std::size_t p_size = std::distance( p_begin, p_end );
+
+    std::size_t first = 0;
+    for( RandomAccessIter2 i = i_begin; i != i_end; ++i ) {
+        for( ; first != p_size && Traits::is_lo_less_lo( p_begin[first], *i, 0 );
+             ++first ) {}
+
+        p_coords.for_each_candidate( first, *i, traits, last_dim,
+            [&]( std::size_t k ) {
+                if( Traits::id( p_begin[k] ) == Traits::id( *i ) )
+                    return;
+                if( in_order )
+                    callback( p_begin[k], *i );
+                else
+                    callback( *i, p_begin[k] );
+            } );
+    }
+}
+
+template< class RandomAccessIter1, class RandomAccessIter2,
+          class Callback, class Traits >
+void modified_two_way_scan_on_coordinate_arrays(
+    RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
+    RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
+    Callback& callback, Traits traits, int last_dim, bool in_order )
+{
+    typedef typename Traits::NT NT;
+
+    const Box_coordinate_arrays<NT> p_coords( p_begin, p_end, traits, last_dim );
+    const Box_coordinate_arrays<NT> i_coords( i_begin, i_end, traits, last_dim );
+    const std::size_t p_size = std::distance( p_begin, p_end );
+    const std::size_t i_size = std::distance( i_begin, i_end );
+
+    std::size_t p_first = 0, i_first = 0;
+    while( i_first != i_size && p_first != p_size ) {
+        if( Traits::is_lo_less_lo( i_begin[i_first], p_begin[p_first], 0 ) ) {
+            p_coords.for_each_candidate( p_first, i_begin[i_first], traits, last_dim,
+                [&]( std::size_t k ) {
+                    if( Traits::id( p_begin[k] ) == Traits::id( i_begin[i_first] ) ||
+                        !Traits::contains_lo_point( i_begin[i_first], p_begin[k], last_dim ) )
+                        return;
+                    if( in_order )
+                        callback( p_begin[k], i_begin[i_first] );
+                    else
+                        callback( i_begin[i_first], p_begin[k] );
+                } );
+            ++i_first;
+        } else {
+            i_coords.for_each_candidate( i_first, p_begin[p_first], traits, last_dim,
+                [&]( std::size_t k ) {
+                    if( Traits::id( p_begin[p_first] ) == Traits::id( i_begin[k] ) ||
+                        !Traits::contains_lo_point( i_begin[k], p_begin[p_first], last_dim ) )
+                        return;
+                    if( in_order )
+                        callback( p_begin[p_first], i_begin[k] );
+                    else
+                        callback( i_begin[k], p_begin[p_first] );
+                } );
+            ++p_first;
+        }
+    }
+}
+
 template< class RandomAccessIter1, class RandomAccessIter2,
           class Callback, class Traits >
 void one_way_scan( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
@@ -96,6 +246,15 @@ void one_way_scan( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
     std::sort( p_begin, p_end, Compare( 0 ) );
     std::sort( i_begin, i_end, Compare( 0 ) );
 
+    if constexpr( Use_coordinate_arrays<Traits>::value ) {
+        if( std::distance( p_begin, p_end ) >= coordinate_arrays_cutoff ) {
+            one_way_scan_on_coordinate_arrays( p_begin, p_end, i_begin, i_end,
+                                               callback, Traits(), last_dim,
+                                               in_order );
+            return;
+        }
+    }
+
     // for each box viewed as interval i
     for( RandomAccessIter2 i = i_begin; i != i_end; ++i ) {
         // look for the first box b with i.min <= p.min
@@ -136,6 +295,17 @@ void modified_two_way_scan(
     std::sort( p_begin, p_end, Compare( 0 ) );
     std::sort( i_begin, i_end, Compare( 0 ) );
 
+    if constexpr( Use_coordinate_arrays<Traits>::value ) {
+        if( std::distance( p_begin, p_end ) + std::distance( i_begin, i_end )
+            >= coordinate_arrays_cutoff ) {
+            modified_two_way_scan_on_coordinate_arrays( p_begin, p_end,
+                                                        i_begin, i_end,
+                                                        callback, Traits(),
+                                                        last_dim, in_order );
+            return;
+        }
+    }
+
     // for each box viewed as interval
     while( i_begin != i_end && p_begin != p_end ) {
         if( Traits::is_lo_less_lo( *i_begin, *p_begin, 0 ) ) {
@@ -368,7 +538,14 @@ struct Counter {
    ~Counter() { --value; }
 };
 
-template< class RandomAccessIter1, class RandomAccessIter2,
+// With `Parallel_tag`, the two subtrees of a node, as well as the two
+// trees built for the spanning intervals, are processed in parallel as
+// long as they contain at least `parallel_cutoff` boxes. One of the
+// two calls then works on a copy of the boxes it shares with the other.
+static constexpr std::ptrdiff_t parallel_cutoff = 10000;
+
+template< class ConcurrencyTag = Sequential_tag,
+          class RandomAccessIter1, class RandomAccessIter2,
           class Callback, class T, class Predicate_traits >
 void segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
                    RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
@@ -447,10 +624,34 @@ void segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
         CGAL_BOX_INTERSECTION_DUMP( "checking spanning intervals ... "
                                     << std::endl )
         // make two calls for roots of segment tree at next level.
-        segment_tree( p_begin, p_end, i_begin, i_span_end, inf, sup,
-                      callback, traits, cutoff, dim - 1,  in_order );
-        segment_tree( i_begin, i_span_end, p_begin, p_end, inf, sup,
-                      callback, traits, cutoff, dim - 1, !in_order );
+#ifdef CGAL_LINKED_WITH_TBB
+        if( std::is_convertible<ConcurrencyTag, Parallel_tag>::value &&
+            std::distance( p_begin, p_end ) >= cutoff &&
+            std::distance( i_begin, i_span_end ) >= cutoff &&
+            std::distance( p_begin, p_end ) +
+            std::distance( i_begin, i_span_end ) >= parallel_cutoff )
+        {
+            typedef typename std::iterator_traits<RandomAccessIter1>::value_type P;
+            typedef typename std::iterator_traits<RandomAccessIter2>::value_type I;
+            std::vector<P> p_copy( p_begin, p_end );
+            std::vector<I> i_copy( i_begin, i_span_end );
+            tbb::parallel_invoke(
+              [&] { segment_tree<ConcurrencyTag>( p_begin, p_end, i_begin, i_span_end,
+                                                  inf, sup, callback, traits, cutoff,
+                                                  dim - 1, in_order ); },
+              [&] { segment_tree<ConcurrencyTag>( i_copy.begin(), i_copy.end(),
+                                                  p_copy.begin(), p_copy.end(),
+                                                  inf, sup, callback, traits, cutoff,
+                                                  dim - 1, !in_order ); } );
+        }
+        else
+#endif // CGAL_LINKED_WITH_TBB
+        {
+            segment_tree<ConcurrencyTag>( p_begin, p_end, i_begin, i_span_end, inf, sup,
+                                          callback, traits, cutoff, dim - 1,  in_order );
+            segment_tree<ConcurrencyTag>( i_begin, i_span_end, p_begin, p_end, inf, sup,
+                                          callback, traits, cutoff, dim - 1, !in_order );
+        }
     }
 
     T mi;
@@ -469,19 +670,43 @@ void segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
         return;
     }
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if( std::is_convertible<ConcurrencyTag, Parallel_tag>::value &&
+        std::distance( p_begin, p_end ) +
+        std::distance( i_span_end, i_end ) >= parallel_cutoff )
+    {
+        // the right intervals are taken from a copy, so that both
+        // subtrees can reorder their intervals independently
+        typedef typename std::iterator_traits<RandomAccessIter2>::value_type I;
+        std::vector<I> i_right( i_span_end, i_end );
+        typename std::vector<I>::iterator i_right_end =
+            std::partition( i_right.begin(), i_right.end(), Hi_greater( mi, dim ) );
+        RandomAccessIter2 i_left_end =
+            std::partition( i_span_end, i_end, Lo_less( mi, dim ) );
+        tbb::parallel_invoke(
+          [&] { segment_tree<ConcurrencyTag>( p_begin, p_mid, i_span_end, i_left_end,
+                                              lo, mi, callback, traits, cutoff,
+                                              dim, in_order ); },
+          [&] { segment_tree<ConcurrencyTag>( p_mid, p_end, i_right.begin(), i_right_end,
+                                              mi, hi, callback, traits, cutoff,
+                                              dim, in_order ); } );
+        return;
+    }
+#endif // CGAL_LINKED_WITH_TBB
+
     RandomAccessIter2 i_mid;
     // separate left intervals.
     // left intervals have a low point strictly less than mi
     i_mid = std::partition( i_span_end, i_end, Lo_less( mi, dim ) );
     CGAL_BOX_INTERSECTION_DUMP("->left" << std::endl )
-    segment_tree( p_begin, p_mid, i_span_end, i_mid, lo, mi,
-                  callback, traits, cutoff, dim, in_order );
+    segment_tree<ConcurrencyTag>( p_begin, p_mid, i_span_end, i_mid, lo, mi,
+                                  callback, traits, cutoff, dim, in_order );
     // separate right intervals.
     // right intervals have a high point strictly higher than mi
     i_mid = std::partition( i_span_end, i_end, Hi_greater( mi, dim ) );
     CGAL_BOX_INTERSECTION_DUMP("->right"<< std::endl )
-    segment_tree( p_mid, p_end, i_span_end, i_mid, mi, hi,
-                  callback, traits, cutoff, dim, in_order );
+    segment_tree<ConcurrencyTag>( p_mid, p_end, i_span_end, i_mid, mi, hi,
+                                  callback, traits, cutoff, dim, in_order );
 }
 
 #if CGAL_BOX_INTERSECTION_DEBUG
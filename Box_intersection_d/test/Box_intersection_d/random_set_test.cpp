@@ -20,6 +20,10 @@
 #include <iostream>
 #include <iterator>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <atomic>
+#endif
+
 #include "util.h"
 
 static unsigned int failed = 0;
@@ -92,6 +96,31 @@ test_n( unsigned int n,
     std::cout << "got " << callback2.get_counter() << " intersections in "
               << timer.time() << " seconds." << std::endl;
 
+#ifdef CGAL_LINKED_WITH_TBB
+    std::cout << "parallel segment tree ... " << std::flush;
+    timer.reset();
+    timer.start();
+    std::atomic<unsigned int> c3(0);
+    CGAL::box_intersection_custom_predicates_d<CGAL::Parallel_tag>(
+                                      boxes1.begin(), boxes1.end(),
+                                      boxes2.begin(), boxes2.end(),
+                                      [&c3]( const typename Uti1::Box& a,
+                                             const typename Uti1::Box& b )
+                                      {
+                                        Uti1::assert_intersection( a, b );
+                                        ++c3;
+                                      },
+                                      typename Uti1::Traits(), cutoff, setting );
+    timer.stop();
+    std::cout << "got " << c3 << " intersections in "
+              << timer.time() << " seconds." << std::endl;
+    if( c3 != callback2.get_counter() )
+    {
+        ++failed;
+        std::cout << "!! failed !! " << std::endl;
+    }
+#endif
+
     if( callback1.get_counter() != callback2.get_counter() ||
         ( n < allpairs_max && callback0.get_counter() != callback1.get_counter() ) )
     {
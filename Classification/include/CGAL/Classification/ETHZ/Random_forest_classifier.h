@@ -35,7 +35,11 @@
 
 #include <CGAL/Classification/ETHZ/internal/random-forest/node-gini.hpp>
 #include <CGAL/Classification/ETHZ/internal/random-forest/forest.hpp>
+#include <CGAL/Classification/ETHZ/internal/Flat_forest.h>
 
+#include <CGAL/Classification/classify.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
 #include <CGAL/tags.h>
 
 #if defined(CGAL_LINKED_WITH_BOOST_IOSTREAMS) && defined(CGAL_LINKED_WITH_BOOST_SERIALIZATION)
@@ -71,9 +75,12 @@ class Random_forest_classifier
   < CGAL::internal::liblearning::RandomForest::NodeGini
     < CGAL::internal::liblearning::RandomForest::AxisAlignedSplitter> > Forest;
 
+  using Flat_forest = internal::Flat_forest;
+
   const Label_set& m_labels;
   const Feature_set& m_features;
   std::shared_ptr<Forest> m_rfc;
+  std::shared_ptr<Flat_forest> m_flat;
 
 public:
 
@@ -212,6 +219,13 @@ public:
     if (m_rfc && reset_trees)
       m_rfc.reset();
 
+    if (!m_rfc && !reset_trees && m_flat)
+    {
+      // configuration loaded in compact format: trees are added to it
+      m_rfc = std::make_shared<Forest> (params);
+      m_flat->unflatten (*m_rfc);
+    }
+
     if (!m_rfc)
       m_rfc = std::make_shared<Forest> (params);
 
@@ -219,6 +233,8 @@ public:
 
     m_rfc->train<ConcurrencyTag>
       (feature_vector, label_vector, CGAL::internal::liblearning::DataView2D<int>(), generator, 0, reset_trees, m_labels.size());
+
+    m_flat = std::make_shared<Flat_forest> (*m_rfc);
   }
 
   /// \cond SKIP_IN_MANUAL
@@ -231,16 +247,78 @@ public:
     for (std::size_t f = 0; f < m_features.size(); ++ f)
       ft.push_back (m_features[f]->value(item_index));
 
-    std::vector<float> prob (m_labels.size());
-
-    m_rfc->evaluate (ft.data(), prob.data());
+    m_flat->evaluate (ft.data(), out.data());
 
     for (std::size_t i = 0; i < out.size(); ++ i)
-      out[i] = (std::min) (1.f, (std::max) (0.f, prob[i]));
+      out[i] = (std::min) (1.f, (std::max) (0.f, out[i]));
   }
 
   /// \endcond
 
+  /*!
+    \brief computes the probabilities of all labels for a range of
+    items.
+
+    Items are processed by blocks: the values of all features are
+    first gathered for a block of items, then each tree of the forest
+    is traversed for all items of the block. This gives the same
+    result as evaluating the items one by one, but is significantly
+    faster on large data sets.
+
+    \tparam ConcurrencyTag enables sequential versus parallel
+    algorithm. Possible values are `Parallel_if_available_tag`,
+    `Parallel_tag` or `Sequential_tag`.
+
+    \param first index of the first item to evaluate.
+    \param nb_items number of items to evaluate.
+    \param out where the probabilities are stored. After running the
+    method, its size is `nb_items` times the number of labels and the
+    probability of item `first + i` for label `k` is stored at
+    position `i * labels.size() + k`.
+  */
+  template <typename ConcurrencyTag>
+  void evaluate (std::size_t first, std::size_t nb_items, std::vector<float>& out) const
+  {
+    const std::size_t nb_labels = m_labels.size();
+    out.resize (nb_items * nb_labels);
+
+    std::size_t nb_blocks = (nb_items + block_size - 1) / block_size;
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (0, nb_blocks),
+       [&](const std::size_t& b) -> bool
+       {
+         std::size_t begin = b * block_size;
+         std::vector<float> ft;
+         evaluate_block (first + begin, (std::min) (block_size, nb_items - begin),
+                         ft, out.data() + begin * nb_labels);
+         return true;
+       });
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  static constexpr std::size_t block_size = 256;
+
+  // Evaluates at most `block_size` items, `ft` is used as a buffer
+  void evaluate_block (std::size_t first, std::size_t size,
+                       std::vector<float>& ft, float* out) const
+  {
+    const std::size_t nb_features = m_features.size();
+
+    // Features are read one after the other (each one usually
+    // stores its values contiguously) into a row major matrix
+    ft.resize (size * nb_features);
+    for (std::size_t f = 0; f < nb_features; ++ f)
+      for (std::size_t i = 0; i < size; ++ i)
+        ft[i * nb_features + f] = m_features[f]->value(first + i);
+
+    m_flat->evaluate (ft.data(), size, nb_features, out);
+
+    for (std::size_t i = 0; i < size * m_labels.size(); ++ i)
+      out[i] = (std::min) (1.f, (std::max) (0.f, out[i]));
+  }
+  /// \endcond
+
   /// @}
 
   /// \name Miscellaneous
@@ -273,7 +351,7 @@ public:
   {
     count.clear();
     count.resize(m_features.size(), 0);
-    return m_rfc->get_feature_usage(count);
+    return m_flat->get_feature_usage(count);
   }
 
   /// @}
@@ -292,7 +370,14 @@ public:
   */
   void save_configuration (std::ostream& output) const
   {
-    m_rfc->write(output);
+    if (m_rfc)
+      m_rfc->write(output);
+    else
+    {
+      Forest forest;
+      m_flat->unflatten (forest);
+      forest.write(output);
+    }
   }
 
   /*!
@@ -316,6 +401,46 @@ public:
     m_rfc = std::make_shared<Forest> (params);
 
     m_rfc->read(input);
+    m_flat = std::make_shared<Flat_forest> (*m_rfc);
+  }
+
+  /*!
+    \brief saves the current configuration in the stream `output` in
+    a compact binary format.
+
+    In this format, the trees are stored as flat arrays of nodes that
+    are read back as is by `load_compact_configuration()`, which is
+    much faster than `load_configuration()` for large forests. It
+    is meant to deploy an already trained classifier.
+
+    \note The compact format stores the forest in the native byte
+    order of the machine and is therefore not portable across
+    architectures of different endianness.
+  */
+  void save_compact_configuration (std::ostream& output) const
+  {
+    m_flat->write(output);
+  }
+
+  /*!
+    \brief loads a configuration from the stream `input` written by
+    `save_compact_configuration()`.
+
+    The same requirements on the feature set as for
+    `load_configuration()` apply.
+
+    \return `true` if the configuration was loaded successfully.
+  */
+  bool load_compact_configuration (std::istream& input)
+  {
+    m_rfc.reset();
+    m_flat = std::make_shared<Flat_forest>();
+    if (!m_flat->read(input))
+    {
+      m_flat.reset();
+      return false;
+    }
+    return true;
   }
 
   /// @}
@@ -363,6 +488,7 @@ public:
     ins.push(input);
     boost::archive::text_iarchive ias(ins);
     ias >> BOOST_SERIALIZATION_NVP(*m_rfc);
+    m_flat = std::make_shared<Flat_forest> (*m_rfc);
   }
 #endif
   /// \endcond
@@ -373,6 +499,49 @@ public:
 }
 
 /// \cond SKIP_IN_MANUAL
+// Overload of the generic function that evaluates the forest by
+// blocks of items instead of item by item
+template <typename ConcurrencyTag,
+          typename ItemRange,
+          typename LabelIndexRange>
+void classify (const ItemRange& input,
+               const Label_set& labels,
+               const ETHZ::Random_forest_classifier& classifier,
+               LabelIndexRange& output)
+{
+  const std::size_t block_size = ETHZ::Random_forest_classifier::block_size;
+  std::size_t nb_blocks = (input.size() + block_size - 1) / block_size;
+
+  CGAL::for_each<ConcurrencyTag>
+    (CGAL::make_counting_range<std::size_t> (0, nb_blocks),
+     [&](const std::size_t& b) -> bool
+     {
+       std::size_t first = b * block_size;
+       std::size_t size = (std::min) (block_size, input.size() - first);
+
+       std::vector<float> ft;
+       std::vector<float> values (size * labels.size());
+       classifier.evaluate_block (first, size, ft, values.data());
+
+       for (std::size_t s = 0; s < size; ++ s)
+       {
+         std::size_t nb_class_best=0;
+         float val_class_best = 0.f;
+         for(std::size_t k = 0; k < labels.size(); ++ k)
+         {
+           if(val_class_best < values[s * labels.size() + k])
+           {
+             val_class_best = values[s * labels.size() + k];
+             nb_class_best = k;
+           }
+         }
+         output[first + s] = static_cast<typename LabelIndexRange::iterator::value_type>(nb_class_best);
+       }
+
+       return true;
+     });
+}
+
 // Backward compatibility
 typedef ETHZ::Random_forest_classifier ETHZ_random_forest_classifier;
 /// \endcond
@@ -0,0 +1,272 @@
+// Copyright (c) 2024 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_CLASSIFICATION_ETHZ_INTERNAL_FLAT_FOREST_H
+#define CGAL_CLASSIFICATION_ETHZ_INTERNAL_FLAT_FOREST_H
+
+#include <CGAL/license/Classification.h>
+
+#include <CGAL/Classification/ETHZ/internal/random-forest/node-gini.hpp>
+#include <CGAL/Classification/ETHZ/internal/random-forest/forest.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace CGAL {
+namespace Classification {
+namespace ETHZ {
+namespace internal {
+
+/*
+  Read-only representation of a trained random forest where all nodes
+  of all trees are stored in one contiguous array (12 bytes per node)
+  and all leaf distributions in another one. Siblings are stored next
+  to each other, so that a traversal only reads one node per level
+  and never follows a pointer.
+
+  The forest can be written to and read from a binary stream as raw
+  arrays, which avoids rebuilding the node hierarchy when loading.
+*/
+class Flat_forest
+{
+public:
+
+  using Params = CGAL::internal::liblearning::RandomForest::ForestParams;
+  using Forest = CGAL::internal::liblearning::RandomForest::RandomForest
+    < CGAL::internal::liblearning::RandomForest::NodeGini
+      < CGAL::internal::liblearning::RandomForest::AxisAlignedSplitter> >;
+
+private:
+
+  using Node_type = typename Forest::TreeType::NodeType;
+
+  struct Node
+  {
+    // index of feature, or -1 if the node is a leaf
+    std::int32_t feature;
+    float threshold;
+    // index of the left child (right child is next to it), or index
+    // of the first vote if the node is a leaf
+    std::uint32_t child;
+  };
+
+  static_assert (sizeof(Node) == 12, "Flat_forest::Node should not be padded");
+
+  Params m_params;
+  std::vector<Node> m_nodes;
+  std::vector<std::uint32_t> m_roots;
+  std::vector<float> m_votes;
+
+  static const char* magic() { return "CGAL_ETHZ_FLAT_FOREST"; }
+  static std::uint32_t version() { return 1; }
+
+public:
+
+  Flat_forest () { }
+
+  Flat_forest (const Forest& forest)
+    : m_params (forest.params)
+  {
+    m_roots.reserve (forest.trees.size());
+    std::vector<const Node_type*> todo;
+    for (std::size_t i = 0; i < forest.trees.size(); ++ i)
+    {
+      m_roots.push_back (std::uint32_t(m_nodes.size()));
+      m_nodes.emplace_back();
+      todo.clear();
+      todo.push_back (forest.trees[i].root_node.get());
+
+      // Breadth-first so that both children of a node are consecutive
+      std::size_t current = m_roots.back();
+      for (std::size_t t = 0; t < todo.size(); ++ t, ++ current)
+      {
+        const Node_type* node = todo[t];
+        Node& flat = m_nodes[current];
+
+        // A node that could not find any valid split is kept as a leaf
+        if (node->is_leaf || node->splitter.feature == -1)
+        {
+          flat.feature = -1;
+          flat.threshold = 0.f;
+          flat.child = std::uint32_t(m_votes.size());
+          m_votes.insert (m_votes.end(), node->node_dist.begin(), node->node_dist.end());
+          m_votes.resize (flat.child + m_params.n_classes, 0.f);
+        }
+        else
+        {
+          flat.feature = std::int32_t(node->splitter.feature);
+          flat.threshold = node->splitter.threshold;
+          flat.child = std::uint32_t(m_nodes.size());
+          m_nodes.emplace_back();
+          m_nodes.emplace_back();
+          todo.push_back (node->left.get());
+          todo.push_back (node->right.get());
+        }
+      }
+    }
+  }
+
+  bool empty() const { return m_roots.empty(); }
+  std::size_t number_of_trees() const { return m_roots.size(); }
+  std::size_t number_of_classes() const { return m_params.n_classes; }
+  std::size_t number_of_nodes() const { return m_nodes.size(); }
+  const Params& params() const { return m_params; }
+
+  // Returns the distribution of the leaf reached by `sample` in tree `tree`
+  const float* leaf (std::size_t tree, const float* sample) const
+  {
+    const Node* node = &m_nodes[m_roots[tree]];
+    while (node->feature != -1)
+      node = &m_nodes[node->child + (sample[node->feature] > node->threshold ? 1 : 0)];
+    return &m_votes[node->child];
+  }
+
+  // Same output as `Forest::evaluate()`
+  void evaluate (const float* sample, float* results) const
+  {
+    std::fill_n (results, m_params.n_classes, 0.f);
+    for (std::size_t t = 0; t < m_roots.size(); ++ t)
+    {
+      const float* votes = leaf (t, sample);
+      for (std::size_t c = 0; c < m_params.n_classes; ++ c)
+        results[c] += votes[c];
+    }
+    normalize (results, 1);
+  }
+
+  // Evaluates `nb_samples` samples of `nb_features` values stored
+  // contiguously (row major) in `samples`. Trees are traversed one
+  // after the other for all the samples so that the nodes of the
+  // current tree stay in cache.
+  void evaluate (const float* samples, std::size_t nb_samples, std::size_t nb_features,
+                 float* results) const
+  {
+    std::size_t nb_classes = m_params.n_classes;
+    std::fill_n (results, nb_samples * nb_classes, 0.f);
+
+    for (std::size_t t = 0; t < m_roots.size(); ++ t)
+      for (std::size_t s = 0; s < nb_samples; ++ s)
+      {
+        const float* votes = leaf (t, samples + s * nb_features);
+        float* res = results + s * nb_classes;
+        for (std::size_t c = 0; c < nb_classes; ++ c)
+          res[c] += votes[c];
+      }
+
+    normalize (results, nb_samples);
+  }
+
+  void get_feature_usage (std::vector<std::size_t>& count) const
+  {
+    for (const Node& node : m_nodes)
+      if (node.feature != -1)
+        count[std::size_t(node.feature)] ++;
+  }
+
+  // Rebuilds the pointer-based forest (needed to train additional
+  // trees or to write the standard format)
+  void unflatten (Forest& forest) const
+  {
+    forest.params = m_params;
+    forest.trees.clear();
+    for (std::size_t i = 0; i < m_roots.size(); ++ i)
+    {
+      forest.trees.push_back (new typename Forest::TreeType(&forest.params));
+      forest.trees.back().root_node.reset (new Node_type (0, &forest.params));
+      unflatten (m_roots[i], *forest.trees.back().root_node, forest.params);
+    }
+  }
+
+  void write (std::ostream& os) const
+  {
+    os.write (magic(), std::strlen(magic()));
+    I_Binary_write_uinteger32 (os, version());
+    Params params = m_params;
+    params.write (os);
+    I_Binary_write_size_t_into_uinteger32 (os, m_roots.size());
+    I_Binary_write_size_t_into_uinteger32 (os, m_nodes.size());
+    I_Binary_write_size_t_into_uinteger32 (os, m_votes.size());
+    os.write (reinterpret_cast<const char*>(m_roots.data()), m_roots.size() * sizeof(std::uint32_t));
+    os.write (reinterpret_cast<const char*>(m_nodes.data()), m_nodes.size() * sizeof(Node));
+    os.write (reinterpret_cast<const char*>(m_votes.data()), m_votes.size() * sizeof(float));
+  }
+
+  bool read (std::istream& is)
+  {
+    std::string m (std::strlen(magic()), ' ');
+    is.read (&m[0], m.size());
+    if (!is || m != magic())
+      return false;
+
+    std::uint32_t v;
+    I_Binary_read_uinteger32 (is, v);
+    if (v != version())
+      return false;
+
+    m_params.read (is);
+
+    std::size_t nb_trees, nb_nodes, nb_votes;
+    I_Binary_read_size_t_from_uinteger32 (is, nb_trees);
+    I_Binary_read_size_t_from_uinteger32 (is, nb_nodes);
+    I_Binary_read_size_t_from_uinteger32 (is, nb_votes);
+    if (!is)
+      return false;
+
+    m_roots.resize (nb_trees);
+    m_nodes.resize (nb_nodes);
+    m_votes.resize (nb_votes);
+    is.read (reinterpret_cast<char*>(m_roots.data()), nb_trees * sizeof(std::uint32_t));
+    is.read (reinterpret_cast<char*>(m_nodes.data()), nb_nodes * sizeof(Node));
+    is.read (reinterpret_cast<char*>(m_votes.data()), nb_votes * sizeof(float));
+
+    return bool(is);
+  }
+
+private:
+
+  void normalize (float* results, std::size_t nb_samples) const
+  {
+    float scale = 1.0 / m_roots.size();
+    for (std::size_t i = 0; i < nb_samples * m_params.n_classes; ++ i)
+      results[i] *= scale;
+  }
+
+  void unflatten (std::size_t index, Node_type& node, const Params& params) const
+  {
+    const Node& flat = m_nodes[index];
+    node.node_dist.resize (params.n_classes, 0.f);
+    if (flat.feature == -1)
+    {
+      node.is_leaf = true;
+      node.splitter.threshold = 0.f;
+      std::copy_n (m_votes.begin() + flat.child, params.n_classes, node.node_dist.begin());
+      return;
+    }
+
+    node.is_leaf = false;
+    node.splitter.feature = flat.feature;
+    node.splitter.threshold = flat.threshold;
+    node.left.reset (new Node_type (int(node.depth + 1), &params));
+    node.right.reset (new Node_type (int(node.depth + 1), &params));
+    unflatten (flat.child, *node.left, params);
+    unflatten (flat.child + 1, *node.right, params);
+  }
+};
+
+} // namespace internal
+} // namespace ETHZ
+} // namespace Classification
+} // namespace CGAL
+
+#endif // CGAL_CLASSIFICATION_ETHZ_INTERNAL_FLAT_FOREST_H
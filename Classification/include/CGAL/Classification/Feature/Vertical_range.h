@@ -18,8 +18,6 @@
 #include <vector>
 
 #include <CGAL/Classification/Feature_base.h>
-#include <CGAL/Classification/compressed_float.h>
-#include <CGAL/Classification/Image.h>
 #include <CGAL/Classification/Planimetric_grid.h>
 
 namespace CGAL {
@@ -49,14 +47,11 @@ namespace Feature {
 template <typename GeomTraits, typename PointRange, typename PointMap>
 class Vertical_range : public Feature_base
 {
-  using Image_float = Image<float>;
   using Grid = Planimetric_grid<GeomTraits, PointRange, PointMap>;
 
   const PointRange& input;
   PointMap point_map;
   const Grid& grid;
-  Image_float dtm;
-  std::vector<float> values;
 
 public:
   /*!
@@ -72,52 +67,14 @@ public:
     : input(input), point_map(point_map), grid(grid)
   {
     this->set_name ("vertical_range");
-
-    dtm = Image_float(grid.width(),grid.height());
-
-    for (std::size_t j = 0; j < grid.height(); ++ j)
-      for (std::size_t i = 0; i < grid.width(); ++ i)
-        if (grid.has_points(i,j))
-        {
-          float z_max = -(std::numeric_limits<float>::max)();
-          float z_min = (std::numeric_limits<float>::max)();
-
-          typename Grid::iterator end = grid.indices_end(i,j);
-          for (typename Grid::iterator it = grid.indices_begin(i,j); it != end; ++ it)
-          {
-            float z = float(get(point_map, *(input.begin()+(*it))).z());
-            z_max = ((std::max)(z_max, z));
-            z_min = ((std::min)(z_min, z));
-          }
-
-          dtm(i,j) = z_max - z_min;
-        }
-
-    if (grid.width() * grid.height() > input.size())
-    {
-      values.resize (input.size(), 0.f);
-      for (std::size_t i = 0; i < input.size(); ++ i)
-      {
-        std::size_t I = grid.x(i);
-        std::size_t J = grid.y(i);
-        values[i] = dtm(I,J);
-      }
-      dtm.free();
-    }
-
   }
 
   /// \cond SKIP_IN_MANUAL
   virtual float value (std::size_t pt_index)
   {
-    if (values.empty())
-    {
-      std::size_t I = grid.x(pt_index);
-      std::size_t J = grid.y(pt_index);
-      return dtm(I,J);
-    }
-
-    return values[pt_index];
+    std::size_t I = grid.x(pt_index);
+    std::size_t J = grid.y(pt_index);
+    return grid.z_max(I,J) - grid.z_min(I,J);
   }
 
   /// \endcond
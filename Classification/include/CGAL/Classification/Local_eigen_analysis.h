@@ -86,26 +86,33 @@ private:
 
     void operator()(const tbb::blocked_range<std::size_t>& r) const
     {
+      // Buffers are reused for all points of the range and the mean
+      // range is accumulated locally, so that the mutex is only
+      // locked once per range instead of once per point
       std::vector<std::size_t> neighbors;
+      std::vector<typename PointMap::value_type> neighbor_points;
+      float mean_range = 0.f;
+
       for (std::size_t i = r.begin(); i != r.end(); ++ i)
       {
         neighbors.clear();
         m_neighbor_query (get(m_point_map, *(m_input.begin()+i)), std::back_inserter (neighbors));
 
-        std::vector<typename PointMap::value_type> neighbor_points;
+        neighbor_points.clear();
         neighbor_points.reserve(neighbors.size());
         for (std::size_t j = 0; j < neighbors.size(); ++ j)
           neighbor_points.push_back (get(m_point_map, *(m_input.begin()+neighbors[j])));
 
-        m_mutex.lock();
-        m_mean_range += float(CGAL::sqrt
-                              (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
-                                                       get(m_point_map, *(m_input.begin() + neighbors.back())))));
-        m_mutex.unlock();
+        mean_range += float(CGAL::sqrt
+                            (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
+                                                     get(m_point_map, *(m_input.begin() + neighbors.back())))));
 
         m_eigen.compute<typename PointMap::value_type,
                         DiagonalizeTraits> (i, get(m_point_map, *(m_input.begin()+i)), neighbor_points);
       }
+
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_mean_range += mean_range;
     }
 
   };
@@ -137,19 +144,23 @@ private:
     void operator()(const tbb::blocked_range<std::size_t>& r) const
     {
       face_iterator begin = faces(m_input).first;
+      std::vector<face_index> neighbors;
+      float mean_range = 0.f;
+
       for (std::size_t i = r.begin(); i != r.end(); ++ i)
       {
         face_descriptor fd = *(begin + i);
-        std::vector<face_index> neighbors;
+        neighbors.clear();
         m_neighbor_query (fd, std::back_inserter (neighbors));
 
-        m_mutex.lock();
-        m_mean_range += m_eigen.face_radius(fd, m_input);
-        m_mutex.unlock();
+        mean_range += m_eigen.face_radius(fd, m_input);
 
         m_eigen.compute_triangles<FaceListGraph, DiagonalizeTraits>
           (m_input, fd, neighbors);
       }
+
+      std::lock_guard<std::mutex> lock (m_mutex);
+      m_mean_range += mean_range;
     }
 
   };
@@ -278,12 +289,14 @@ public:
     else
 #endif
     {
+      std::vector<std::size_t> neighbors;
+      std::vector<typename PointMap::value_type> neighbor_points;
       for (std::size_t i = 0; i < input.size(); i++)
       {
-        std::vector<std::size_t> neighbors;
+        neighbors.clear();
         neighbor_query (get(point_map, *(input.begin()+i)), std::back_inserter (neighbors));
 
-        std::vector<typename PointMap::value_type> neighbor_points;
+        neighbor_points.clear();
         for (std::size_t j = 0; j < neighbors.size(); ++ j)
           neighbor_points.push_back (get(point_map, *(input.begin()+neighbors[j])));
 
@@ -367,9 +380,10 @@ public:
     else
 #endif
     {
+      std::vector<face_index> neighbors;
       for(face_descriptor fd : range)
       {
-        std::vector<face_index> neighbors;
+        neighbors.clear();
         neighbor_query (fd, std::back_inserter (neighbors));
 
         out.m_content->mean_range += out.face_radius(fd, input);
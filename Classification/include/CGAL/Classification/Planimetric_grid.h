@@ -16,6 +16,8 @@
 #include <CGAL/license/Classification.h>
 
 #include <vector>
+#include <limits>
+#include <algorithm>
 
 #include <CGAL/Classification/Image.h>
 
@@ -57,6 +59,7 @@ public:
 private:
   using Image_indices = Image<std::vector<std::uint32_t> >;
   using Image_bool = Image<bool>;
+  using Image_float = Image<float>;
 
   const PointRange* m_points;
   PointMap m_point_map;
@@ -71,6 +74,11 @@ private:
   std::size_t m_height;
   std::vector<bool> m_has_points;
 
+  // Height range of each cell, computed once while building the grid
+  // so that height-based features do not have to iterate over points
+  Image_float m_z_min;
+  Image_float m_z_max;
+
 public:
 
 #ifdef DOXYGEN_RUNNING
@@ -212,13 +220,28 @@ public:
     m_height = (std::size_t)((bbox.ymax() - bbox.ymin()) / grid_resolution) + 1;
 
     m_grid = Image_indices (m_width, m_height);
+    m_z_min = Image_float (m_width, m_height);
+    m_z_max = Image_float (m_width, m_height);
 
     for (std::size_t i = 0; i < input.size(); ++ i)
     {
       const Point_3& p = get(point_map, *(input.begin()+i));
       std::size_t x = (std::uint32_t)((p.x() - bbox.xmin()) / grid_resolution);
       std::size_t y = (std::uint32_t)((p.y() - bbox.ymin()) / grid_resolution);
-      m_grid(x,y).push_back (std::uint32_t(i));
+      float z = float(p.z());
+
+      std::vector<std::uint32_t>& cell = m_grid(x,y);
+      if (cell.empty())
+      {
+        m_z_min(x,y) = z;
+        m_z_max(x,y) = z;
+      }
+      else
+      {
+        m_z_min(x,y) = (std::min)(m_z_min(x,y), z);
+        m_z_max(x,y) = (std::max)(m_z_max(x,y), z);
+      }
+      cell.push_back (std::uint32_t(i));
     }
   }
 
@@ -231,12 +254,19 @@ public:
     m_width = (m_lower_scale->width() + 1) / 2;
     m_height = (m_lower_scale->height() + 1) / 2;
 
+    m_z_min = Image_float (m_width, m_height);
+    m_z_max = Image_float (m_width, m_height);
+
     m_has_points.reserve(m_width * m_height);
     for (std::size_t x = 0; x < m_width; ++ x)
       for (std::size_t y = 0; y < m_height; ++ y)
       {
         bool has_points = false;
+        float z_min = (std::numeric_limits<float>::max)();
+        float z_max = -(std::numeric_limits<float>::max)();
 
+        // Height ranges are aggregated from the 4 cells of the lower
+        // scale instead of iterating again over all points
         for (std::size_t i = 0; i <= 1; ++ i)
         {
           std::size_t xi = x*2 + i;
@@ -252,14 +282,18 @@ public:
             if (m_lower_scale->has_points(xi,yi))
             {
               has_points = true;
-              break;
+              z_min = (std::min)(z_min, m_lower_scale->z_min(xi,yi));
+              z_max = (std::max)(z_max, m_lower_scale->z_max(xi,yi));
             }
           }
-          if (has_points)
-            break;
         }
 
         m_has_points.push_back (has_points);
+        if (has_points)
+        {
+          m_z_min(x,y) = z_min;
+          m_z_max(x,y) = z_max;
+        }
       }
   }
   /// \endcond
@@ -335,6 +369,30 @@ public:
     return m_has_points[x * m_height + y];
   }
 
+  /*!
+    \brief returns the minimum height of the points lying in the cell
+    at position `(x,y)`.
+
+    \pre `has_points(x,y)`
+  */
+  float z_min(std::size_t x, std::size_t y) const
+  {
+    CGAL_assertion (has_points(x,y));
+    return m_z_min(x,y);
+  }
+
+  /*!
+    \brief returns the maximum height of the points lying in the cell
+    at position `(x,y)`.
+
+    \pre `has_points(x,y)`
+  */
+  float z_max(std::size_t x, std::size_t y) const
+  {
+    CGAL_assertion (has_points(x,y));
+    return m_z_max(x,y);
+  }
+
   /*!
     \brief returns the `x` grid coordinate of the point at position `index`.
   */
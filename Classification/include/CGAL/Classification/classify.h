@@ -22,6 +22,8 @@
 #include <CGAL/property_map.h>
 #include <CGAL/iterator.h>
 
+#include <algorithm>
+
 #ifdef CGAL_LINKED_WITH_TBB
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
@@ -317,40 +319,68 @@ namespace Classification {
     std::vector<std::vector<std::size_t> > indices (nb);
     std::vector<std::pair<std::size_t, std::size_t> > input_to_indices(input.size());
 
+    // Returns the first of the `nb_div` consecutive intervals of
+    // `[vmin;vmax]` that overlaps an item whose minimum is `bmin`. The
+    // guess computed from the coordinates is corrected using the exact
+    // same bounds as the subdivisions so that the result is the one a
+    // linear search through the subdivisions would give.
+    auto first_overlapping_interval
+      = [](double bmin, double vmin, double vmax, double D, std::size_t nb_div) -> std::size_t
+        {
+          auto upper = [&](std::size_t i) -> double
+                       { return (i == nb_div - 1 ? vmax : vmin + D * ((i+1) / double(nb_div))); };
+
+          std::size_t i = 0;
+          if (D > 0 && bmin > vmin)
+            i = (std::min)(nb_div - 1, std::size_t(nb_div * ((bmin - vmin) / D)));
+          while (i > 0 && upper(i-1) >= bmin)
+            -- i;
+          while (i < nb_div - 1 && upper(i) < bmin)
+            ++ i;
+          return i;
+        };
+
     for (std::size_t s = 0; s < input.size(); ++ s)
     {
       CGAL::Bbox_3 b = get(item_map, *(input.begin() + s)).bbox();
 
-      std::size_t i = 0;
-      for (; i < bboxes.size(); ++ i)
-        if (CGAL::do_overlap (b, bboxes[i]))
-        {
-          input_to_indices[s] = std::make_pair (i, indices[i].size());
-          indices[i].push_back (s);
-          break;
-        }
-      CGAL_assertion_msg (i != bboxes.size(), "Point was not assigned to any subdivision.");
+      std::size_t x = first_overlapping_interval (b.xmin(), bbox.xmin(), bbox.xmax(), Dx, nb_x);
+      std::size_t y = first_overlapping_interval (b.ymin(), bbox.ymin(), bbox.ymax(), Dy, nb_y);
+      std::size_t i = x * nb_y + y;
+      CGAL_assertion_msg (CGAL::do_overlap (b, bboxes[i]), "Point was not assigned to any subdivision.");
+
+      input_to_indices[s] = std::make_pair (i, indices[i].size());
+      indices[i].push_back (s);
     }
 
+    // Largest subdivisions are processed first so that the parallel
+    // scheduler is not left waiting for a large one at the end
+    std::vector<std::size_t> order;
+    order.reserve (indices.size());
+    for (std::size_t sub = 0; sub < indices.size(); ++ sub)
+      if (!indices[sub].empty())
+        order.push_back (sub);
+    std::stable_sort (order.begin(), order.end(),
+                      [&](const std::size_t& a, const std::size_t& b) -> bool
+                      { return indices[a].size() > indices[b].size(); });
+
     CGAL::for_each<ConcurrencyTag>
-      (CGAL::make_counting_range<std::size_t> (0, indices.size()),
+      (order,
        [&](const std::size_t& sub) -> bool
        {
-         if (indices[sub].empty())
-           return true;
-
          std::vector<std::pair<std::size_t, std::size_t> > edges;
          std::vector<double> edge_weights;
          std::vector<std::vector<double> > probability_matrix
            (labels.size(), std::vector<double>(indices[sub].size(), 0.));
          std::vector<std::size_t> assigned_label (indices[sub].size());
 
+         std::vector<std::size_t> neighbors;
+         std::vector<float> values;
          for (std::size_t j = 0; j < indices[sub].size(); ++ j)
          {
            std::size_t s = indices[sub][j];
 
-           std::vector<std::size_t> neighbors;
-
+           neighbors.clear();
            neighbor_query (get(item_map, *(input.begin()+s)), std::back_inserter (neighbors));
 
            for (std::size_t i = 0; i < neighbors.size(); ++ i)
@@ -361,7 +391,8 @@ namespace Classification {
                edge_weights.push_back (strength);
              }
 
-           std::vector<float> values;
+           // some classifiers accumulate votes in `values`
+           values.assign(labels.size(), 0.f);
            classifier(s, values);
            std::size_t nb_class_best = 0;
            float val_class_best = 0.f;
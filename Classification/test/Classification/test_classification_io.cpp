@@ -89,16 +89,45 @@ int main (int, char**)
 
   Classifier classifier3 (classifier, features);
 
+  std::ofstream outcf ("output_config.bin", std::ios::binary);
+  classifier.save_compact_configuration(outcf);
+  outcf.close();
+
+  Classifier classifier4 (labels, features);
+  std::ifstream incf ("output_config.bin", std::ios::binary);
+  bool loaded = classifier4.load_compact_configuration(incf);
+  assert (loaded);
+
   std::vector<std::size_t> label_indices (points.size());
   std::vector<std::size_t> label_indices_2 (points.size());
   std::vector<std::size_t> label_indices_3 (points.size());
+  std::vector<std::size_t> label_indices_4 (points.size());
 
   Classification::classify<CGAL::Sequential_tag> (points, labels, classifier, label_indices);
   Classification::classify<CGAL::Sequential_tag> (points, labels, classifier2, label_indices_2);
   Classification::classify<CGAL::Sequential_tag> (points, labels, classifier3, label_indices_3);
+  Classification::classify<CGAL::Sequential_tag> (points, labels, classifier4, label_indices_4);
 
   assert (label_indices == label_indices_2);
   assert (label_indices == label_indices_3);
+  assert (label_indices == label_indices_4);
+
+  // Evaluation by blocks must match item by item evaluation
+  std::vector<float> probabilities;
+  classifier4.evaluate<CGAL::Parallel_if_available_tag> (0, points.size(), probabilities);
+  assert (probabilities.size() == points.size() * labels.size());
+  for (std::size_t i = 0; i < points.size(); ++ i)
+  {
+    std::vector<float> values;
+    classifier (i, values);
+    for (std::size_t k = 0; k < labels.size(); ++ k)
+      assert (values[k] == probabilities[i * labels.size() + k]);
+  }
+
+  std::vector<std::size_t> usage, usage_4;
+  classifier.get_feature_usage (usage);
+  classifier4.get_feature_usage (usage_4);
+  assert (usage == usage_4);
 
   return EXIT_SUCCESS;
 }
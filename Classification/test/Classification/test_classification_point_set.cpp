@@ -93,6 +93,28 @@ int main (int, char**)
   assert (generator.number_of_scales() == 5);
   assert (features.size() == 59);
 
+  // Height ranges stored in the grid must match the points of each cell
+  for (std::size_t s = 0; s < generator.number_of_scales(); ++ s)
+  {
+    const Feature_generator::Planimetric_grid& grid = generator.grid(s);
+    for (std::size_t x = 0; x < grid.width(); ++ x)
+      for (std::size_t y = 0; y < grid.height(); ++ y)
+        if (grid.has_points(x,y))
+        {
+          float z_min = (std::numeric_limits<float>::max)();
+          float z_max = -(std::numeric_limits<float>::max)();
+          for (Feature_generator::Planimetric_grid::iterator it = grid.indices_begin(x,y);
+               it != grid.indices_end(x,y); ++ it)
+          {
+            float z = float(pts.point(*(pts.begin() + *it)).z());
+            z_min = (std::min)(z_min, z);
+            z_max = (std::max)(z_max, z);
+          }
+          assert (grid.z_min(x,y) == z_min);
+          assert (grid.z_max(x,y) == z_max);
+        }
+  }
+
   Label_set labels;
 
   std::vector<int> training_set (pts.size(), -1);
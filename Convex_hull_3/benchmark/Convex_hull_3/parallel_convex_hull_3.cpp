@@ -0,0 +1,75 @@
+// Times the sequential and the parallel versions of `convex_hull_3()`
+// on random points in a ball and on random points close to a sphere.
+//
+// Usage: parallel_convex_hull_3 [number of points]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   K;
+typedef K::Point_3                                            Point_3;
+typedef CGAL::Surface_mesh<Point_3>                           Surface_mesh;
+
+template <class ConcurrencyTag>
+std::size_t bench(const std::string& name, const std::vector<Point_3>& points)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  Surface_mesh hull;
+  CGAL::convex_hull_3<ConcurrencyTag>(points.begin(), points.end(), hull);
+  timer.stop();
+
+  std::cout << name << " " << timer.time() << " sec. ("
+            << num_vertices(hull) << " hull vertices)" << std::endl;
+  return num_vertices(hull);
+}
+
+bool bench_all(const std::string& name, const std::vector<Point_3>& points)
+{
+  std::cout << name << ", " << points.size() << " points" << std::endl;
+  std::size_t seq = bench<CGAL::Sequential_tag>("  sequential", points);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::size_t par = bench<CGAL::Parallel_tag>("  parallel  ", points);
+  if(seq != par)
+  {
+    std::cerr << "Error: different results" << std::endl;
+    return false;
+  }
+#else
+  CGAL_USE(seq);
+#endif
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 10000000;
+  CGAL::Random random(0);
+
+  std::vector<Point_3> points;
+  points.reserve(n);
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point_3>(1.0, random), n, std::back_inserter(points));
+  if(!bench_all("ball", points))
+    return EXIT_FAILURE;
+
+  // a thin shell, where the filter discards fewer points
+  points.clear();
+  CGAL::Random_points_on_sphere_3<Point_3> on_sphere(1.0, random);
+  for(std::size_t i = 0; i < n; ++i, ++on_sphere)
+    points.push_back(CGAL::ORIGIN + (*on_sphere - CGAL::ORIGIN) * (1.0 - 0.01 * random.get_double()));
+  if(!bench_all("shell", points))
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
@@ -35,6 +35,31 @@ template <class InputIterator, class PolygonMesh, class Traits>
 void convex_hull_3(InputIterator first, InputIterator last, PolygonMesh& pm, const Traits& ch_traits = Default_traits);
 
 
+/*!
+\ingroup PkgConvexHull3Functions
+
+\brief computes the convex hull of the set of points in the range
+[`first`, `last`), possibly in parallel. The polygon mesh `pm` is cleared, then
+the convex hull is stored in `pm`, as with the sequential overload.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam InputIterator must be an input iterator with a value type equivalent to `Traits::Point_3`.
+With `Parallel_tag`, the points (or the points given by `Extreme_points_traits_adapter_3`)
+must provide Cartesian coordinates `x()`, `y()`, and `z()` convertible to `double`.
+\tparam PolygonMesh must be a model of `MutableFaceGraph`.
+\tparam Traits must be a model of the concept `ConvexHullTraits_3`.
+
+\cgalHeading{Implementation}
+
+With `Parallel_tag`, the points that are inside the convex hull of the points
+extreme along 14 directions are discarded in parallel (Akl-Toussaint heuristic),
+the extreme points of chunks of the remaining points are computed in parallel, and the convex hull
+of these extreme points is computed with the quickhull algorithm.
+*/
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh, class Traits>
+void convex_hull_3(InputIterator first, InputIterator last, PolygonMesh& pm, const Traits& ch_traits = Default_traits);
+
 /*!
 \ingroup PkgConvexHull3Functions
  * \brief computes the convex hull of the points associated to the vertices of `g`.
@@ -158,6 +183,24 @@ extreme_points_3(InputRange range,
               OutputIterator out,
               const Traits& traits);
 
+/*!
+\ingroup PkgConvexHull3Functions
+
+\brief copies in `out` the points on the convex hull of the points in `range`, possibly in parallel.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+The other template parameters and the parameters are the same as for the sequential overload.
+
+\sa `CGAL::convex_hull_3<ConcurrencyTag>()`
+*/
+template <class ConcurrencyTag, class InputRange, class OutputIterator, class Traits>
+OutputIterator
+extreme_points_3(InputRange range,
+              OutputIterator out,
+              const Traits& traits = Default_traits);
+
 
 
 } /* namespace CGAL */
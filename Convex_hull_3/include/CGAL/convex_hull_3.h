@@ -42,6 +42,7 @@
 #include <CGAL/boost/iterator/transform_iterator.hpp>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/type_traits/is_iterator.h>
+#include <CGAL/tags.h>
 
 #include <boost/mpl/has_xxx.hpp>
 #include <boost/graph/graph_traits.hpp>
@@ -53,13 +54,23 @@
 #endif // CGAL_CH_NO_POSTCONDITIONS
 
 #include <algorithm>
+#include <array>
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <list>
 #include <memory>
 #include <vector>
 #include <type_traits>
 #include <utility>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#endif // CGAL_LINKED_WITH_TBB
+
 // first some internal stuff to avoid using a true Face_graph model for extreme_points_3
 namespace CGAL {
 
@@ -328,6 +339,10 @@ public:
     if (Maxz < aprz) Maxz = aprz;
   }
 
+  // the exact plane is owned
+  Is_on_positive_side_of_plane_3(const Is_on_positive_side_of_plane_3&) = delete;
+  Is_on_positive_side_of_plane_3& operator=(const Is_on_positive_side_of_plane_3&) = delete;
+
   ~Is_on_positive_side_of_plane_3(){
     if (ek_plane_ptr!=nullptr) delete ek_plane_ptr;
   }
@@ -1109,6 +1124,243 @@ void convex_hull_3(InputIterator first, InputIterator beyond,
 }
 
 
+#ifdef CGAL_LINKED_WITH_TBB
+namespace Convex_hull_3 {
+namespace internal {
+
+// gives access to the coordinates of the points used by the parallel filter
+template <class Traits>
+struct Point_with_coordinates
+{
+  template <class Point>
+  static const Point& get(const Traits&, const Point& p) { return p; }
+};
+
+template <class VPM, class Base_traits>
+struct Point_with_coordinates< Extreme_points_traits_adapter_3<VPM, Base_traits> >
+{
+  template <class Point>
+  static decltype(auto) get(const Extreme_points_traits_adapter_3<VPM, Base_traits>& traits,
+                            const Point& p)
+  {
+    return traits.get_point(p);
+  }
+};
+
+// returns the indices of the points that are extreme in the directions of the axes
+// and of the diagonals of the octants, the first one in case of ties
+template <class Point_3, class Traits>
+std::vector<std::size_t>
+akl_toussaint_extreme_points(const std::vector<Point_3>& points, const Traits& traits)
+{
+  typedef std::pair<double, std::size_t>                      Extreme;
+  typedef std::array<Extreme, 14>                             Extremes;
+
+  static const double directions[14][3] = { { 1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0},
+                                            { 0, 0, 1}, { 0, 0,-1}, {1, 1, 1}, {1,  1,-1},
+                                            { 1,-1, 1}, { 1,-1,-1}, {-1, 1, 1}, {-1, 1,-1},
+                                            {-1,-1, 1}, {-1,-1,-1} };
+
+  Extremes init;
+  init.fill(Extreme(-std::numeric_limits<double>::infinity(), points.size()));
+
+  const Extremes extremes = tbb::parallel_reduce(
+    tbb::blocked_range<std::size_t>(0, points.size()), init,
+    [&](const tbb::blocked_range<std::size_t>& r, Extremes e)
+    {
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+      {
+        const auto& p = Point_with_coordinates<Traits>::get(traits, points[i]);
+        const double x = CGAL::to_double(p.x()), y = CGAL::to_double(p.y()), z = CGAL::to_double(p.z());
+        for(int d = 0; d < 14; ++d)
+        {
+          const double v = directions[d][0] * x + directions[d][1] * y + directions[d][2] * z;
+          if(v > e[d].first)
+            e[d] = Extreme(v, i);
+        }
+      }
+      return e;
+    },
+    [](Extremes a, const Extremes& b)
+    {
+      for(int d = 0; d < 14; ++d)
+        if(b[d].first > a[d].first || (b[d].first == a[d].first && b[d].second < a[d].second))
+          a[d] = b[d];
+      return a;
+    });
+
+  std::vector<std::size_t> ids;
+  for(const Extreme& e : extremes)
+    if(e.second != points.size())
+      ids.push_back(e.second);
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  return ids;
+}
+
+// Computes the convex hull in parallel:
+// - the points inside the convex hull of the points extreme in 14 directions are discarded (Akl-Toussaint heuristic),
+// - the extreme points of chunks of the remaining points are computed in parallel,
+// - the convex hull of these extreme points is computed sequentially.
+// The result does not depend on the number of threads.
+template <class InputIterator, class PolygonMesh, class Traits>
+void parallel_convex_hull_3(InputIterator first, InputIterator beyond,
+                            PolygonMesh& polyhedron,
+                            const Traits& traits)
+{
+  typedef typename Traits::Point_3                                  Point_3;
+  typedef Is_on_positive_side_of_plane_3<Traits>                    Is_on_positive_side;
+  typedef std::array<std::size_t, 3>                                Triangle;
+
+  const std::size_t chunk_size = 1 << 14;
+
+  std::vector<Point_3> points(first, beyond);
+  if(points.size() < 4)
+  {
+    convex_hull_3(points.begin(), points.end(), polyhedron, traits);
+    return;
+  }
+
+  // the convex hull of the extreme points, with the facets oriented outward
+  std::vector<Point_3> extremes;
+  for(std::size_t id : akl_toussaint_extreme_points(points, traits))
+    extremes.push_back(points[id]);
+
+  std::vector<Point_3> inner_vertices;
+  std::vector<Triangle> inner_faces;
+  {
+    Indexed_triangle_set<std::vector<Point_3>, std::vector<Triangle> > its(inner_vertices, inner_faces);
+    convex_hull_3(extremes.begin(), extremes.end(), its, traits);
+  }
+
+  // nothing is discarded if the extreme points are coplanar
+  typename Traits::Coplanar_3 coplanar = traits.coplanar_3_object();
+  bool is_3d = false;
+  if(!inner_faces.empty())
+  {
+    const Triangle& t = inner_faces.front();
+    for(const Point_3& p : inner_vertices)
+    {
+      if(!coplanar(inner_vertices[t[0]], inner_vertices[t[1]], inner_vertices[t[2]], p))
+      {
+        is_3d = true;
+        break;
+      }
+    }
+  }
+  if(!is_3d)
+    inner_faces.clear();
+
+  {
+    typename Is_on_positive_side::Protector protector;
+    for(Triangle& t : inner_faces)
+    {
+      Is_on_positive_side is_on_positive_side(traits, inner_vertices[t[0]], inner_vertices[t[1]], inner_vertices[t[2]]);
+      for(const Point_3& p : inner_vertices)
+      {
+        if(is_on_positive_side(p))
+        {
+          std::swap(t[1], t[2]);
+          break;
+        }
+      }
+    }
+  }
+
+  // the points that are not strictly outside the inner hull are not vertices of the convex hull,
+  // except the vertices of the inner hull
+  std::vector<char> is_outside(points.size(), inner_faces.empty());
+  if(!inner_faces.empty())
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, points.size(), chunk_size),
+      [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        // the rounding mode and the lazily computed planes of the predicates are local to the task;
+        // the predicates hold references and own their exact plane, so they must not be moved
+        typename Is_on_positive_side::Protector protector;
+        std::deque<Is_on_positive_side> is_on_positive_side;
+        for(const Triangle& t : inner_faces)
+          is_on_positive_side.emplace_back(traits, inner_vertices[t[0]], inner_vertices[t[1]], inner_vertices[t[2]]);
+
+        for(std::size_t i = r.begin(); i != r.end(); ++i)
+        {
+          for(const Is_on_positive_side& is_outside_face : is_on_positive_side)
+          {
+            if(is_outside_face(points[i]))
+            {
+              is_outside[i] = true;
+              break;
+            }
+          }
+        }
+      });
+  }
+
+  std::vector<Point_3> candidates(inner_vertices);
+  for(std::size_t i = 0; i < points.size(); ++i)
+    if(is_outside[i])
+      candidates.push_back(points[i]);
+  points.clear();
+  points.shrink_to_fit();
+
+  // the extreme points of the chunks of candidates
+  if(candidates.size() > 2 * chunk_size)
+  {
+    const std::size_t nb_chunks = (candidates.size() + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<Point_3> > chunk_extremes(nb_chunks);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_chunks, 1),
+      [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t c = r.begin(); c != r.end(); ++c)
+        {
+          typedef std::back_insert_iterator<std::vector<Point_3> > Back_inserter;
+          Output_iterator_wrapper<Back_inserter> wrapper(std::back_inserter(chunk_extremes[c]));
+          const std::size_t b = c * chunk_size;
+          const std::size_t e = (std::min)(b + chunk_size, candidates.size());
+          convex_hull_3(candidates.begin() + b, candidates.begin() + e, wrapper, traits);
+        }
+      });
+
+    candidates.clear();
+    for(const std::vector<Point_3>& ce : chunk_extremes)
+      candidates.insert(candidates.end(), ce.begin(), ce.end());
+  }
+
+  convex_hull_3(candidates.begin(), candidates.end(), polyhedron, traits);
+}
+
+} // namespace internal
+} // namespace Convex_hull_3
+#endif // CGAL_LINKED_WITH_TBB
+
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh, class Traits>
+void convex_hull_3(InputIterator first, InputIterator beyond,
+                   PolygonMesh& polyhedron,
+                   const Traits& traits)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    Convex_hull_3::internal::parallel_convex_hull_3(first, beyond, polyhedron, traits);
+    return;
+  }
+#endif
+  convex_hull_3(first, beyond, polyhedron, traits);
+}
+
+template <class ConcurrencyTag, class InputIterator, class PolygonMesh>
+void convex_hull_3(InputIterator first, InputIterator beyond,
+                   PolygonMesh& polyhedron,
+                   std::enable_if_t<CGAL::is_iterator<InputIterator>::value>* = 0)
+{
+  typedef typename std::iterator_traits<InputIterator>::value_type Point_3;
+  typedef typename Convex_hull_3::internal::Default_traits_for_Chull_3<Point_3, PolygonMesh>::type Traits;
+  convex_hull_3<ConcurrencyTag>(first, beyond, polyhedron, Traits());
+}
+
 template <class InputRange, class OutputIterator, class Traits>
 OutputIterator
 extreme_points_3(const InputRange& range,
@@ -1131,6 +1383,28 @@ extreme_points_3(const InputRange& range, OutputIterator out)
   return extreme_points_3(range, out, Traits());
 }
 
+template <class ConcurrencyTag, class InputRange, class OutputIterator, class Traits>
+OutputIterator
+extreme_points_3(const InputRange& range,
+                 OutputIterator out,
+                 const Traits& traits)
+{
+  Convex_hull_3::internal::Output_iterator_wrapper<OutputIterator> wrapper(out);
+  convex_hull_3<ConcurrencyTag>(range.begin(), range.end(), wrapper, traits);
+  return out;
+}
+
+template <class ConcurrencyTag, class InputRange, class OutputIterator>
+OutputIterator
+extreme_points_3(const InputRange& range, OutputIterator out)
+{
+  typedef typename InputRange::const_iterator Iterator_type;
+  typedef typename std::iterator_traits<Iterator_type>::value_type Point_3;
+  typedef typename Convex_hull_3::internal::Default_traits_for_Chull_3<Point_3>::type Traits;
+
+  return extreme_points_3<ConcurrencyTag>(range, out, Traits());
+}
+
 } // namespace CGAL
 
 #endif // CGAL_CONVEX_HULL_3_H
@@ -0,0 +1,118 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Extreme_points_traits_adapter_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+typedef CGAL::Surface_mesh<Point_3>                         Surface_mesh;
+typedef CGAL::Polyhedron_3<K>                               Polyhedron_3;
+
+template <class Mesh>
+std::vector<Point_3> sorted_vertices(const Mesh& mesh)
+{
+  std::vector<Point_3> points;
+  for(auto v : vertices(mesh))
+    points.push_back(get(CGAL::vertex_point, mesh, v));
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+// compares the hulls computed with `ConcurrencyTag` with the sequential ones
+template <class ConcurrencyTag, class Mesh>
+void test_hull(const std::vector<Point_3>& points)
+{
+  Mesh expected, hull;
+  CGAL::convex_hull_3(points.begin(), points.end(), expected);
+  CGAL::convex_hull_3<ConcurrencyTag>(points.begin(), points.end(), hull);
+
+  assert(sorted_vertices(hull) == sorted_vertices(expected));
+  assert(num_faces(hull) == num_faces(expected));
+  assert(CGAL::is_closed(hull) == CGAL::is_closed(expected));
+}
+
+template <class ConcurrencyTag>
+void test_extreme_points(const std::vector<Point_3>& points)
+{
+  std::vector<Point_3> expected, extreme_points;
+  CGAL::extreme_points_3(points, std::back_inserter(expected));
+  CGAL::extreme_points_3<ConcurrencyTag>(points, std::back_inserter(extreme_points));
+  std::sort(expected.begin(), expected.end());
+  std::sort(extreme_points.begin(), extreme_points.end());
+  assert(extreme_points == expected);
+
+  // indices of the points
+  std::vector<std::size_t> indices(points.size()), extreme_indices;
+  for(std::size_t i = 0; i < points.size(); ++i)
+    indices[i] = i;
+  CGAL::extreme_points_3<ConcurrencyTag>(indices, std::back_inserter(extreme_indices),
+    CGAL::make_extreme_points_traits_adapter(CGAL::make_property_map(points)));
+  std::vector<Point_3> extreme_points_from_indices;
+  for(std::size_t i : extreme_indices)
+    extreme_points_from_indices.push_back(points[i]);
+  std::sort(extreme_points_from_indices.begin(), extreme_points_from_indices.end());
+  assert(extreme_points_from_indices == expected);
+}
+
+template <class ConcurrencyTag>
+void test_all(const std::vector<std::vector<Point_3> >& inputs)
+{
+  for(const std::vector<Point_3>& points : inputs)
+  {
+    test_hull<ConcurrencyTag, Surface_mesh>(points);
+    test_hull<ConcurrencyTag, Polyhedron_3>(points);
+    test_extreme_points<ConcurrencyTag>(points);
+  }
+}
+
+int main()
+{
+  CGAL::Random random(42);
+  std::vector<std::vector<Point_3> > inputs;
+
+  // many interior points
+  inputs.emplace_back();
+  std::copy_n(CGAL::Random_points_in_sphere_3<Point_3>(1.0, random), 100000, std::back_inserter(inputs.back()));
+
+  // all the points on the hull
+  inputs.emplace_back();
+  std::copy_n(CGAL::Random_points_on_sphere_3<Point_3>(1.0, random), 50000, std::back_inserter(inputs.back()));
+
+  // coplanar points
+  inputs.emplace_back();
+  for(int i = 0; i < 1000; ++i)
+    inputs.back().push_back(Point_3(random.get_double(), random.get_double(), 0));
+
+  // collinear and small inputs
+  inputs.emplace_back();
+  for(int i = 0; i < 100; ++i)
+    inputs.back().push_back(Point_3(i, 2 * i, 3 * i));
+  inputs.push_back(std::vector<Point_3>(3, Point_3(1, 1, 1)));
+  inputs.push_back({ Point_3(0, 0, 0), Point_3(1, 0, 0), Point_3(0, 1, 0), Point_3(0, 0, 1), Point_3(0.1, 0.1, 0.1) });
+
+  test_all<CGAL::Sequential_tag>(inputs);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // filter and compute the partial hulls concurrently, whatever the number of cores
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test_all<CGAL::Parallel_tag>(inputs); });
+#endif
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
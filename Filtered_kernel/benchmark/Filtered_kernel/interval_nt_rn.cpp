@@ -0,0 +1,140 @@
+// Compares `Interval_nt` (with rounding mode switches) and `Interval_nt_rn`
+// (in round-to-nearest mode) as the approximate number type of filtered
+// predicates, and in a loop computing many orientation determinants.
+//
+// Usage: interval_nt_rn [number of points] [number of rounds]
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Cartesian_converter.h>
+#include <CGAL/Filtered_predicate.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Interval_nt_rn.h>
+#include <CGAL/MP_Float.h>
+#include <CGAL/Quotient.h>
+#include <CGAL/determinant.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Simple_cartesian<CGAL::Quotient<CGAL::MP_Float> > EK;
+typedef CGAL::Cartesian_converter<K, EK> C2E;
+
+typedef CGAL::Simple_cartesian<CGAL::Interval_nt_advanced> IK;
+typedef CGAL::Simple_cartesian<CGAL::Interval_nt_rn> RK;
+typedef CGAL::Cartesian_converter<K, IK> C2I;
+typedef CGAL::Cartesian_converter<K, RK> C2R;
+
+// what Epick does after its static filters
+typedef CGAL::Filtered_predicate<EK::Orientation_3, IK::Orientation_3, C2E, C2I> I_orientation_3;
+typedef CGAL::Filtered_predicate<EK::Side_of_oriented_sphere_3, IK::Side_of_oriented_sphere_3, C2E, C2I> I_side_of_oriented_sphere_3;
+// no rounding mode switch
+typedef CGAL::Filtered_predicate<EK::Orientation_3, RK::Orientation_3, C2E, C2R, false> R_orientation_3;
+typedef CGAL::Filtered_predicate<EK::Side_of_oriented_sphere_3, RK::Side_of_oriented_sphere_3, C2E, C2R, false> R_side_of_oriented_sphere_3;
+
+template <class Orientation, class Side_of_oriented_sphere>
+void bench_predicates(const std::string& name, const std::vector<Point_3>& pts, int nb_rounds)
+{
+  Orientation orientation;
+  Side_of_oriented_sphere side_of_oriented_sphere;
+  CGAL::Real_timer timer;
+  int res = 0;
+
+  timer.start();
+  for(int r = 0; r < nb_rounds; ++ r)
+    for(std::size_t i = 0; i + 3 < pts.size(); ++ i)
+      res += int(orientation(pts[i], pts[i+1], pts[i+2], pts[i+3]));
+  timer.stop();
+  std::cout << name << " orientation_3:             " << timer.time() << " sec. (" << res << ")" << std::endl;
+
+  res = 0;
+  timer.reset();
+  timer.start();
+  for(int r = 0; r < nb_rounds; ++ r)
+    for(std::size_t i = 0; i + 4 < pts.size(); ++ i)
+      res += int(side_of_oriented_sphere(pts[i], pts[i+1], pts[i+2], pts[i+3], pts[i+4]));
+  timer.stop();
+  std::cout << name << " side_of_oriented_sphere_3: " << timer.time() << " sec. (" << res << ")" << std::endl;
+}
+
+// The orientation determinants of consecutive points, in a loop without
+// calls nor branches, which the compiler can vectorize with `Interval_nt_rn`.
+template <class IA>
+void orientation_determinants(const std::vector<double>& x, const std::vector<double>& y,
+                              const std::vector<double>& z,
+                              std::vector<double>& lo, std::vector<double>& hi)
+{
+  const std::size_t n = lo.size();
+  for(std::size_t i = 0; i < n; ++ i)
+  {
+    IA px(x[i]), py(y[i]), pz(z[i]);
+    IA qx = IA(x[i+1]) - px, qy = IA(y[i+1]) - py, qz = IA(z[i+1]) - pz;
+    IA rx = IA(x[i+2]) - px, ry = IA(y[i+2]) - py, rz = IA(z[i+2]) - pz;
+    IA sx = IA(x[i+3]) - px, sy = IA(y[i+3]) - py, sz = IA(z[i+3]) - pz;
+    IA det = qx * (ry * sz - rz * sy) - rx * (qy * sz - qz * sy) + sx * (qy * rz - qz * ry);
+    lo[i] = det.inf();
+    hi[i] = det.sup();
+  }
+}
+
+template <class IA, class Protector>
+void bench_loop(const std::string& name, const std::vector<Point_3>& pts, int nb_rounds)
+{
+  std::vector<double> x, y, z;
+  for(const Point_3& p : pts)
+  {
+    x.push_back(p.x()); y.push_back(p.y()); z.push_back(p.z());
+  }
+  std::vector<double> lo(pts.size() - 3), hi(pts.size() - 3);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  for(int r = 0; r < nb_rounds; ++ r)
+  {
+    Protector p;
+    orientation_determinants<IA>(x, y, z, lo, hi);
+  }
+  timer.stop();
+
+  std::size_t nb_positive = 0, nb_uncertain = 0;
+  for(std::size_t i = 0; i < lo.size(); ++ i)
+  {
+    nb_positive += (lo[i] > 0);
+    nb_uncertain += (lo[i] <= 0 && hi[i] >= 0);
+  }
+  std::cout << name << " determinant loop:          " << timer.time() << " sec. ("
+            << nb_positive << " positive, " << nb_uncertain << " uncertain)" << std::endl;
+}
+
+struct No_protector { };
+
+int main(int argc, char** argv)
+{
+  const int nb_points = (argc > 1) ? std::stoi(argv[1]) : 1000000;
+  const int nb_rounds = (argc > 2) ? std::stoi(argv[2]) : 5;
+
+  CGAL::Random rnd(0);
+  std::vector<Point_3> pts;
+  pts.reserve(nb_points);
+  for(int i = 0; i < nb_points; ++ i)
+    pts.emplace_back(rnd.get_double(), rnd.get_double(), rnd.get_double());
+
+  bench_predicates<I_orientation_3, I_side_of_oriented_sphere_3>("Interval_nt   ", pts, nb_rounds);
+  bench_predicates<R_orientation_3, R_side_of_oriented_sphere_3>("Interval_nt_rn", pts, nb_rounds);
+
+  bench_loop<CGAL::Interval_nt_advanced, CGAL::Protect_FPU_rounding<true> >("Interval_nt   ", pts, nb_rounds);
+  bench_loop<CGAL::Interval_nt_rn, No_protector>("Interval_nt_rn", pts, nb_rounds);
+
+  // Degenerate inputs: points on a small grid
+  for(Point_3& p : pts)
+    p = Point_3(rnd.get_int(0, 4), rnd.get_int(0, 4), rnd.get_int(0, 4));
+  std::cout << "Points on a grid:" << std::endl;
+  bench_predicates<I_orientation_3, I_side_of_oriented_sphere_3>("Interval_nt   ", pts, nb_rounds);
+  bench_predicates<R_orientation_3, R_side_of_oriented_sphere_3>("Interval_nt_rn", pts, nb_rounds);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+// Compares the construction of many lazy objects with the default
+// allocation of the nodes of the DAG and with a `Lazy_node_arena`.
+// Compile with and without `-DCGAL_LAZY_NODE_ARENA`.
+//
+// Usage: lazy_node_arena [number of points] [number of rounds]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Lazy_node_arena.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+double run(const std::vector<Point_3>& pts, int nb_rounds, bool use_arena)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  std::size_t nb_positive = 0;
+  for(int r = 0; r < nb_rounds; ++ r)
+  {
+    std::optional<CGAL::Lazy_node_arena> arena;
+    if(use_arena)
+      arena.emplace();
+
+    std::vector<Point_3> centers;
+    centers.reserve(pts.size());
+    for(std::size_t i = 0; i + 3 < pts.size(); ++ i)
+      centers.push_back(CGAL::centroid(CGAL::midpoint(pts[i], pts[i+1]),
+                                       CGAL::midpoint(pts[i+2], pts[i+3]),
+                                       pts[i]));
+    for(std::size_t i = 0; i + 3 < centers.size(); ++ i)
+      if(CGAL::orientation(centers[i], centers[i+1], centers[i+2], centers[i+3]) == CGAL::POSITIVE)
+        ++ nb_positive;
+
+    if(arena && r == 0)
+    {
+      const CGAL::Lazy_node_arena_statistics& stats = arena->statistics();
+      std::cout << "  " << stats.allocated_nodes << " nodes ("
+                << stats.reused_nodes << " reused), "
+                << stats.allocated_bytes << " bytes in "
+                << stats.reserved_bytes << " reserved, "
+                << stats.exact_evaluations << " exact evaluations" << std::endl;
+    }
+  }
+  timer.stop();
+  std::cout << "  " << nb_positive << " positive orientations" << std::endl;
+  return timer.time();
+}
+
+int main(int argc, char** argv)
+{
+  const int nb_points = (argc > 1) ? std::stoi(argv[1]) : 1000000;
+  const int nb_rounds = (argc > 2) ? std::stoi(argv[2]) : 3;
+
+  CGAL::Random rnd(0);
+  std::vector<Point_3> pts;
+  pts.reserve(nb_points);
+  for(int i = 0; i < nb_points; ++ i)
+    pts.emplace_back(rnd.get_double(), rnd.get_double(), rnd.get_double());
+
+#ifdef CGAL_LAZY_NODE_ARENA
+  std::cout << "Nodes allocated in arenas:" << std::endl;
+  double t = run(pts, nb_rounds, true);
+#else
+  std::cout << "Default allocation of the nodes:" << std::endl;
+  double t = run(pts, nb_rounds, false);
+#endif
+  std::cout << "  " << t << " sec." << std::endl;
+
+  return EXIT_SUCCESS;
+}
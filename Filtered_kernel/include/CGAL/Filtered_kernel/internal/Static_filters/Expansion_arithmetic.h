@@ -0,0 +1,382 @@
+// Copyright (c) 2024 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+
+#ifndef CGAL_INTERNAL_STATIC_FILTERS_EXPANSION_ARITHMETIC_H
+#define CGAL_INTERNAL_STATIC_FILTERS_EXPANSION_ARITHMETIC_H
+
+#include <CGAL/enum.h>
+#include <CGAL/tss.h>
+
+#include <cmath>
+#include <memory>
+
+// Exact evaluation of the signs of the determinants of Orientation_2,
+// Orientation_3, Side_of_oriented_circle_2 and Side_of_oriented_sphere_3 with
+// floating-point expansions, following Shewchuk ("Adaptive Precision
+// Floating-Point Arithmetic and Fast Robust Geometric Predicates", Discrete
+// & Computational Geometry 18, 1997).  An expansion is a sum of doubles of
+// increasing magnitudes which do not overlap, whose sign is the sign of the
+// largest one.
+//
+// The static filters use these functions when both the semi-static filter
+// and the interval filter fail, which, for nearly degenerate inputs, is much
+// faster than the exact number type.  The determinants are expanded on the
+// coordinates of the points, without translation, so that no rounding error
+// is made before the expansion arithmetic, which is exact as long as nothing
+// underflows nor overflows: see `fit_in_expansion_range()`.  Out of this
+// range, the static filters call the exact stage of the filtered predicate
+// directly, since its interval filter has already failed.
+//
+// The computations must be done in the default rounding mode, to nearest.
+
+namespace CGAL { namespace internal { namespace Expansion_arithmetic {
+
+// Sets x + y = a + b, where x is a + b rounded to nearest.
+inline void two_sum(double a, double b, double& x, double& y)
+{
+  x = a + b;
+  double bv = x - a;
+  double av = x - bv;
+  y = (a - av) + (b - bv);
+}
+
+// Sets x + y = a * b, where x is a * b rounded to nearest.
+inline void two_product(double a, double b, double& x, double& y)
+{
+  x = a * b;
+#if defined(FP_FAST_FMA) || defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+  y = std::fma(a, b, -x);
+#else
+  // Dekker's product, with Veltkamp's splitting in two halves of 26 bits.
+  const double splitter = 0x1p27 + 1;
+  double c = splitter * a;
+  double ahi = c - (c - a), alo = a - ahi;
+  c = splitter * b;
+  double bhi = c - (c - b), blo = b - bhi;
+  y = ((ahi * bhi - x) + ahi * blo + alo * bhi) + alo * blo;
+#endif
+}
+
+// Sets h = e + f and returns the length of h, which has at most elen + flen
+// components.  The components of e and f are merged by increasing magnitude
+// and accumulated with two_sum, and the zero components of h are eliminated
+// (Shewchuk's Fast-Expansion-Sum).  e and f have at least one component.
+inline int expansion_sum(int elen, const double* e, int flen, const double* f, double* h)
+{
+  int ei = 0, fi = 0, hi = 0;
+  double q;
+  if ((f[0] > e[0]) == (f[0] > -e[0])) q = e[ei++];
+  else                                 q = f[fi++];
+  double x, err;
+  while (ei < elen || fi < flen)
+  {
+    if (fi == flen || (ei < elen && ((f[fi] > e[ei]) == (f[fi] > -e[ei]))))
+      two_sum(q, e[ei++], x, err);
+    else
+      two_sum(q, f[fi++], x, err);
+    q = x;
+    if (err != 0)
+      h[hi++] = err;
+  }
+  if (q != 0 || hi == 0)
+    h[hi++] = q;
+  return hi;
+}
+
+// Sets h = b * e and returns the length of h, which has at most 2 * elen
+// components (Shewchuk's Scale-Expansion, with zero elimination).
+inline int scale_expansion(int elen, const double* e, double b, double* h)
+{
+  int hi = 0;
+  double q, err, p1, p0, s;
+  two_product(e[0], b, q, err);
+  if (err != 0)
+    h[hi++] = err;
+  for (int i = 1; i < elen; ++i)
+  {
+    two_product(e[i], b, p1, p0);
+    two_sum(q, p0, s, err);
+    if (err != 0)
+      h[hi++] = err;
+    two_sum(p1, s, q, err);
+    if (err != 0)
+      h[hi++] = err;
+  }
+  if (q != 0 || hi == 0)
+    h[hi++] = q;
+  return hi;
+}
+
+// An expansion with at most N components.
+template <int N>
+struct Expansion
+{
+  double c[N];
+  int n;
+
+  Sign sign() const
+  {
+    return (c[n-1] > 0) ? POSITIVE : ((c[n-1] < 0) ? NEGATIVE : ZERO);
+  }
+};
+
+template <int A, int B>
+void sum(const Expansion<A>& e, const Expansion<B>& f, Expansion<A+B>& h)
+{
+  h.n = expansion_sum(e.n, e.c, f.n, f.c, h.c);
+}
+
+template <int A>
+void scale(const Expansion<A>& e, double b, Expansion<2*A>& h)
+{
+  h.n = scale_expansion(e.n, e.c, b, h.c);
+}
+
+template <int A>
+void negate(Expansion<A>& e)
+{
+  for (int i = 0; i < e.n; ++i)
+    e.c[i] = -e.c[i];
+}
+
+// The expansions below are exact if the nonzero coordinates have magnitudes
+// in [2^-128, 2^128]: the determinants have degree at most 5, so all the
+// intermediate results are multiples of 2^(-5*180) (the last bit of the
+// product of five such coordinates), and are smaller than 2^660.
+inline bool fit_in_expansion_range(double d)
+{
+  double a = std::fabs(d);
+  return a == 0 || (a >= 0x1p-128 && a <= 0x1p128);
+}
+
+template <typename... D>
+bool fit_in_expansion_range(double d, D... ds)
+{
+  return fit_in_expansion_range(d) && fit_in_expansion_range(ds...);
+}
+
+// ax * by - bx * ay
+inline void minor_2(double ax, double ay, double bx, double by, Expansion<4>& m)
+{
+  Expansion<2> p, q;
+  two_product(ax, by, p.c[1], p.c[0]);
+  two_product(-bx, ay, q.c[1], q.c[0]);
+  p.n = q.n = 2;
+  sum(p, q, m);
+}
+
+// The determinant of the rows (a, 1), (b, 1), (c, 1) is
+// m_bc - m_ac + m_ab, where m_ij is the determinant of the rows i and j.
+inline void det_3_1(const Expansion<4>& m_ab, Expansion<4> m_ac, const Expansion<4>& m_bc,
+                    Expansion<12>& d)
+{
+  Expansion<8> t;
+  negate(m_ac);
+  sum(m_bc, m_ac, t);
+  sum(t, m_ab, d);
+}
+
+// The determinant of the rows (a, az), (b, bz), (c, cz) where the
+// determinants of the first two columns are m_ij, expanded on the last
+// column: az * m_bc - bz * m_ac + cz * m_ab.
+inline void det_3_z(double az, double bz, double cz,
+                    const Expansion<4>& m_ab, const Expansion<4>& m_ac, const Expansion<4>& m_bc,
+                    Expansion<24>& d)
+{
+  Expansion<8> ta, tb, tc;
+  Expansion<16> t;
+  scale(m_bc, az, ta);
+  scale(m_ac, -bz, tb);
+  scale(m_ab, cz, tc);
+  sum(ta, tb, t);
+  sum(t, tc, d);
+}
+
+// Sets h = (x^2 + y^2) * e.
+template <int A>
+void lift_2(const Expansion<A>& e, double x, double y, Expansion<8*A>& h)
+{
+  Expansion<2*A> t;
+  Expansion<4*A> tx, ty;
+  scale(e, x, t);
+  scale(t, x, tx);
+  scale(e, y, t);
+  scale(t, y, ty);
+  sum(tx, ty, h);
+}
+
+// The same with the lifted coordinates w = x^2 + y^2 in the last column.
+inline void det_3_w(double ax, double ay, double bx, double by, double cx, double cy,
+                    const Expansion<4>& m_ab, const Expansion<4>& m_ac, const Expansion<4>& m_bc,
+                    Expansion<96>& d)
+{
+  Expansion<32> ta, tb, tc;
+  Expansion<64> t;
+  Expansion<4> m = m_ac;
+  negate(m);
+  lift_2(m_bc, ax, ay, ta);
+  lift_2(m, bx, by, tb);
+  lift_2(m_ab, cx, cy, tc);
+  sum(ta, tb, t);
+  sum(t, tc, d);
+}
+
+// The determinant of the rows (a, 1), (b, 1), (c, 1), (d, 1), where the
+// determinants of the first three columns of the rows other than i are D_i,
+// expanded on the last column: -D_a + D_b - D_c + D_d.
+template <int A>
+void det_4_1(Expansion<A> d_a, const Expansion<A>& d_b, Expansion<A> d_c, const Expansion<A>& d_d,
+             Expansion<4*A>& d)
+{
+  Expansion<2*A> t1, t2;
+  negate(d_a);
+  negate(d_c);
+  sum(d_a, d_b, t1);
+  sum(d_c, d_d, t2);
+  sum(t1, t2, d);
+}
+
+// Sign of the determinant of the rows (p, 1), (q, 1), (r, 1).
+inline Sign orientation_2(double px, double py, double qx, double qy, double rx, double ry)
+{
+  Expansion<4> m_pq, m_pr, m_qr;
+  minor_2(px, py, qx, qy, m_pq);
+  minor_2(px, py, rx, ry, m_pr);
+  minor_2(qx, qy, rx, ry, m_qr);
+  Expansion<12> d;
+  det_3_1(m_pq, m_pr, m_qr, d);
+  return d.sign();
+}
+
+// Sign of the determinant of the rows (p, 1), (q, 1), (r, 1), (s, 1).
+inline Sign orientation_3(double px, double py, double pz, double qx, double qy, double qz,
+                          double rx, double ry, double rz, double sx, double sy, double sz)
+{
+  Expansion<4> m_pq, m_pr, m_ps, m_qr, m_qs, m_rs;
+  minor_2(px, py, qx, qy, m_pq);
+  minor_2(px, py, rx, ry, m_pr);
+  minor_2(px, py, sx, sy, m_ps);
+  minor_2(qx, qy, rx, ry, m_qr);
+  minor_2(qx, qy, sx, sy, m_qs);
+  minor_2(rx, ry, sx, sy, m_rs);
+  Expansion<24> d_p, d_q, d_r, d_s;
+  det_3_z(qz, rz, sz, m_qr, m_qs, m_rs, d_p);
+  det_3_z(pz, rz, sz, m_pr, m_ps, m_rs, d_q);
+  det_3_z(pz, qz, sz, m_pq, m_ps, m_qs, d_r);
+  det_3_z(pz, qz, rz, m_pq, m_pr, m_qr, d_s);
+  Expansion<96> d;
+  det_4_1(d_p, d_q, d_r, d_s, d);
+  return d.sign();
+}
+
+// Sign of the determinant of the rows (p, p^2, 1), (q, q^2, 1), (r, r^2, 1),
+// (t, t^2, 1).
+inline Sign side_of_oriented_circle_2(double px, double py, double qx, double qy,
+                                      double rx, double ry, double tx, double ty)
+{
+  Expansion<4> m_pq, m_pr, m_pt, m_qr, m_qt, m_rt;
+  minor_2(px, py, qx, qy, m_pq);
+  minor_2(px, py, rx, ry, m_pr);
+  minor_2(px, py, tx, ty, m_pt);
+  minor_2(qx, qy, rx, ry, m_qr);
+  minor_2(qx, qy, tx, ty, m_qt);
+  minor_2(rx, ry, tx, ty, m_rt);
+  Expansion<96> d_p, d_q, d_r, d_t;
+  det_3_w(qx, qy, rx, ry, tx, ty, m_qr, m_qt, m_rt, d_p);
+  det_3_w(px, py, rx, ry, tx, ty, m_pr, m_pt, m_rt, d_q);
+  det_3_w(px, py, qx, qy, tx, ty, m_pq, m_pt, m_qt, d_r);
+  det_3_w(px, py, qx, qy, rx, ry, m_pq, m_pr, m_qr, d_t);
+  Expansion<384> d;
+  det_4_1(d_p, d_q, d_r, d_t, d);
+  return d.sign();
+}
+
+// The expansions of the terms of the determinant of side_of_oriented_sphere_3(),
+// and of their sum.
+struct Side_of_oriented_sphere_3_scratch
+{
+  Expansion<192> t;
+  Expansion<384> tx, ty, tz;
+  Expansion<768> txy;
+  Expansion<1152> term;
+  // The result has at most 5 * 1152 components, plus the initial zero.
+  double buffer[2][5 * 1152 + 1];
+};
+
+// Sign of the determinant of the rows (a, a^2, 1) for a = p, q, r, s, t,
+// expanded on the column of the squared norms: the minors are the
+// determinants of Orientation_3 of the other points.
+inline Sign side_of_oriented_sphere_3(const double* x, const double* y, const double* z)
+{
+  // The determinants of the first two columns of the rows i < j.
+  Expansion<4> m[5][5];
+  for (int i = 0; i < 5; ++i)
+    for (int j = i+1; j < 5; ++j)
+      minor_2(x[i], y[i], x[j], y[j], m[i][j]);
+
+  // The determinants of the first three columns of the rows i < j < k.
+  Expansion<24> d3[10];
+  int index[5][5][5];
+  int n3 = 0;
+  for (int i = 0; i < 5; ++i)
+    for (int j = i+1; j < 5; ++j)
+      for (int k = j+1; k < 5; ++k)
+      {
+        det_3_z(z[i], z[j], z[k], m[i][j], m[i][k], m[j][k], d3[n3]);
+        index[i][j][k] = n3++;
+      }
+
+  // The expansions of the last stage are too large for the stack of the
+  // threads, they are allocated once per thread.
+  CGAL_STATIC_THREAD_LOCAL_VARIABLE_0(std::unique_ptr<Side_of_oriented_sphere_3_scratch>, scratch);
+  if (!scratch)
+    scratch.reset(new Side_of_oriented_sphere_3_scratch());
+  double (&buffer)[2][5 * 1152 + 1] = scratch->buffer;
+  int len = 1, cur = 0;
+  buffer[cur][0] = 0;
+  for (int i = 0; i < 5; ++i)
+  {
+    int o[4], n = 0;
+    for (int j = 0; j < 5; ++j)
+      if (j != i)
+        o[n++] = j;
+    Expansion<96> d4;
+    det_4_1(d3[index[o[1]][o[2]][o[3]]], d3[index[o[0]][o[2]][o[3]]],
+            d3[index[o[0]][o[1]][o[3]]], d3[index[o[0]][o[1]][o[2]]], d4);
+    // The cofactor of row i in the column of the squared norms is
+    // (-1)^(i+3) times d4.
+    if (i % 2 == 0)
+      negate(d4);
+    Expansion<192>& t = scratch->t;
+    Expansion<384>& tx = scratch->tx;
+    Expansion<384>& ty = scratch->ty;
+    Expansion<384>& tz = scratch->tz;
+    Expansion<768>& txy = scratch->txy;
+    Expansion<1152>& term = scratch->term;
+    scale(d4, x[i], t);
+    scale(t, x[i], tx);
+    scale(d4, y[i], t);
+    scale(t, y[i], ty);
+    scale(d4, z[i], t);
+    scale(t, z[i], tz);
+    sum(tx, ty, txy);
+    sum(txy, tz, term);
+    len = expansion_sum(len, buffer[cur], term.n, term.c, buffer[1-cur]);
+    cur = 1 - cur;
+  }
+  const double top = buffer[cur][len-1];
+  return (top > 0) ? POSITIVE : ((top < 0) ? NEGATIVE : ZERO);
+}
+
+} } } // namespace CGAL::internal::Expansion_arithmetic
+
+#endif // CGAL_INTERNAL_STATIC_FILTERS_EXPANSION_ARITHMETIC_H
@@ -16,6 +16,9 @@
 #include <CGAL/Profile_counter.h>
 #include <CGAL/determinant.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Static_filter_error.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/tools.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Expansion_arithmetic.h>
 
 #include <cmath>
 
@@ -86,11 +89,37 @@ public:
           }
 
           CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+
+          Uncertain<Sign> res = adaptive(px, py, qx, qy, rx, ry);
+          if (is_certain(res))
+            return get_certain(res);
+          return call_exact_stage(static_cast<const Base&>(*this), 0, p, q, r);
       }
 
       return Base::operator()(p, q, r);
   }
 
+  static Uncertain<Sign>
+  adaptive(double px, double py, double qx, double qy, double rx, double ry)
+  {
+    CGAL_BRANCH_PROFILER_3("expansion failures/interval failures/calls to   : Orientation_2", tmp);
+#ifndef CGAL_EPICK_NO_INTERVALS
+    {
+      Protect_FPU_rounding<true> p;
+      typedef Interval_nt_advanced IA;
+      Uncertain<Sign> res = CGAL::sign(CGAL::determinant(IA(qx) - IA(px), IA(qy) - IA(py),
+                                                         IA(rx) - IA(px), IA(ry) - IA(py)));
+      if (is_certain(res))
+        return res;
+    }
+    CGAL_BRANCH_PROFILER_BRANCH_1(tmp);
+#endif
+    if (Expansion_arithmetic::fit_in_expansion_range(px, py, qx, qy, rx, ry))
+      return Expansion_arithmetic::orientation_2(qx, qy, rx, ry, px, py);
+    CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+    return Uncertain<Sign>::indeterminate();
+  }
+
   // Computes the epsilon for Orientation_2.
   static double compute_epsilon()
   {
@@ -15,6 +15,9 @@
 
 #include <CGAL/Profile_counter.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Static_filter_error.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/tools.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Expansion_arithmetic.h>
 #include <cmath>
 
 namespace CGAL { namespace internal { namespace Static_filters_predicates {
@@ -133,11 +136,84 @@ public:
             if (det < -eps) return NEGATIVE;
           }
           CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+
+          Uncertain<Sign> res = adaptive(px, py, pz, qx, qy, qz, rx, ry, rz, sx, sy, sz);
+          if (is_certain(res))
+            return get_certain(res);
+          return call_exact_stage(static_cast<const Base&>(*this), 0, p, q, r, s);
       }
 
       return Base::operator()(p, q, r, s);
   }
 
+  static Uncertain<Sign>
+  adaptive(double px, double py, double pz, double qx, double qy, double qz,
+           double rx, double ry, double rz, double sx, double sy, double sz)
+  {
+    CGAL_BRANCH_PROFILER_3("expansion failures/interval failures/calls to   : Orientation_3", tmp);
+#ifndef CGAL_EPICK_NO_INTERVALS
+    {
+      Protect_FPU_rounding<true> p;
+      typedef Interval_nt_advanced IA;
+      IA ipx(px), ipy(py), ipz(pz);
+      Uncertain<Sign> res = CGAL::sign(CGAL::determinant(IA(qx) - ipx, IA(qy) - ipy, IA(qz) - ipz,
+                                                         IA(rx) - ipx, IA(ry) - ipy, IA(rz) - ipz,
+                                                         IA(sx) - ipx, IA(sy) - ipy, IA(sz) - ipz));
+      if (is_certain(res))
+        return res;
+    }
+    CGAL_BRANCH_PROFILER_BRANCH_1(tmp);
+#endif
+    if (Expansion_arithmetic::fit_in_expansion_range(px, py, pz, qx, qy, qz,
+                                                     rx, ry, rz, sx, sy, sz))
+      return Expansion_arithmetic::orientation_3(qx, qy, qz, rx, ry, rz, sx, sy, sz, px, py, pz);
+    CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+    return Uncertain<Sign>::indeterminate();
+  }
+
+  // Semi-static filter of `N` predicates at once, for points with `double`
+  // coordinates: the j-th point of the l-th predicate is `(x[j][l], y[j][l], z[j][l])`.
+  // It performs the same computations as `operator()`, without branches, so that
+  // the lanes can be evaluated with vector instructions. `res[l]` is set to
+  // the sign of the l-th predicate, or to `2` if the filter failed for this lane.
+  template <int N>
+  static void filter_batch(const double (&x)[4][N], const double (&y)[4][N],
+                           const double (&z)[4][N], int (&res)[N])
+  {
+    double det[N], eps[N], lower[N], upper[N];
+    for(int l = 0; l < N; ++l)
+    {
+      const double pqx = x[1][l] - x[0][l], pqy = y[1][l] - y[0][l], pqz = z[1][l] - z[0][l];
+      const double prx = x[2][l] - x[0][l], pry = y[2][l] - y[0][l], prz = z[2][l] - z[0][l];
+      const double psx = x[3][l] - x[0][l], psy = y[3][l] - y[0][l], psz = z[3][l] - z[0][l];
+
+      const double maxx = batch_max(batch_max(std::abs(pqx), std::abs(prx)), std::abs(psx));
+      const double maxy = batch_max(batch_max(std::abs(pqy), std::abs(pry)), std::abs(psy));
+      const double maxz = batch_max(batch_max(std::abs(pqz), std::abs(prz)), std::abs(psz));
+      lower[l] = batch_min(batch_min(maxx, maxy), maxz);
+      upper[l] = batch_max(batch_max(maxx, maxy), maxz);
+
+      det[l] = CGAL::determinant(pqx, pqy, pqz,
+                                 prx, pry, prz,
+                                 psx, psy, psz);
+      eps[l] = 5.1107127829973299e-15 * maxx * maxy * maxz;
+    }
+
+    // same underflow and overflow protections as in `operator()`
+    for(int l = 0; l < N; ++l)
+    {
+      const bool in_range = (lower[l] >= 1e-97) && (upper[l] < 1e102);
+      if(lower[l] == 0)
+        res[l] = 0;
+      else if(in_range && det[l] > eps[l])
+        res[l] = 1;
+      else if(in_range && det[l] < -eps[l])
+        res[l] = -1;
+      else
+        res[l] = 2;
+    }
+  }
+
   // Computes the epsilon for Orientation_3.
   static double compute_epsilon()
   {
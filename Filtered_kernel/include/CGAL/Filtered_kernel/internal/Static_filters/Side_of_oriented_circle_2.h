@@ -15,6 +15,9 @@
 
 #include <CGAL/Profile_counter.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Static_filter_error.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/tools.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Expansion_arithmetic.h>
 #include <cmath>
 
 namespace CGAL { namespace internal { namespace Static_filters_predicates {
@@ -97,11 +100,43 @@ public:
           }
 
           CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+
+          Uncertain<Sign> res = adaptive(px, py, qx, qy, rx, ry, tx, ty);
+          if (is_certain(res))
+            return get_certain(res);
+          return call_exact_stage(static_cast<const Base&>(*this), 0, p, q, r, t);
       }
 
       return Base::operator()(p, q, r, t);
   }
 
+  static Uncertain<Sign>
+  adaptive(double px, double py, double qx, double qy,
+           double rx, double ry, double tx, double ty)
+  {
+    CGAL_BRANCH_PROFILER_3("expansion failures/interval failures/calls to   : Side_of_oriented_circle_2", tmp);
+#ifndef CGAL_EPICK_NO_INTERVALS
+    {
+      Protect_FPU_rounding<true> p;
+      typedef Interval_nt_advanced IA;
+      IA qpx = IA(qx) - IA(px), qpy = IA(qy) - IA(py);
+      IA rpx = IA(rx) - IA(px), rpy = IA(ry) - IA(py);
+      IA tpx = IA(tx) - IA(px), tpy = IA(ty) - IA(py);
+      IA tqx = IA(tx) - IA(qx), tqy = IA(ty) - IA(qy);
+      IA rqx = IA(rx) - IA(qx), rqy = IA(ry) - IA(qy);
+      Uncertain<Sign> res = CGAL::sign(CGAL::determinant(qpx*tpy - qpy*tpx, tpx*tqx + tpy*tqy,
+                                                         qpx*rpy - qpy*rpx, rpx*rqx + rpy*rqy));
+      if (is_certain(res))
+        return res;
+    }
+    CGAL_BRANCH_PROFILER_BRANCH_1(tmp);
+#endif
+    if (Expansion_arithmetic::fit_in_expansion_range(px, py, qx, qy, rx, ry, tx, ty))
+      return Expansion_arithmetic::side_of_oriented_circle_2(px, py, qx, qy, rx, ry, tx, ty);
+    CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+    return Uncertain<Sign>::indeterminate();
+  }
+
   // Computes the epsilon for Side_of_oriented_circle_2.
   static double compute_epsilon()
   {
@@ -15,6 +15,11 @@
 
 #include <CGAL/Profile_counter.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Static_filter_error.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/tools.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Expansion_arithmetic.h>
+
+#include <cmath>
 
 namespace CGAL { namespace internal { namespace Static_filters_predicates {
 
@@ -144,10 +149,107 @@ public:
           }
 
           CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+
+          Uncertain<Sign> res = adaptive(px, py, pz, qx, qy, qz, rx, ry, rz,
+                                         sx, sy, sz, tx, ty, tz);
+          if (is_certain(res))
+            return get_certain(res);
+          return call_exact_stage(static_cast<const Base&>(*this), 0, p, q, r, s, t);
       }
       return Base::operator()(p, q, r, s, t);
   }
 
+  static Uncertain<Sign>
+  adaptive(double px, double py, double pz, double qx, double qy, double qz,
+           double rx, double ry, double rz, double sx, double sy, double sz,
+           double tx, double ty, double tz)
+  {
+    CGAL_BRANCH_PROFILER_3("expansion failures/interval failures/calls to   : Side_of_oriented_sphere_3", tmp);
+#ifndef CGAL_EPICK_NO_INTERVALS
+    {
+      Protect_FPU_rounding<true> p;
+      typedef Interval_nt_advanced IA;
+      IA itx(tx), ity(ty), itz(tz);
+      IA ptx = IA(px) - itx, pty = IA(py) - ity, ptz = IA(pz) - itz;
+      IA qtx = IA(qx) - itx, qty = IA(qy) - ity, qtz = IA(qz) - itz;
+      IA rtx = IA(rx) - itx, rty = IA(ry) - ity, rtz = IA(rz) - itz;
+      IA stx = IA(sx) - itx, sty = IA(sy) - ity, stz = IA(sz) - itz;
+      Uncertain<Sign> res = CGAL::sign(CGAL::determinant(
+          ptx, pty, ptz, CGAL_NTS square(ptx) + CGAL_NTS square(pty) + CGAL_NTS square(ptz),
+          rtx, rty, rtz, CGAL_NTS square(rtx) + CGAL_NTS square(rty) + CGAL_NTS square(rtz),
+          qtx, qty, qtz, CGAL_NTS square(qtx) + CGAL_NTS square(qty) + CGAL_NTS square(qtz),
+          stx, sty, stz, CGAL_NTS square(stx) + CGAL_NTS square(sty) + CGAL_NTS square(stz)));
+      if (is_certain(res))
+        return res;
+    }
+    CGAL_BRANCH_PROFILER_BRANCH_1(tmp);
+#endif
+    if (Expansion_arithmetic::fit_in_expansion_range(px, py, pz, qx, qy, qz, rx, ry, rz,
+                                                     sx, sy, sz, tx, ty, tz))
+    {
+      // The determinant of the filter is the one of the rows
+      // (a, a^2, 1) for a = p, r, q, s, t.
+      const double x[5] = { px, rx, qx, sx, tx };
+      const double y[5] = { py, ry, qy, sy, ty };
+      const double z[5] = { pz, rz, qz, sz, tz };
+      return Expansion_arithmetic::side_of_oriented_sphere_3(x, y, z);
+    }
+    CGAL_BRANCH_PROFILER_BRANCH_2(tmp);
+    return Uncertain<Sign>::indeterminate();
+  }
+
+  // Semi-static filter of `N` predicates at once, for points with `double`
+  // coordinates: the j-th point of the l-th predicate is `(x[j][l], y[j][l], z[j][l])`.
+  // It performs the same computations as `operator()`, without branches, so that
+  // the lanes can be evaluated with vector instructions. `res[l]` is set to
+  // the sign of the l-th predicate, or to `2` if the filter failed for this lane.
+  template <int N>
+  static void filter_batch(const double (&x)[5][N], const double (&y)[5][N],
+                           const double (&z)[5][N], int (&res)[N])
+  {
+    double det[N], eps[N], lower[N], upper[N];
+    for(int l = 0; l < N; ++l)
+    {
+      const double ptx = x[0][l] - x[4][l], pty = y[0][l] - y[4][l], ptz = z[0][l] - z[4][l];
+      const double qtx = x[1][l] - x[4][l], qty = y[1][l] - y[4][l], qtz = z[1][l] - z[4][l];
+      const double rtx = x[2][l] - x[4][l], rty = y[2][l] - y[4][l], rtz = z[2][l] - z[4][l];
+      const double stx = x[3][l] - x[4][l], sty = y[3][l] - y[4][l], stz = z[3][l] - z[4][l];
+      const double pt2 = ptx*ptx + pty*pty + ptz*ptz;
+      const double qt2 = qtx*qtx + qty*qty + qtz*qtz;
+      const double rt2 = rtx*rtx + rty*rty + rtz*rtz;
+      const double st2 = stx*stx + sty*sty + stz*stz;
+
+      const double maxx = batch_max(batch_max(std::abs(ptx), std::abs(qtx)),
+                                    batch_max(std::abs(rtx), std::abs(stx)));
+      const double maxy = batch_max(batch_max(std::abs(pty), std::abs(qty)),
+                                    batch_max(std::abs(rty), std::abs(sty)));
+      const double maxz = batch_max(batch_max(std::abs(ptz), std::abs(qtz)),
+                                    batch_max(std::abs(rtz), std::abs(stz)));
+      lower[l] = batch_min(batch_min(maxx, maxy), maxz);
+      upper[l] = batch_max(batch_max(maxx, maxy), maxz);
+
+      det[l] = CGAL::determinant(ptx,pty,ptz,pt2,
+                                 rtx,rty,rtz,rt2,
+                                 qtx,qty,qtz,qt2,
+                                 stx,sty,stz,st2);
+      eps[l] = (1.2466136531027298e-13 * maxx * maxy * maxz) * (upper[l] * upper[l]);
+    }
+
+    // same underflow and overflow protections as in `operator()`
+    for(int l = 0; l < N; ++l)
+    {
+      const bool in_range = (lower[l] >= 1e-58) && (upper[l] < 1e61);
+      if(lower[l] == 0)
+        res[l] = 0;
+      else if(in_range && det[l] > eps[l])
+        res[l] = 1;
+      else if(in_range && det[l] < -eps[l])
+        res[l] = -1;
+      else
+        res[l] = 2;
+    }
+  }
+
   // Computes the epsilon for Side_of_oriented_sphere_3.
   static double compute_epsilon()
   {
@@ -17,6 +17,8 @@
 #include <CGAL/function_objects.h>
 #include <boost/mpl/has_xxx.hpp>
 
+#include <type_traits>
+
 namespace CGAL {
 
 template < typename ET >
@@ -27,6 +29,42 @@ class Interval_nt;
 
 namespace internal {
 
+// Evaluating several predicates at once with `filter_batch()` only pays off
+// when the compiler can use 256-bit vector instructions.
+#if defined(__AVX__) && !defined(CGAL_NO_BATCHED_STATIC_FILTERS) && !defined(CGAL_BATCHED_STATIC_FILTERS)
+#  define CGAL_BATCHED_STATIC_FILTERS
+#endif
+
+// Whether the predicate `P` provides a semi-static filter evaluating several
+// predicates at once (see `Static_filters_predicates::Orientation_3::filter_batch()`).
+template <typename P, typename = void>
+struct Has_filter_batch : std::false_type {};
+
+template <typename P>
+struct Has_filter_batch<P, std::void_t<decltype(&P::template filter_batch<4>)> >
+  : std::true_type {};
+
+// Calls the exact stage of the filtered predicate `p` (see
+// `Filtered_predicate::call_exact()`) if it has one, and `p` otherwise.
+template <typename P, typename... Args>
+auto call_exact_stage(const P& p, int, const Args&... args)
+  -> decltype(p.call_exact(args...))
+{
+  return p.call_exact(args...);
+}
+
+template <typename P, typename... Args>
+auto call_exact_stage(const P& p, long, const Args&... args)
+  -> decltype(p(args...))
+{
+  return p(args...);
+}
+
+// Minimum and maximum written so that compilers turn them into
+// vector instructions in the loops of the `filter_batch()` functions.
+inline double batch_min(double a, double b) { return (b < a) ? b : a; }
+inline double batch_max(double a, double b) { return (a < b) ? b : a; }
+
 // Utility function to check a posteriori that a subtraction was performed
 // without rounding error.
 inline bool diff_was_exact(double a, double b, double ab)
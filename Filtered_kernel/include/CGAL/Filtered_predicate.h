@@ -108,6 +108,15 @@ public:
 #endif // CGAL_EPICK_NO_INTERVALS
     return ep(c2e(args)...);
   }
+
+  // The exact predicate alone, for the static filters that already ran an
+  // interval filter.
+  template <typename... Args>
+  result_type
+  call_exact(const Args&... args) const
+  {
+    return ep(c2e(args)...);
+  }
 };
 
 template <class EP_RT, class EP_FT, class AP, class C2E_RT, class C2E_FT, class C2A, bool Protection = true>
@@ -176,6 +185,15 @@ public:
 #endif // CGAL_EPICK_NO_INTERVALS
     return call(args...);
   }
+
+  // The exact predicate alone, for the static filters that already ran an
+  // interval filter.
+  template <typename... Args>
+  result_type
+  call_exact(const Args&... args) const
+  {
+    return call(args...);
+  }
 };
 
 } // namespace CGAL
@@ -26,6 +26,7 @@
 #include <CGAL/Bbox_2.h>
 #include <CGAL/Bbox_3.h>
 #include <CGAL/Default.h>
+#include <CGAL/Lazy_node_arena.h>
 #include <CGAL/tss.h>
 #include <CGAL/type_traits/is_iterator.h>
 #include <CGAL/transforming_iterator.h>
@@ -275,7 +276,7 @@ template<class AT>struct Lazy_rep_selector { static constexpr int value = 1; };
 #endif
 
 template<class AT>
-struct AT_wrap {
+struct AT_wrap : internal::Lazy_node_arena_allocated {
   AT at_;
   AT_wrap():at_(){}
   AT_wrap(AT const& a):at_(a){}
@@ -296,7 +297,7 @@ struct AT_ET_wrap : AT_wrap<AT> {
 
 // Abstract base class for lazy numbers and lazy objects
 template <typename AT_, typename ET, typename E2A, int=Lazy_rep_selector<AT_>::value /* 0 */>
-class Lazy_rep : public Rep, public Depth_base
+class Lazy_rep : public Rep, public Depth_base, public internal::Lazy_node_arena_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -339,7 +340,7 @@ public:
   {
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){ internal::lazy_note_exact_evaluation(); this->update_exact(); });
     return exact_unsafe(); // call_once already synchronized memory
   }
 
@@ -409,7 +410,7 @@ public:
  * For aggregate-like types (Simple_cartesian::Point_3), it should be ok for the same reason.
  * This is definitely NOT safe for a std::vector like a Point_d with Dynamic_dimension_tag, so it should only be enabled on a case by case basis, if at all. Storing a Point_3 piecewise with 6 atomic_double would be doable, but painful, and I didn't benchmark to check the performance. */
 template <typename AT_, typename ET, typename E2A>
-class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Depth_base
+class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Depth_base, public internal::Lazy_node_arena_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -464,10 +465,12 @@ public:
 #ifdef CGAL_HAS_THREADS
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){ internal::lazy_note_exact_evaluation(); this->update_exact(); });
 #else
-    if (is_lazy())
+    if (is_lazy()) {
+      internal::lazy_note_exact_evaluation();
       this->update_exact();
+    }
 #endif
     return exact_unsafe(); // call_once already synchronized memory
   }
@@ -522,7 +525,7 @@ public:
 
 // do we need to (forward) declare Interval_nt?
 template <bool b, typename ET, typename E2A>
-class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Depth_base
+class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Depth_base, public internal::Lazy_node_arena_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -573,7 +576,7 @@ public:
   {
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){ internal::lazy_note_exact_evaluation(); this->update_exact(); });
     return exact_unsafe(); // call_once already synchronized memory
   }
 
@@ -1164,7 +1167,9 @@ public :
   {
     // Note that the new only happens inside an if() inside the macro
     // So it would be a mistake to put the new before the macro
-    CGAL_STATIC_THREAD_LOCAL_VARIABLE(Self,z,(new Lazy_rep_0<AT, ET, E2A>()));
+    // It lives as long as the thread, so it must not keep an arena alive.
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE(Self,z,([]{ internal::Without_lazy_node_arena no_arena;
+                                                  return new Lazy_rep_0<AT, ET, E2A>(); }()));
     return z;
   }
 
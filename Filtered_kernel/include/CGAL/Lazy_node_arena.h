@@ -0,0 +1,297 @@
+// Copyright (c) 2024 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+
+#ifndef CGAL_LAZY_NODE_ARENA_H
+#define CGAL_LAZY_NODE_ARENA_H
+
+#include <CGAL/config.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tss.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/*
+  Region allocation of the nodes of the DAG of lazy numbers and lazy
+  kernel objects.
+
+  By default, each node of the DAG (`Lazy_rep` and the structure
+  storing its exact value) is allocated with the global `operator new`.
+  If the macro `CGAL_LAZY_NODE_ARENA` is defined before including any
+  CGAL header, nodes are instead allocated in the `Lazy_node_arena` that
+  is active in the current thread, if any:
+
+    {
+      CGAL::Lazy_node_arena arena;
+      // ... computations with Epeck or Lazy_exact_nt ...
+      std::cout << arena.statistics().allocated_nodes << std::endl;
+    }
+
+  Nodes are allocated by bumping a pointer in large chunks, and the
+  slots of nodes destroyed in the thread of the arena while it is active
+  are reused. The chunks themselves are released in bulk, once the arena
+  has been destroyed and the last node allocated in it is gone. Nodes
+  can therefore safely outlive the arena (for example the points of an
+  output mesh), or be destroyed by another thread, but they keep the
+  memory of the whole arena alive.
+
+  Each node is preceded by a header of `alignof(std::max_align_t)` bytes,
+  which is why the allocation policy is selected at compile time.
+*/
+
+namespace CGAL {
+
+// Counters of a `Lazy_node_arena`. Only the allocations and the exact
+// evaluations done by the thread of the arena while it is active are
+// taken into account.
+struct Lazy_node_arena_statistics
+{
+  // number of nodes and exact values allocated in the arena
+  std::size_t allocated_nodes = 0;
+  // number of those that reused the slot of a destroyed node
+  std::size_t reused_nodes = 0;
+  // total size of the allocated nodes
+  std::size_t allocated_bytes = 0;
+  // total size of the chunks reserved by the arena
+  std::size_t reserved_bytes = 0;
+  // number of times the exact value of a node has been computed
+  std::size_t exact_evaluations = 0;
+};
+
+namespace internal {
+
+class Lazy_node_arena_state
+{
+  static constexpr std::size_t alignment = alignof(std::max_align_t);
+  // larger nodes are allocated with the global operator new
+  static constexpr std::size_t max_node_size = 32 * alignment;
+  static constexpr std::size_t nb_size_classes = max_node_size / alignment + 1;
+  static constexpr std::size_t min_chunk_size = std::size_t(1) << 16;
+  static constexpr std::size_t max_chunk_size = std::size_t(1) << 22;
+
+  struct alignas(alignment) Header
+  {
+    // nullptr if the node has been allocated with the global operator new
+    Lazy_node_arena_state* owner;
+  };
+
+  std::vector<char*> m_chunks;
+  char* m_begin = nullptr;
+  char* m_end = nullptr;
+  void* m_free_lists[nb_size_classes] = {};
+
+  // allocations minus deallocations done by the thread of the arena while it is active
+  std::size_t m_local_nodes = 0;
+  // minus the other deallocations, until the arena is closed
+  std::atomic<std::ptrdiff_t> m_remote_nodes { 0 };
+
+  Lazy_node_arena_statistics m_statistics;
+
+public:
+
+  Lazy_node_arena_state() { }
+  Lazy_node_arena_state(const Lazy_node_arena_state&) = delete;
+  Lazy_node_arena_state& operator=(const Lazy_node_arena_state&) = delete;
+
+  ~Lazy_node_arena_state()
+  {
+    for(char* chunk : m_chunks)
+      ::operator delete(chunk);
+  }
+
+  static Lazy_node_arena_state*& current()
+  {
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE(Lazy_node_arena_state*, arena, nullptr);
+    return arena;
+  }
+
+  const Lazy_node_arena_statistics& statistics() const { return m_statistics; }
+
+  static void* allocate(std::size_t size)
+  {
+    Lazy_node_arena_state* arena = current();
+    Header* h;
+    if(arena == nullptr || size > max_node_size)
+    {
+      h = static_cast<Header*>(::operator new(sizeof(Header) + size));
+      h->owner = nullptr;
+    }
+    else
+      h = arena->allocate_in_chunk(size);
+    return h + 1;
+  }
+
+  static void deallocate(void* p, std::size_t size)
+  {
+    Header* h = static_cast<Header*>(p) - 1;
+    if(h->owner == nullptr)
+      ::operator delete(h);
+    else
+      h->owner->deallocate_in_chunk(h, size);
+  }
+
+  static void note_exact_evaluation()
+  {
+    Lazy_node_arena_state* arena = current();
+    if(arena != nullptr)
+      ++ arena->m_statistics.exact_evaluations;
+  }
+
+  // Called by the thread of the arena once it is not active anymore.
+  // The state is destroyed when no node allocated in it remains.
+  void close()
+  {
+    CGAL_precondition(current() != this);
+    const std::ptrdiff_t local_nodes = std::ptrdiff_t(m_local_nodes);
+    if(m_remote_nodes.fetch_add(local_nodes, std::memory_order_acq_rel) + local_nodes == 0)
+      delete this;
+  }
+
+private:
+
+  static std::size_t size_class(std::size_t size)
+  {
+    return (size + alignment - 1) / alignment;
+  }
+
+  Header* allocate_in_chunk(std::size_t size)
+  {
+    ++ m_local_nodes;
+    ++ m_statistics.allocated_nodes;
+    m_statistics.allocated_bytes += size;
+
+    const std::size_t sc = size_class(size);
+    Header* h;
+    if(m_free_lists[sc] != nullptr)
+    {
+      h = static_cast<Header*>(m_free_lists[sc]);
+      m_free_lists[sc] = *static_cast<void**>(m_free_lists[sc]);
+      ++ m_statistics.reused_nodes;
+    }
+    else
+    {
+      const std::size_t bytes = sizeof(Header) + sc * alignment;
+      if(std::size_t(m_end - m_begin) < bytes)
+        add_chunk();
+      h = reinterpret_cast<Header*>(m_begin);
+      m_begin += bytes;
+    }
+    h->owner = this;
+    return h;
+  }
+
+  void deallocate_in_chunk(Header* h, std::size_t size)
+  {
+    if(current() == this)
+    {
+      // the slot is reused by the next node of the same size class
+      const std::size_t sc = size_class(size);
+      *reinterpret_cast<void**>(h) = m_free_lists[sc];
+      m_free_lists[sc] = h;
+      -- m_local_nodes;
+    }
+    else if(m_remote_nodes.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      // last node of a closed arena
+      delete this;
+    }
+  }
+
+  void add_chunk()
+  {
+    const std::size_t chunk_size = (m_chunks.size() < 6) ? (min_chunk_size << m_chunks.size())
+                                                         : max_chunk_size;
+    m_chunks.push_back(static_cast<char*>(::operator new(chunk_size)));
+    m_begin = m_chunks.back();
+    m_end = m_begin + chunk_size;
+    m_statistics.reserved_bytes += chunk_size;
+  }
+};
+
+// Base class of the types allocated by the lazy kernel
+struct Lazy_node_arena_allocated
+{
+#ifdef CGAL_LAZY_NODE_ARENA
+  static void* operator new(std::size_t size) { return Lazy_node_arena_state::allocate(size); }
+  static void operator delete(void* p, std::size_t size) { Lazy_node_arena_state::deallocate(p, size); }
+  // keep placement new available
+  static void* operator new(std::size_t, void* p) noexcept { return p; }
+  static void operator delete(void*, void*) noexcept { }
+#endif
+};
+
+inline void lazy_note_exact_evaluation()
+{
+#ifdef CGAL_LAZY_NODE_ARENA
+  Lazy_node_arena_state::note_exact_evaluation();
+#endif
+}
+
+// Nodes allocated while this object exists are not put in the active arena
+// (used for the nodes of static variables, which are never destroyed)
+class Without_lazy_node_arena
+{
+  Lazy_node_arena_state* m_arena;
+
+public:
+  Without_lazy_node_arena()
+    : m_arena(Lazy_node_arena_state::current())
+  {
+    Lazy_node_arena_state::current() = nullptr;
+  }
+
+  ~Without_lazy_node_arena()
+  {
+    Lazy_node_arena_state::current() = m_arena;
+  }
+
+  Without_lazy_node_arena(const Without_lazy_node_arena&) = delete;
+  Without_lazy_node_arena& operator=(const Without_lazy_node_arena&) = delete;
+};
+
+} // namespace internal
+
+// While an object of this class exists, the lazy nodes created by the
+// current thread are allocated in it (if `CGAL_LAZY_NODE_ARENA` is defined).
+// Arenas can be nested, the innermost one is used.
+class Lazy_node_arena
+{
+  internal::Lazy_node_arena_state* m_state;
+  internal::Lazy_node_arena_state* m_previous;
+
+public:
+
+  Lazy_node_arena()
+    : m_state(new internal::Lazy_node_arena_state()),
+      m_previous(internal::Lazy_node_arena_state::current())
+  {
+    internal::Lazy_node_arena_state::current() = m_state;
+  }
+
+  ~Lazy_node_arena()
+  {
+    CGAL_destructor_assertion(internal::Lazy_node_arena_state::current() == m_state);
+    internal::Lazy_node_arena_state::current() = m_previous;
+    m_state->close();
+  }
+
+  Lazy_node_arena(const Lazy_node_arena&) = delete;
+  Lazy_node_arena& operator=(const Lazy_node_arena&) = delete;
+
+  const Lazy_node_arena_statistics& statistics() const { return m_state->statistics(); }
+};
+
+} // namespace CGAL
+
+#endif // CGAL_LAZY_NODE_ARENA_H
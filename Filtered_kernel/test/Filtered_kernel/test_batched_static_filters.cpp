@@ -0,0 +1,83 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+static_assert(CGAL::internal::Has_filter_batch<K::Orientation_3>::value);
+static_assert(CGAL::internal::Has_filter_batch<K::Side_of_oriented_sphere_3>::value);
+
+const int N = 4;
+
+// Checks that the lanes decided by `filter_batch()` agree with the exact predicates,
+// and returns the number of decided lanes
+std::size_t test_batch(const std::vector<Point_3>& pts)
+{
+  std::size_t nb_certain = 0;
+  for(std::size_t i = 0; i + 5 * N <= pts.size(); i += 5 * N)
+  {
+    double x[5][N], y[5][N], z[5][N];
+    double ox[4][N], oy[4][N], oz[4][N];
+    for(int l = 0; l < N; ++l)
+      for(int j = 0; j < 5; ++j)
+      {
+        const Point_3& p = pts[i + 5 * l + j];
+        x[j][l] = p.x(); y[j][l] = p.y(); z[j][l] = p.z();
+        if(j < 4)
+        {
+          ox[j][l] = p.x(); oy[j][l] = p.y(); oz[j][l] = p.z();
+        }
+      }
+
+    int sphere[N], orientation[N];
+    K::Side_of_oriented_sphere_3::filter_batch(x, y, z, sphere);
+    K::Orientation_3::filter_batch(ox, oy, oz, orientation);
+
+    for(int l = 0; l < N; ++l)
+    {
+      const Point_3* p = &pts[i + 5 * l];
+      if(sphere[l] != 2)
+      {
+        assert(sphere[l] == int(K().side_of_oriented_sphere_3_object()(p[0], p[1], p[2], p[3], p[4])));
+        ++nb_certain;
+      }
+      if(orientation[l] != 2)
+      {
+        assert(orientation[l] == int(K().orientation_3_object()(p[0], p[1], p[2], p[3])));
+        ++nb_certain;
+      }
+    }
+  }
+  return nb_certain;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Point_3> pts;
+
+  // random points: almost all lanes are decided
+  for(int i = 0; i < 5 * N * 1000; ++i)
+    pts.emplace_back(rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1));
+  assert(test_batch(pts) > 2 * N * 990);
+
+  // points on a grid: many coplanar and cospherical configurations
+  pts.clear();
+  for(int i = 0; i < 5 * N * 1000; ++i)
+    pts.emplace_back(rnd.get_int(0, 3), rnd.get_int(0, 3), rnd.get_int(0, 3));
+  test_batch(pts);
+
+  // almost degenerate configurations
+  pts.clear();
+  for(int i = 0; i < 5 * N * 1000; ++i)
+    pts.emplace_back(rnd.get_int(0, 3) + rnd.get_double(-1e-15, 1e-15),
+                     rnd.get_int(0, 3), rnd.get_int(0, 3) * 1e-200);
+  test_batch(pts);
+
+  std::cout << "OK" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+// Checks the Epick predicates whose static filters fall back to the exact
+// evaluation with floating-point expansions against an exact kernel, on
+// degenerate and almost degenerate configurations, and with coordinates
+// outside the range where the expansions are exact.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/MP_Float.h>
+#include <CGAL/Quotient.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Simple_cartesian<CGAL::Quotient<CGAL::MP_Float> > EK;
+
+CGAL::Random rnd(0);
+
+double random_coordinate(int mode)
+{
+  switch(mode)
+  {
+    // points on a grid
+    case 0: return rnd.get_int(0, 4);
+    // points close to a grid
+    case 1: return rnd.get_int(0, 4) + rnd.get_int(-2, 2) * std::ldexp(1., -50);
+    // wide range of magnitudes
+    case 2: return rnd.get_double(-1, 1) * std::ldexp(1., rnd.get_int(-100, 100));
+    // large coordinates, still in the range of the expansions
+    case 3: return rnd.get_int(0, 3) * 1e20 + rnd.get_int(-1, 1) * 1e5;
+    // out of the range of the expansions
+    default: return rnd.get_int(0, 3) * std::ldexp(1., rnd.get_int(-200, -140));
+  }
+}
+
+int main()
+{
+  int nb_zeros = 0;
+  for(int i = 0; i < 20000; ++i)
+  {
+    const int mode = i % 5;
+    double x[5], y[5], z[5];
+    for(int j = 0; j < 5; ++j)
+    {
+      x[j] = random_coordinate(mode);
+      y[j] = random_coordinate(mode);
+      z[j] = random_coordinate(mode);
+    }
+
+    K::Point_2 p2[4];
+    EK::Point_2 ep2[4];
+    for(int j = 0; j < 4; ++j)
+    {
+      p2[j] = K::Point_2(x[j], y[j]);
+      ep2[j] = EK::Point_2(x[j], y[j]);
+    }
+    K::Point_3 p3[5];
+    EK::Point_3 ep3[5];
+    for(int j = 0; j < 5; ++j)
+    {
+      p3[j] = K::Point_3(x[j], y[j], z[j]);
+      ep3[j] = EK::Point_3(x[j], y[j], z[j]);
+    }
+
+    const CGAL::Orientation o2 = CGAL::orientation(p2[0], p2[1], p2[2]);
+    assert(o2 == CGAL::orientation(ep2[0], ep2[1], ep2[2]));
+    const CGAL::Orientation o3 = CGAL::orientation(p3[0], p3[1], p3[2], p3[3]);
+    assert(o3 == CGAL::orientation(ep3[0], ep3[1], ep3[2], ep3[3]));
+    const CGAL::Oriented_side c = CGAL::side_of_oriented_circle(p2[0], p2[1], p2[2], p2[3]);
+    assert(c == CGAL::side_of_oriented_circle(ep2[0], ep2[1], ep2[2], ep2[3]));
+    const CGAL::Oriented_side s = CGAL::side_of_oriented_sphere(p3[0], p3[1], p3[2], p3[3], p3[4]);
+    assert(s == CGAL::side_of_oriented_sphere(ep3[0], ep3[1], ep3[2], ep3[3], ep3[4]));
+
+    nb_zeros += (o2 == CGAL::ZERO) + (o3 == CGAL::ZERO) + (c == CGAL::ZERO) + (s == CGAL::ZERO);
+  }
+  // the degenerate cases are exercised
+  assert(nb_zeros > 1000);
+
+  std::cout << "OK" << std::endl;
+  return EXIT_SUCCESS;
+}
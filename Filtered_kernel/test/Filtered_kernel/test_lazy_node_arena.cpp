@@ -0,0 +1,92 @@
+#define CGAL_LAZY_NODE_ARENA
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Lazy_node_arena.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::FT FT;
+typedef K::Point_3 Point_3;
+typedef K::Segment_2 Segment_2;
+typedef K::Point_2 Point_2;
+
+// circumcenters of consecutive points, whose exact values are needed for the comparisons
+std::vector<Point_3> circumcenters(const std::vector<Point_3>& pts)
+{
+  std::vector<Point_3> res;
+  for(std::size_t i = 0; i + 3 < pts.size(); ++ i)
+    res.push_back(CGAL::circumcenter(pts[i], pts[i+1], pts[i+2], pts[i+3]));
+  return res;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Point_3> pts;
+  for(int i = 0; i < 1000; ++ i)
+    pts.emplace_back(rnd.get_double(), rnd.get_double(), rnd.get_double());
+
+  const std::vector<Point_3> reference = circumcenters(pts);
+
+  std::vector<Point_3> kept;
+  {
+    CGAL::Lazy_node_arena arena;
+    std::vector<Point_3> res = circumcenters(pts);
+    assert(res.size() == reference.size());
+    for(std::size_t i = 0; i < res.size(); ++ i)
+      assert(res[i] == reference[i]);
+
+    const CGAL::Lazy_node_arena_statistics& stats = arena.statistics();
+    assert(stats.allocated_nodes >= res.size());
+    assert(stats.allocated_bytes > 0);
+    assert(stats.reserved_bytes >= stats.allocated_bytes);
+
+    // force the exact computation of some values
+    std::size_t nb_exact = stats.exact_evaluations;
+    FT sum = 0;
+    for(std::size_t i = 0; i < 10; ++ i)
+      sum += res[i].x();
+    CGAL::exact(sum);
+    assert(stats.exact_evaluations > nb_exact);
+
+    // nodes of destroyed objects are reused
+    std::size_t reused = stats.reused_nodes;
+    res.clear();
+    res = circumcenters(pts);
+    assert(stats.reused_nodes > reused);
+
+    // nested arena
+    {
+      CGAL::Lazy_node_arena inner;
+      Point_3 m = CGAL::midpoint(res[0], res[1]);
+      assert(inner.statistics().allocated_nodes > 0);
+      assert(m == CGAL::midpoint(reference[0], reference[1]));
+    }
+
+    // objects outliving the arena, some of them destroyed by another thread
+    kept.assign(res.begin(), res.begin() + 100);
+    std::vector<Point_3> other(res.begin() + 100, res.end());
+    std::thread t([&other]() { other.clear(); });
+    t.join();
+  }
+
+  for(std::size_t i = 0; i < kept.size(); ++ i)
+    assert(CGAL::exact(kept[i]) == CGAL::exact(reference[i]));
+  kept.clear();
+
+  // the default constructed objects do not pin the arena
+  {
+    CGAL::Lazy_node_arena arena;
+    Point_2 p, q(1, 2);
+    Segment_2 s(p, q);
+    assert(s.target() == q);
+  }
+
+  std::cout << "OK" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -26,6 +26,7 @@
 #include <CGAL/squared_distance_3.h>
 #include <CGAL/number_utils.h>
 #include <CGAL/Default.h>
+#include <CGAL/tags.h>
 
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
@@ -34,8 +35,15 @@
 #include <CGAL/Weights/utils.h>
 #include <boost/range/has_range_iterator.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <iterator>
 #include <vector>
 #include <set>
+#include <type_traits>
 
 namespace CGAL {
 
@@ -286,14 +294,21 @@ private:
 
   void
   compute_unit_gradient()
+  {
+    compute_unit_gradient(m_solved_u, m_X);
+  }
+
+  // computes in `X` the normalized gradient of the heat `u` in each face
+  void
+  compute_unit_gradient(const Vector& u, std::vector<Vector_3>& X) const
   {
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
     typename Traits::Construct_sum_of_vectors_3 sum = Traits().construct_sum_of_vectors_3_object();
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_cross_product_vector_3 cross_product = Traits().construct_cross_product_vector_3_object();
     typename Traits::Construct_scaled_vector_3 scale = Traits().construct_scaled_vector_3_object();
-    if(m_X.empty()){
-      m_X.resize(num_faces(tm));
+    if(X.empty()){
+      X.resize(num_faces(tm));
     }
     CGAL::Vertex_around_face_iterator<TriangleMesh> vbegin, vend, vmiddle;
     for(face_descriptor f : faces(tm)) {
@@ -323,9 +338,9 @@ private:
       double N_cross = (CGAL::sqrt(to_double(scalar_product(cross,cross))));
       Vector_3 unit_cross = scale(cross, 1./N_cross);
       double area_face = N_cross * (1./2);
-      double u_i = CGAL::abs(m_solved_u(i));
-      double u_j = CGAL::abs(m_solved_u(j));
-      double u_k = CGAL::abs(m_solved_u(k));
+      double u_i = CGAL::abs(u(i));
+      double u_j = CGAL::abs(u(j));
+      double u_k = CGAL::abs(u(k));
       double r_Mag = 1./(std::max)((std::max)(u_i, u_j),u_k);
       /* normalize heat values so that they have roughly unit magnitude */
       if(!std::isinf(r_Mag)) {
@@ -338,16 +353,23 @@ private:
       edge_sums = sum(edge_sums, scale(cross_product(unit_cross, construct_vector(p_k,p_i)), u_j));
       edge_sums = scale(edge_sums, (1./area_face));
       double e_magnitude = CGAL::sqrt(to_double(scalar_product(edge_sums,edge_sums)));
-      m_X[face_i] = scale(edge_sums,(1./e_magnitude));
+      X[face_i] = scale(edge_sums,(1./e_magnitude));
     }
   }
 
   void
   compute_divergence()
+  {
+    compute_divergence(m_X, m_index_divergence);
+  }
+
+  // computes in `divergence` the integrated divergence of the field `X` at each vertex
+  void
+  compute_divergence(const std::vector<Vector_3>& X, Vector& divergence) const
   {
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
-    Matrix indexD(dimension,1);
+    Vector indexD(dimension);
     CGAL::Vertex_around_face_iterator<TriangleMesh> vbegin, vend, vmiddle;
     for(face_descriptor f : faces(tm)) {
       boost::tie(vbegin, vend) = vertices_around_face(halfedge(f,tm),tm);
@@ -374,7 +396,7 @@ private:
       const FT cotan_j = CGAL::Weights::cotangent(p_k, p_j, p_i, traits);
       const FT cotan_k = CGAL::Weights::cotangent(p_j, p_k, p_i, traits);
 
-      const Vector_3& a = m_X[face_i];
+      const Vector_3& a = X[face_i];
       const double i_entry = (CGAL::to_double(scalar_product(a, v_ij) * cotan_k)) +
                              (CGAL::to_double(scalar_product(a, v_ik) * cotan_j));
       const double j_entry = (CGAL::to_double(scalar_product(a, v_jk) * cotan_i)) +
@@ -382,19 +404,32 @@ private:
       const double k_entry = (CGAL::to_double(scalar_product(a, v_ki) * cotan_j)) +
                              (CGAL::to_double(scalar_product(a, v_kj) * cotan_i));
 
-      indexD.add_coef(i, 0, (1./2)*i_entry);
-      indexD.add_coef(j, 0, (1./2)*j_entry);
-      indexD.add_coef(k, 0, (1./2)*k_entry);
+      indexD(i) += (1./2)*i_entry;
+      indexD(j) += (1./2)*j_entry;
+      indexD(k) += (1./2)*k_entry;
     }
-    indexD.swap(m_index_divergence);
+    indexD.swap(divergence);
   }
 
   // modifies m_solved_phi
   void
   value_at_source_set(const Vector& phi)
+  {
+    std::vector<Index> source_indices;
+    for(vertex_descriptor vd : sources()){
+      source_indices.push_back(get(vertex_id_map, vd));
+    }
+    value_at_source_set(source_indices, phi, m_solved_phi);
+  }
+
+  // computes in `distances` the distances given by `phi` to the closest
+  // vertex of index in `source_indices`
+  void
+  value_at_source_set(const std::vector<Index>& source_indices,
+                      const Vector& phi, Vector& distances) const
   {
     Vector source_set_val(dimension);
-    if(sources().empty()) {
+    if(source_indices.empty()) {
       for(int k = 0; k<dimension; k++) {
         source_set_val(k,0) = phi.coeff(0,0);
       }
@@ -402,10 +437,8 @@ private:
     } else {
       for(int i = 0; i<dimension; i++) {
         double min_val = (std::numeric_limits<double>::max)();
-        Index vd_index;
         //go through the distances to the sources and leave the minimum distance;
-        for(vertex_descriptor vd : sources()){
-          vd_index = get(vertex_id_map, vd);
+        for(Index vd_index : source_indices){
           double new_d = CGAL::abs(-phi.coeff(vd_index,0)+phi.coeff(i,0));
           if(phi.coeff(vd_index,0)==phi.coeff(i,0)) {
             min_val = 0.;
@@ -417,7 +450,7 @@ private:
         source_set_val(i,0) = min_val;
       }
     }
-    m_solved_phi.swap(source_set_val);
+    distances.swap(source_set_val);
   }
 
   void
@@ -477,6 +510,82 @@ public:
     }
   }
 
+  /**
+   *  Fills a distance property map per source set, leaving the current source set unchanged.
+   *  The factorizations are shared by all the source sets, and only the right-hand sides differ.
+   *  `make_vdm` converts the elements of `vdms` into distance maps of `tm`.
+   **/
+  template <typename ConcurrencyTag, typename SourceSetRange, typename VertexDistanceMapRange,
+            typename MakeVertexDistanceMap>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms,
+                                   MakeVertexDistanceMap make_vdm)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    if(is_empty(tm)){
+      return;
+    }
+
+    // gather the indices of the sources and the maps, for a random access
+    std::vector<std::vector<Index> > source_indices;
+    for(const auto& source_set : source_sets){
+      source_indices.emplace_back();
+      for(const auto& vd : source_set){
+        source_indices.back().push_back(get(vertex_id_map, v2v(vd)));
+      }
+    }
+    std::vector<typename VertexDistanceMapRange::value_type> maps(std::begin(vdms), std::end(vdms));
+    CGAL_precondition(maps.size() == source_indices.size());
+
+    auto estimate = [&](std::size_t s, std::vector<Vector_3>& X)
+    {
+      // same steps as the single source set computation, with local storage
+      Vector kronecker(dimension), solved_u, divergence, phi, distances;
+      if(source_indices[s].empty()) {
+        kronecker.set(0, 1);
+      } else {
+        for(Index i : source_indices[s]){
+          kronecker.set(i, 1);
+        }
+      }
+      if(! la.linear_solver(kronecker, solved_u)) {
+        CGAL_error_msg("Eigen Solving in cotan failed");
+      }
+      compute_unit_gradient(solved_u, X);
+      compute_divergence(X, divergence);
+      if(! la_cotan.linear_solver(divergence, phi)) {
+        CGAL_error_msg("Eigen Solving in solve_phi() failed");
+      }
+      value_at_source_set(source_indices[s], phi, distances);
+
+      auto vdm = make_vdm(maps[s]);
+      for(vertex_descriptor vd : vertices(tm)){
+        put(vdm, vd, distances(get(vertex_id_map, vd), 0));
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, maps.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        std::vector<Vector_3> X;
+        for(std::size_t s = r.begin(); s != r.end(); ++s){
+          estimate(s, X);
+        }
+      });
+      return;
+    }
+#endif
+    std::vector<Vector_3> X;
+    for(std::size_t s = 0; s < maps.size(); ++s){
+      estimate(s, X);
+    }
+  }
+
 private:
   void
   build()
@@ -589,7 +698,7 @@ private:
   Matrix m_mass_matrix, m_cotan_matrix;
   Vector m_solved_u;
   std::vector<Vector_3> m_X;
-  Matrix m_index_divergence;
+  Vector m_index_divergence;
   Vector m_solved_phi;
   bool m_source_change_flag;
 
@@ -631,6 +740,17 @@ struct Base_helper
         base().triangle_mesh(), Traits()));
     base().estimate_geodesic_distances(vdm);
   }
+
+  template <typename ConcurrencyTag, typename SourceSetRange, typename VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    CGAL_assertion(
+      !CGAL::Heat_method_3::internal::has_degenerate_faces(
+        base().triangle_mesh(), Traits()));
+    base().template estimate_geodesic_distances<ConcurrencyTag>(
+      source_sets, vdms, [](const auto& vdm) { return vdm; });
+  }
 };
 
 template<class TriangleMesh,
@@ -690,6 +810,15 @@ struct Base_helper<TriangleMesh, Traits, Intrinsic_Delaunay, LA, VertexPointMap>
   {
     base().estimate_geodesic_distances(this->m_idt.vertex_distance_map(vdm));
   }
+
+  template <typename ConcurrencyTag, typename SourceSetRange, typename VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    base().template estimate_geodesic_distances<ConcurrencyTag>(
+      source_sets, vdms,
+      [this](const auto& vdm) { return this->m_idt.vertex_distance_map(vdm); });
+  }
 };
 
 } // namespace internal
@@ -885,6 +1014,35 @@ public:
   {
     Base_helper::estimate_geodesic_distances(vdm);
   }
+
+  /**
+   * fills, for each source set of `source_sets`, the corresponding distance property map of `vdms`
+   * with the estimated geodesic distance of each vertex to the closest vertex of the source set.
+   * The source set of this object is neither used nor modified.
+   * The matrices factorized at construction are shared by all the source sets, so that this is
+   * much faster than changing the source set and calling `estimate_geodesic_distances(vdm)` for each of them.
+   *
+   * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+   *                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+   *                        With `Parallel_tag`, the source sets are processed concurrently.
+   * \tparam SourceSetRange a model of the concept `ConstRange` whose value type is a model of
+   *                        the concept `ConstRange` with value type `vertex_descriptor`
+   * \tparam VertexDistanceMapRange a model of the concept `ConstRange` whose value type is a property map
+   *                        model of `WritablePropertyMap` with `vertex_descriptor` as key type and `double` as value type
+   * \param source_sets the source sets
+   * \param vdms the vertex distance maps to be filled, one per source set
+   * \pre `source_sets` and `vdms` have the same size.
+   * \pre If `Mode` is `Direct`, the support triangle mesh does not have any degenerate faces
+   * \pre With `Parallel_tag`, `LA::linear_solver()` can be called concurrently after the factorization,
+   *      which is the case of the direct solvers of \ref thirdpartyEigen "Eigen".
+   **/
+  template <typename ConcurrencyTag = Sequential_tag,
+            typename SourceSetRange, typename VertexDistanceMapRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexDistanceMapRange& vdms)
+  {
+    Base_helper::template estimate_geodesic_distances<ConcurrencyTag>(source_sets, vdms);
+  }
 };
 
 #if defined(DOXYGEN_RUNNING) || defined(CGAL_EIGEN3_ENABLED)
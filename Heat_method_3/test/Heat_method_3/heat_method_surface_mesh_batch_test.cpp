@@ -0,0 +1,96 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Heat_method_3/Surface_mesh_geodesic_distances_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+
+typedef CGAL::Simple_cartesian<double>                       Kernel;
+typedef Kernel::Point_3                                      Point_3;
+typedef CGAL::Surface_mesh<Point_3>                          Surface_mesh;
+
+typedef boost::graph_traits<Surface_mesh>::vertex_descriptor vertex_descriptor;
+typedef Surface_mesh::Property_map<vertex_descriptor,double> Vertex_distance_map;
+
+
+// compares the batched estimation with the estimation of one source set at a time
+template <typename Mode, typename ConcurrencyTag>
+void test_batch(Surface_mesh& sm,
+                const std::vector<std::vector<vertex_descriptor> >& source_sets)
+{
+  typedef CGAL::Heat_method_3::Surface_mesh_geodesic_distances_3<Surface_mesh, Mode> Heat_method;
+
+  Heat_method hm(sm);
+  std::vector<Vertex_distance_map> expected, batched;
+  for(std::size_t i = 0; i < source_sets.size(); ++i){
+    expected.push_back(sm.add_property_map<vertex_descriptor, double>("v:expected_" + std::to_string(i), 0).first);
+    batched.push_back(sm.add_property_map<vertex_descriptor, double>("v:batched_" + std::to_string(i), 0).first);
+    hm.clear_sources();
+    hm.add_sources(source_sets[i]);
+    hm.estimate_geodesic_distances(expected[i]);
+  }
+
+  // the source set of the object is left unchanged
+  hm.template estimate_geodesic_distances<ConcurrencyTag>(source_sets, batched);
+  assert(hm.sources().size() == source_sets.back().size());
+
+  for(std::size_t i = 0; i < source_sets.size(); ++i){
+    for(vertex_descriptor vd : vertices(sm)){
+      assert(std::abs(get(expected[i], vd) - get(batched[i], vd)) < 1e-8);
+    }
+    for(vertex_descriptor vd : source_sets[i]){
+      assert(get(batched[i], vd) == 0);
+    }
+    sm.remove_property_map(expected[i]);
+    sm.remove_property_map(batched[i]);
+  }
+}
+
+template <typename ConcurrencyTag>
+void test_modes(Surface_mesh& sm,
+                const std::vector<std::vector<vertex_descriptor> >& source_sets)
+{
+  test_batch<CGAL::Heat_method_3::Direct, ConcurrencyTag>(sm, source_sets);
+  test_batch<CGAL::Heat_method_3::Intrinsic_Delaunay, ConcurrencyTag>(sm, source_sets);
+}
+
+int main(int argc, char* argv[])
+{
+  //read in mesh
+  Surface_mesh sm;
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/larger_sphere.off");
+  std::ifstream in(filename);
+  in >> sm;
+
+  // single sources and sets of several sources
+  std::vector<vertex_descriptor> vds(vertices(sm).begin(), vertices(sm).end());
+  std::vector<std::vector<vertex_descriptor> > source_sets;
+  for(std::size_t i = 0; i < 10; ++i){
+    source_sets.push_back(std::vector<vertex_descriptor>(1, vds[(i * 97) % vds.size()]));
+  }
+  for(std::size_t i = 0; i < 5; ++i){
+    source_sets.push_back(std::vector<vertex_descriptor>());
+    for(std::size_t j = 0; j < 3; ++j){
+      source_sets.back().push_back(vds[(i * 31 + j * 53) % vds.size()]);
+    }
+  }
+
+  test_modes<CGAL::Sequential_tag>(sm, source_sets);
+#ifdef CGAL_LINKED_WITH_TBB
+  // process several source sets concurrently, whatever the number of cores
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test_modes<CGAL::Parallel_tag>(sm, source_sets); });
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,89 @@
+
+namespace CGAL {
+
+/*!
+\ingroup kernel_classes
+
+The kernel `CGAL::Exact_predicates_exact_constructions_kernel` and the number type
+`CGAL::Lazy_exact_nt` record each construction in a node of a directed acyclic graph,
+so that its exact value can be computed later if needed. By default, each node is
+allocated with the global `operator new`.
+
+If the macro `CGAL_LAZY_NODE_ARENA` is defined before including any \cgal header, the nodes
+created by a thread while an object of type `Lazy_node_arena` exists in this thread are
+allocated in large chunks owned by this object. The memory of the nodes destroyed in the thread
+of the arena while it exists is reused, and the chunks are released all at once, when the arena
+has been destroyed and all nodes allocated in it have been destroyed. Objects created in the scope
+of an arena can therefore be used after the end of this scope, or by other threads, but they keep
+the memory of the whole arena alive.
+
+Arenas can be nested, in which case the innermost one is used.
+If `CGAL_LAZY_NODE_ARENA` is not defined, this class has no effect.
+
+\cgalHeading{Example}
+
+\code
+#define CGAL_LAZY_NODE_ARENA
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Lazy_node_arena.h>
+
+{
+  CGAL::Lazy_node_arena arena;
+  // computations with `CGAL::Exact_predicates_exact_constructions_kernel`
+  std::cout << arena.statistics().allocated_nodes << " nodes" << std::endl;
+}
+\endcode
+
+\sa `CGAL::Lazy_node_arena_statistics`
+*/
+class Lazy_node_arena {
+public:
+
+/// \name Creation
+/// @{
+
+/*!
+creates an arena and makes it the active arena of the current thread.
+*/
+Lazy_node_arena();
+
+/*!
+restores the arena that was active when this arena was created.
+\pre This arena is the active arena of the current thread.
+*/
+~Lazy_node_arena();
+
+/// @}
+
+/// \name Access Functions
+/// @{
+
+/*!
+returns the statistics of the allocations and exact evaluations done
+by the thread of the arena while it is active.
+*/
+const Lazy_node_arena_statistics& statistics() const;
+
+/// @}
+
+}; /* end Lazy_node_arena */
+
+/*!
+\ingroup kernel_classes
+
+Counters of a `CGAL::Lazy_node_arena`.
+*/
+struct Lazy_node_arena_statistics {
+  /// number of nodes and exact values allocated in the arena
+  std::size_t allocated_nodes;
+  /// number of allocations that reused the memory of a destroyed node
+  std::size_t reused_nodes;
+  /// total size in bytes of the allocated nodes
+  std::size_t allocated_bytes;
+  /// total size in bytes of the chunks reserved by the arena
+  std::size_t reserved_bytes;
+  /// number of times the exact value of a node has been computed
+  std::size_t exact_evaluations;
+};
+
+} /* end namespace CGAL */
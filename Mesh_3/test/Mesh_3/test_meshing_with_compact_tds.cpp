@@ -0,0 +1,77 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Mesh_triangulation_3.h>
+#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
+#include <CGAL/Mesh_criteria_3.h>
+#include <CGAL/Mesh_cell_base_3.h>
+#include <CGAL/Mesh_vertex_base_3.h>
+#include <CGAL/Labeled_mesh_domain_3.h>
+#include <CGAL/make_mesh_3.h>
+
+#include <CGAL/Compact_triangulation_ds_cell_base_3.h>
+#include <CGAL/Compact_triangulation_ds_vertex_base_3.h>
+
+#include <cassert>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel         K;
+typedef K::FT                                                       FT;
+typedef K::Point_3                                                  Point;
+typedef CGAL::Labeled_mesh_domain_3<K>                              Mesh_domain;
+typedef CGAL::details::Mesh_geom_traits_generator<K>::type          Gt;
+
+// Mesh vertices and cells built on the TDS bases storing 32-bit indices
+typedef CGAL::Mesh_vertex_base_3<
+          Gt, Mesh_domain,
+          CGAL::Regular_triangulation_vertex_base_3<
+            Gt, CGAL::Compact_triangulation_ds_vertex_base_3<> > > Compact_vb;
+typedef CGAL::Mesh_cell_base_3<
+          Gt, Mesh_domain,
+          CGAL::Regular_triangulation_cell_base_with_weighted_circumcenter_3<
+            Gt, CGAL::Regular_triangulation_cell_base_3<
+                  Gt, CGAL::Triangulation_cell_base_3<
+                        Gt, CGAL::Compact_triangulation_ds_cell_base_3<> > > > >
+                                                                    Compact_cb;
+
+FT sphere_function(const Point& p)
+{ return CGAL::squared_distance(p, Point(CGAL::ORIGIN)) - 1; }
+
+template <class Vb, class Cb>
+std::size_t mesh_sphere()
+{
+  typedef typename CGAL::Mesh_triangulation_3<Mesh_domain, CGAL::Default,
+                                              CGAL::Sequential_tag, Vb, Cb>::type Tr;
+  typedef CGAL::Mesh_complex_3_in_triangulation_3<Tr>               C3t3;
+  typedef CGAL::Mesh_criteria_3<Tr>                                 Mesh_criteria;
+
+  Mesh_domain domain =
+    Mesh_domain::create_implicit_mesh_domain(sphere_function,
+                                             K::Sphere_3(CGAL::ORIGIN, FT(2)));
+
+  namespace params = CGAL::parameters;
+  Mesh_criteria criteria(params::facet_angle(30).facet_size(0.2).facet_distance(0.05).
+                         cell_radius_edge_ratio(2).cell_size(0.2));
+
+  C3t3 c3t3 = CGAL::make_mesh_3<C3t3>(domain, criteria,
+                                      params::no_perturb().no_exude());
+
+  assert(c3t3.triangulation().is_valid());
+  assert(c3t3.is_valid());
+  std::cout << c3t3.triangulation().number_of_vertices() << " vertices, "
+            << c3t3.number_of_cells_in_complex() << " cells in complex, "
+            << sizeof(typename Tr::Cell) << " bytes per cell" << std::endl;
+  return c3t3.number_of_cells_in_complex();
+}
+
+int main()
+{
+  std::size_t expected = mesh_sphere<CGAL::Mesh_vertex_base_3<Gt, Mesh_domain>,
+                                     CGAL::Mesh_cell_base_3<Gt, Mesh_domain> >();
+
+  // the sequential meshing does not depend on how the handles are stored
+  std::size_t n = mesh_sphere<Compact_vb, Compact_cb>();
+  assert(n == expected);
+
+  std::cout << "Done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,75 @@
+// Times the union of two sets of overlapping convex parts, with the
+// sequential and the parallel Boolean operations of `Nef_polyhedron_3`.
+//
+// Usage: parallel_binop [number of parts per operand]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Polyhedron_3<Kernel> Polyhedron;
+typedef CGAL::Nef_polyhedron_3<Kernel> Nef_polyhedron;
+
+// the convex hull of random points in a cube, which gives facets and
+// edges in general position
+Nef_polyhedron random_part(CGAL::Random& rnd, double x, double y, double z)
+{
+  std::vector<Point_3> pts;
+  for(int i = 0; i < 40; ++i)
+    pts.emplace_back(x + rnd.get_double(0, 2), y + rnd.get_double(0, 2), z + rnd.get_double(0, 2));
+  Polyhedron P;
+  CGAL::convex_hull_3(pts.begin(), pts.end(), P);
+  return Nef_polyhedron(P);
+}
+
+Nef_polyhedron random_operand(CGAL::Random& rnd, int nb_parts)
+{
+  Nef_polyhedron N;
+  for(int i = 0; i < nb_parts; ++i)
+    N += random_part(rnd, 3 * i, rnd.get_double(0, 1), rnd.get_double(0, 1));
+  return N;
+}
+
+template <class ConcurrencyTag>
+Nef_polyhedron bench(const std::string& name, const Nef_polyhedron& N0, const Nef_polyhedron& N1)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  Nef_polyhedron res = N0.join(N1, ConcurrencyTag());
+  timer.stop();
+  std::cout << name << " union: " << timer.time() << " sec. ("
+            << res.number_of_vertices() << " vertices)" << std::endl;
+  return res;
+}
+
+int main(int argc, char** argv)
+{
+  const int nb_parts = (argc > 1) ? std::stoi(argv[1]) : 8;
+
+  CGAL::Random rnd(0);
+  Nef_polyhedron N0 = random_operand(rnd, nb_parts);
+  Nef_polyhedron N1 = random_operand(rnd, nb_parts);
+  std::cout << N0.number_of_vertices() << " and " << N1.number_of_vertices()
+            << " vertices" << std::endl;
+
+  Nef_polyhedron seq = bench<CGAL::Sequential_tag>("sequential", N0, N1);
+#ifdef CGAL_LINKED_WITH_TBB
+  Nef_polyhedron par = bench<CGAL::Parallel_tag>("parallel  ", N0, N1);
+  if(!seq.symmetric_difference(par).is_empty())
+  {
+    std::cerr << "Error: different results" << std::endl;
+    return EXIT_FAILURE;
+  }
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,52 @@
+// Times the construction of a `Nef_polyhedron_3` from a triangulated
+// sphere, and of the union of two such polyhedra.
+//
+// Usage: polygon_mesh_to_nef [number of points on the sphere]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+typedef CGAL::Nef_polyhedron_3<Kernel> Nef_polyhedron;
+
+int main(int argc, char** argv)
+{
+  const int nb_points = (argc > 1) ? std::stoi(argv[1]) : 5000;
+
+  CGAL::Random_points_on_sphere_3<Point_3> gen(1.);
+  std::vector<Point_3> pts;
+  for(int i = 0; i < nb_points; ++i)
+    pts.push_back(*gen++);
+  Mesh m0, m1;
+  CGAL::convex_hull_3(pts.begin(), pts.end(), m0);
+  m1 = m0;
+  for(Mesh::Vertex_index v : m1.vertices())
+    m1.point(v) = m1.point(v) + Kernel::Vector_3(0.5, 0.25, 0.125);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Nef_polyhedron N0(m0);
+  timer.stop();
+  std::cout << "construction: " << timer.time() << " sec. ("
+            << num_faces(m0) << " faces)" << std::endl;
+
+  Nef_polyhedron N1(m1);
+  timer.reset();
+  timer.start();
+  Nef_polyhedron N = N0 + N1;
+  timer.stop();
+  std::cout << "union:        " << timer.time() << " sec. ("
+            << N.number_of_vertices() << " vertices)" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -1453,6 +1453,31 @@ public:
 */
   Nef_polyhedron_3<Traits> symmetric_difference(const Nef_polyhedron_3<Traits>& N1) const;
 
+/*!
+  same as the four functions above, with the Boolean operation computed
+  in parallel if `ConcurrencyTag` is `Parallel_tag`: the local views of
+  the vertices of both operands and of the intersection points of their
+  edges and facets are then computed concurrently. The result is the same
+  as with `Sequential_tag`.
+
+  \tparam ConcurrencyTag either `Sequential_tag` or `Parallel_tag`.
+  `Parallel_tag` requires \ref thirdpartyTBB.
+*/
+  template <class ConcurrencyTag>
+  Nef_polyhedron_3<Traits> intersection(const Nef_polyhedron_3<Traits>& N1, ConcurrencyTag tag) const;
+
+/// \copydoc intersection(const Nef_polyhedron_3<Traits>&, ConcurrencyTag) const
+  template <class ConcurrencyTag>
+  Nef_polyhedron_3<Traits> join(const Nef_polyhedron_3<Traits>& N1, ConcurrencyTag tag) const;
+
+/// \copydoc intersection(const Nef_polyhedron_3<Traits>&, ConcurrencyTag) const
+  template <class ConcurrencyTag>
+  Nef_polyhedron_3<Traits> difference(const Nef_polyhedron_3<Traits>& N1, ConcurrencyTag tag) const;
+
+/// \copydoc intersection(const Nef_polyhedron_3<Traits>&, ConcurrencyTag) const
+  template <class ConcurrencyTag>
+  Nef_polyhedron_3<Traits> symmetric_difference(const Nef_polyhedron_3<Traits>& N1, ConcurrencyTag tag) const;
+
 /*!
   returns intersection of `N` with
   plane (`im=PLANE_ONLY`), open halfspace (`im=OPEN_HALFSPACE`), or closed
@@ -32,8 +32,18 @@
 #include <CGAL/Nef_3/SNC_point_locator.h>
 #include <CGAL/Nef_3/binop_intersection_tests.h>
 #include <CGAL/Nef_3/ID_support_handler.h>
+#include <CGAL/tags.h>
 //#include <CGAL/Nef_3/Edge_edge_overlay.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <mutex>
+#endif
+
+#include <type_traits>
+#include <vector>
+
 #undef CGAL_NEF_DEBUG
 #define CGAL_NEF_DEBUG 19
 #include <CGAL/Nef_2/debug.h>
@@ -236,6 +246,180 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     Association& A;
   };
 
+  template <typename Selection, typename Association_>
+  Vertex_handle qualify_vertex_of_first( Vertex_const_handle v0, Object_handle o,
+                                         const Selection& BOP, Association_& A)
+    /*{\opAdds to the result the local view of the vertex |v0| of the
+    first operand, located at |o| in the second operand. Returns the
+    vertex of the second operand at the same point, if any.}*/ {
+    Vertex_handle v;
+    Halfedge_handle e;
+    Halffacet_handle f;
+    Volume_handle c;
+    Point_3 p0(v0->point());
+    if( CGAL::assign( v, o)) {
+      CGAL_NEF_TRACEN("p0 found on vertex");
+      binop_local_views( v0, v, BOP, *this->sncp(),A);
+      return v;
+    }
+    else if( CGAL::assign( e, o)) {
+      CGAL_NEF_TRACEN("p0 found on edge");
+      Vertex_handle v1 = create_local_view_on( p0, e);
+      binop_local_views( v0, v1, BOP, *this->sncp(),A);
+      this->sncp()->delete_vertex(v1);
+    }
+    else if( CGAL::assign( f, o)) {
+      CGAL_NEF_TRACEN("p0 found on facet" << f->plane());
+      Vertex_handle v1 = create_local_view_on( p0, f);
+      binop_local_views( v0, v1, BOP, *this->sncp(),A);
+      this->sncp()->delete_vertex(v1);
+    }
+    else if( CGAL::assign( c, o)) {
+      CGAL_NEF_TRACEN("p0 found on volume with mark " << c->mark());
+#ifdef CGAL_NEF3_OVERLAY_IF_NEEDED_OFF
+      if(true) {
+#else
+      if( BOP( true, c->mark()) != BOP( false, c->mark())) {
+#endif
+#ifdef CGAL_NEF3_OVERLAY_BY_HAND_OFF
+        Vertex_handle v1 = create_local_view_on( p0, c);
+        binop_local_views( v0, v1, BOP, *this->sncp(),A);
+        this->sncp()->delete_vertex(v1);
+#else
+        SNC_constructor C(*this->sncp());
+        Vertex_handle v1 = C.clone_SM(v0);
+        SM_decorator SM(&*v1);
+        SM.change_marks(BOP, c->mark());
+        SM_overlayer O(&*v1);
+        O.simplify(A);
+#endif
+      } else {
+        CGAL_NEF_TRACEN("vertex in volume deleted " << std::endl <<
+               "  vertex: " <<  v0->point() << std::endl <<
+               "  mark of volume: " << c->mark());
+      }
+    }
+    else CGAL_error_msg( "wrong handle");
+    return Vertex_handle();
+  }
+
+  template <typename Selection, typename Association_>
+  void qualify_vertex_of_second( Vertex_const_handle v0, Object_handle o,
+                                 const Selection& BOP, Association_& A)
+    /*{\opAdds to the result the local view of the vertex |v0| of the
+    second operand, located at |o| in the first operand.
+    \precondition: |o| is not a vertex.}*/ {
+    Halfedge_handle e;
+    Halffacet_handle f;
+    Volume_handle c;
+    Point_3 p1(v0->point());
+
+    CGAL_assertion_code(Vertex_handle v);
+    CGAL_assertion( !CGAL::assign( v, o));
+
+    if( CGAL::assign( e, o)) {
+      CGAL_NEF_TRACEN("p1 found on edge");
+      Vertex_handle v1 = create_local_view_on( p1, e);
+      binop_local_views( v1, v0, BOP, *this->sncp(),A);
+      this->sncp()->delete_vertex(v1);
+    }
+    else if( CGAL::assign( f, o)) {
+      CGAL_NEF_TRACEN("p1 found on facet");
+      Vertex_handle v1 = create_local_view_on( p1, f);
+      binop_local_views( v1, v0, BOP, *this->sncp(),A);
+      this->sncp()->delete_vertex(v1);
+    }
+    else if( CGAL::assign( c, o)) {
+      CGAL_NEF_TRACEN("p1 found on volume with mark " << c->mark());
+#ifdef CGAL_NEF3_OVERLAY_IF_NEEDED_OFF
+      if(true)
+#else
+      if( BOP( c->mark(), true) != BOP( c->mark(), false))
+#endif
+      {
+#ifdef CGAL_NEF3_OVERLAY_BY_HAND_OFF
+        Vertex_handle v1 = create_local_view_on( p1, c);
+        binop_local_views( v1, v0, BOP, *this->sncp(),A);
+        this->sncp()->delete_vertex(v1);
+#else
+        SNC_constructor C(*this->sncp());
+        Vertex_handle v1 = C.clone_SM(v0);
+        SM_decorator SM(&*v1);
+        SM.change_marks(c->mark(), BOP);
+        SM_overlayer O(&*v1);
+        O.simplify(A);
+#endif
+      } else {
+        CGAL_NEF_TRACEN("vertex in volume deleted " << std::endl <<
+                        "  vertex: " <<  v0->point() << std::endl <<
+                        "  mark of volume: " << c->mark());
+      }
+    }
+    else CGAL_error_msg( "wrong handle");
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // Gives the threads exclusive access to the association of the
+  // support items. Unlike `Association::set_hash()`, `set_hash()`
+  // links the roots of both classes: another thread may have merged
+  // classes since the caller has read `parent`, and the smaller root
+  // must remain the representative to keep the union-find acyclic.
+  class Locked_association {
+    Association& A;
+    std::mutex mutex;
+
+  public:
+    Locked_association(Association& A) : A(A) {}
+
+    template <typename... Args>
+    void handle_support(const Args&... args) {
+      std::lock_guard<std::mutex> lock(mutex);
+      A.handle_support(args...);
+    }
+
+    template <typename... Args>
+    void hash_facet_pair(const Args&... args) {
+      std::lock_guard<std::mutex> lock(mutex);
+      A.hash_facet_pair(args...);
+    }
+
+    int get_hash(int i) {
+      std::lock_guard<std::mutex> lock(mutex);
+      return A.get_hash(i);
+    }
+
+    void set_hash(int i, int parent) {
+      std::lock_guard<std::mutex> lock(mutex);
+      int root = A.get_hash(i);
+      parent = A.get_hash(parent);
+      if(parent < root)
+        A.set_hash(root, parent);
+      else if(root < parent)
+        A.set_hash(parent, root);
+    }
+  };
+
+  // Calls `f(D, i)` for all `i` in `[0, n)` in parallel. `D` is a
+  // `Binary_operation` on a structure private to a range of indices.
+  // The vertices created in these structures are then moved to the
+  // result, in the order of the indices, so that the result does not
+  // depend on the scheduling.
+  template <typename Function>
+  void parallel_local_views(std::size_t n, const Function& f) {
+    if(n == 0) return;
+    const std::size_t nb_ranges =
+      (std::min)(n, std::size_t(8 * tbb::this_task_arena::max_concurrency()));
+    std::vector<SNC_structure> views(nb_ranges);
+    tbb::parallel_for(std::size_t(0), nb_ranges, [&](std::size_t r) {
+      Binary_operation D(views[r]);
+      for(std::size_t i = r * n / nb_ranges; i < (r + 1) * n / nb_ranges; ++i)
+        f(D, i);
+    });
+    for(SNC_structure& view : views)
+      this->sncp()->splice_local_views(view);
+  }
+#endif
+
   template <typename Selection>
     void operator()( SNC_point_locator* pl0,
                      const SNC_structure& snc1,
@@ -243,11 +427,30 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
                      const SNC_structure& snc2,
                      const SNC_point_locator* pl2,
                      const Selection& BOP)
+  {
+    (*this)(pl0, snc1, pl1, snc2, pl2, BOP, Sequential_tag());
+  }
+
+  template <typename Selection, typename ConcurrencyTag>
+    void operator()( SNC_point_locator* pl0,
+                     const SNC_structure& snc1,
+                     const SNC_point_locator* pl1,
+                     const SNC_structure& snc2,
+                     const SNC_point_locator* pl2,
+                     const Selection& BOP,
+                     ConcurrencyTag)
       /*{\opPerforms a binary operation defined on |BOP| between two
       SNC structures.  The input structures are not modified and the
-      result of the operation is stored in |result|.
+      result of the operation is stored in |result|. With |Parallel_tag|,
+      the local views of the vertices and of the intersection points of
+      edges and facets are computed in parallel.
       \precondition: the structure |result| is empty.}*/
   {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     //    CGAL_NEF_SETDTHREAD(23);
     CGAL_assertion( this->sncp()->is_empty());
     CGAL_assertion( pl1 != nullptr && pl2 != nullptr);
@@ -306,146 +509,85 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     CGAL_forall_shalfloops(sli, snc2)
       A.initialize_hash(sli);
 
-    CGAL_forall_vertices( v0, snc1) {
-      CGAL_assertion(!ignore[v0]);
-      Point_3 p0(v0->point());
-      Vertex_handle v;
-      Halfedge_handle e;
-      Halffacet_handle f;
-      Volume_handle c;
-      CGAL_NEF_TRACEN("Locating point " << p0);
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      Locked_association LA(A);
+      std::vector<Vertex_const_handle> vertices;
+      vertices.reserve(snc1.number_of_vertices());
+      CGAL_forall_vertices( v0, snc1)
+        vertices.push_back(v0);
+      std::vector<Vertex_handle> vertices_found(vertices.size());
+      parallel_local_views(vertices.size(), [&](Binary_operation& D, std::size_t i) {
+        vertices_found[i] = D.qualify_vertex_of_first(vertices[i], pl2->locate(vertices[i]->point()), BOP, LA);
+      });
+      for(Vertex_handle v : vertices_found)
+        if(v != Vertex_handle())
+          ignore[v] = true;
+
+      CGAL_NEF_TRACEN("=> for all v1 in snc1, qualify v1 with respect snc0");
+      vertices.clear();
+      CGAL_forall_vertices( v0, snc2)
+        if(!ignore[v0])
+          vertices.push_back(v0);
+      parallel_local_views(vertices.size(), [&](Binary_operation& D, std::size_t i) {
+        D.qualify_vertex_of_second(vertices[i], pl1->locate(vertices[i]->point()), BOP, LA);
+      });
+    } else
+#endif
+    {
+      CGAL_forall_vertices( v0, snc1) {
+        CGAL_assertion(!ignore[v0]);
+        Point_3 p0(v0->point());
+        CGAL_NEF_TRACEN("Locating point " << p0);
 
 #ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      ++number_of_point_location_queries;
-      timer_point_location.start();
+        ++number_of_point_location_queries;
+        timer_point_location.start();
 #endif
-      Object_handle o = pl2->locate(p0);
+        Object_handle o = pl2->locate(p0);
 #ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      timer_point_location.stop();
+        timer_point_location.stop();
 #endif
 
 #if defined(CGAL_NEF3_TIMER_OVERLAY)
-      timer_overlay.start();
+        timer_overlay.start();
 #endif
-      if( CGAL::assign( v, o)) {
-        CGAL_NEF_TRACEN("p0 found on vertex");
-        binop_local_views( v0, v, BOP, *this->sncp(),A);
-        ignore[v] = true;
-      }
-      else if( CGAL::assign( e, o)) {
-        CGAL_NEF_TRACEN("p0 found on edge");
-        Vertex_handle v1 = create_local_view_on( p0, e);
-        binop_local_views( v0, v1, BOP, *this->sncp(),A);
-        this->sncp()->delete_vertex(v1);
-      }
-      else if( CGAL::assign( f, o)) {
-        CGAL_NEF_TRACEN("p0 found on facet" << f->plane());
-        Vertex_handle v1 = create_local_view_on( p0, f);
-        binop_local_views( v0, v1, BOP, *this->sncp(),A);
-        this->sncp()->delete_vertex(v1);
-      }
-      else if( CGAL::assign( c, o)) {
-        CGAL_NEF_TRACEN("p0 found on volume with mark " << c->mark());
-#ifdef CGAL_NEF3_OVERLAY_IF_NEEDED_OFF
-        if(true) {
-#else
-        if( BOP( true, c->mark()) != BOP( false, c->mark())) {
-#endif
-#ifdef CGAL_NEF3_OVERLAY_BY_HAND_OFF
-          Vertex_handle v1 = create_local_view_on( p0, c);
-          binop_local_views( v0, v1, BOP, *this->sncp(),A);
-          this->sncp()->delete_vertex(v1);
-#else
-          SNC_constructor C(*this->sncp());
-          Vertex_handle v1 = C.clone_SM(v0);
-          SM_decorator SM(&*v1);
-          SM.change_marks(BOP, c->mark());
-          SM_overlayer O(&*v1);
-          O.simplify(A);
-#endif
-        } else {
-          CGAL_NEF_TRACEN("vertex in volume deleted " << std::endl <<
-                 "  vertex: " <<  v0->point() << std::endl <<
-                 "  mark of volume: " << c->mark());
-        }
-      }
-      else CGAL_error_msg( "wrong handle");
+        Vertex_handle v = qualify_vertex_of_first(v0, o, BOP, A);
+        if(v != Vertex_handle())
+          ignore[v] = true;
 
 #if defined(CGAL_NEF3_TIMER_OVERLAY)
-      timer_overlay.stop();
+        timer_overlay.stop();
 #endif
       }
-    CGAL_NEF_TRACEN("\nnumber of vertices (so far...) = "
-                    << this->sncp()->number_of_vertices());
+      CGAL_NEF_TRACEN("\nnumber of vertices (so far...) = "
+                      << this->sncp()->number_of_vertices());
 
-    CGAL_NEF_TRACEN("=> for all v1 in snc1, qualify v1 with respect snc0");
-    CGAL_forall_vertices( v0, snc2) {
+      CGAL_NEF_TRACEN("=> for all v1 in snc1, qualify v1 with respect snc0");
+      CGAL_forall_vertices( v0, snc2) {
 
-      if(ignore[v0]) continue;
-      Point_3 p1(v0->point());
-      Halfedge_handle e;
-      Halffacet_handle f;
-      Volume_handle c;
-      CGAL_NEF_TRACEN("Locating point " << p1);
+        if(ignore[v0]) continue;
+        Point_3 p1(v0->point());
+        CGAL_NEF_TRACEN("Locating point " << p1);
 
 #ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      number_of_point_location_queries++;
-      timer_point_location.start();
+        number_of_point_location_queries++;
+        timer_point_location.start();
 #endif
-      Object_handle o = pl1->locate(p1);
+        Object_handle o = pl1->locate(p1);
 #ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      timer_point_location.stop();
+        timer_point_location.stop();
 #endif
 
-      CGAL_assertion_code(Vertex_handle v);
-      CGAL_assertion( !CGAL::assign( v, o));
-
 #if defined(CGAL_NEF3_TIMER_OVERLAY)
-      timer_overlay.start();
-#endif
-      if( CGAL::assign( e, o)) {
-        CGAL_NEF_TRACEN("p1 found on edge");
-        Vertex_handle v1 = create_local_view_on( p1, e);
-        binop_local_views( v1, v0, BOP, *this->sncp(),A);
-        this->sncp()->delete_vertex(v1);
-      }
-      else if( CGAL::assign( f, o)) {
-        CGAL_NEF_TRACEN("p1 found on facet");
-        Vertex_handle v1 = create_local_view_on( p1, f);
-        binop_local_views( v1, v0, BOP, *this->sncp(),A);
-        this->sncp()->delete_vertex(v1);
-      }
-      else if( CGAL::assign( c, o)) {
-        CGAL_NEF_TRACEN("p1 found on volume with mark " << c->mark());
-#ifdef CGAL_NEF3_OVERLAY_IF_NEEDED_OFF
-        if(true)
-#else
-        if( BOP( c->mark(), true) != BOP( c->mark(), false))
+        timer_overlay.start();
 #endif
-        {
-#ifdef CGAL_NEF3_OVERLAY_BY_HAND_OFF
-          Vertex_handle v1 = create_local_view_on( p1, c);
-          binop_local_views( v1, v0, BOP, *this->sncp(),A);
-          this->sncp()->delete_vertex(v1);
-#else
-          SNC_constructor C(*this->sncp());
-          Vertex_handle v1 = C.clone_SM(v0);
-          SM_decorator SM(&*v1);
-          SM.change_marks(c->mark(), BOP);
-          SM_overlayer O(&*v1);
-          O.simplify(A);
-#endif
-        } else {
-          CGAL_NEF_TRACEN("vertex in volume deleted " << std::endl <<
-                          "  vertex: " <<  v0->point() << std::endl <<
-                          "  mark of volume: " << c->mark());
-        }
-      }
-      else CGAL_error_msg( "wrong handle");
+        qualify_vertex_of_second(v0, o, BOP, A);
 
 #if defined(CGAL_NEF3_TIMER_OVERLAY)
-      timer_overlay.stop();
+        timer_overlay.stop();
 #endif
+      }
     }
 
     CGAL_NEF_TRACEN("\nnumber of vertices (so far...) = "<<
@@ -506,8 +648,29 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
                     << this->sncp()->number_of_vertices());
 #else
     CGAL_NEF_TRACEN("intersection by fast box intersection");
-        binop_intersection_test_segment_tree<SNC_const_decorator> binop_box_intersection;
-        binop_box_intersection(call_back0, call_back1, snc1, snc2);
+    typedef binop_intersection_test_segment_tree<SNC_const_decorator> Intersection_tests;
+    Intersection_tests binop_box_intersection;
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      Locked_association LA(A);
+      std::vector<typename Intersection_tests::Edge_edge_pair> e0e1;
+      std::vector<typename Intersection_tests::Edge_facet_pair> e0f1, e1f0;
+      binop_box_intersection.collect_candidates(snc1, snc2, e0e1, e0f1, e1f0);
+      const std::size_t n0 = e0e1.size(), n1 = n0 + e0f1.size();
+      parallel_local_views(n1 + e1f0.size(), [&](Binary_operation& D, std::size_t i) {
+        Intersection_call_back<SNC_const_decorator, Selection, Locked_association>
+          cb0( snc1, snc2, BOP, *D.sncp(), false, LA),
+          cb1( snc2, snc2, BOP, *D.sncp(), true, LA);
+        if(i < n0)
+          Intersection_tests::test_edge_edge(e0e1[i].first, e0e1[i].second, cb0);
+        else if(i < n1)
+          Intersection_tests::test_edge_facet(e0f1[i-n0].first, e0f1[i-n0].second, cb0);
+        else
+          Intersection_tests::test_edge_facet(e1f0[i-n1].first, e1f0[i-n1].second, cb1);
+      });
+    } else
+#endif
+    binop_box_intersection(call_back0, call_back1, snc1, snc2);
 #endif
 
 #ifdef CGAL_NEF3_TIMER_INTERSECTION
@@ -18,6 +18,7 @@
 
 #include <CGAL/Nef_S2/ID_support_handler.h>
 #include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
 #include <boost/functional/hash.hpp>
 #include <unordered_map>
 #include <map>
@@ -376,5 +377,9 @@ class ID_support_handler<SNC_indexed_items, Decorator> {
 
 };
 
+template<typename Decorator>
+class ID_support_handler<SNC_compact_items, Decorator>
+  : public ID_support_handler<SNC_indexed_items, Decorator> {};
+
 } //namespace CGAL
 #endif // CGAL_NEF_3_ID_SUPPORT_HANDLER
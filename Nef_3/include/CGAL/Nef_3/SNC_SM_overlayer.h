@@ -31,6 +31,7 @@
 #include <CGAL/Nef_S2/SM_overlayer.h>
 #include <CGAL/Nef_3/SNC_structure.h>
 #include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
 
 #undef CGAL_NEF_DEBUG
 #define CGAL_NEF_DEBUG 131
@@ -487,5 +488,13 @@ class SNC_SM_overlayer<SNC_indexed_items, SM_decorator_>
 
 };
 
+template <typename SM_decorator_>
+class SNC_SM_overlayer<SNC_compact_items, SM_decorator_>
+  : public SNC_SM_overlayer<SNC_indexed_items, SM_decorator_> {
+  typedef SNC_SM_overlayer<SNC_indexed_items, SM_decorator_> Base;
+public:
+  using Base::Base;
+};
+
 } //namespace CGAL
 #endif //CGAL_SNC_SM_OVERLAYER_H
@@ -0,0 +1,614 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+
+#ifndef CGAL_NEF_SNC_COMPACT_ITEMS_H
+#define CGAL_NEF_SNC_COMPACT_ITEMS_H
+
+#include <CGAL/license/Nef_3.h>
+
+#include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/STL_Extension/internal/Index_arena.h>
+#include <CGAL/Nef_2/Object_handle.h>
+#include <CGAL/IO/Verbose_ostream.h>
+#include <CGAL/Nef_3/SNC_iteration.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#undef CGAL_NEF_DEBUG
+#define CGAL_NEF_DEBUG 83
+#include <CGAL/Nef_2/debug.h>
+
+#ifndef CGAL_I_DO_WANT_TO_USE_GENINFO
+#include <any>
+#endif
+
+namespace CGAL {
+namespace Nef_3_internal {
+
+// A handle to an item allocated in an `Index_arena`, stored as the 32-bit
+// index of the item. It is assigned from and converted to the handle, so that
+// the compact items return it by reference where the other items return a
+// reference to a handle.
+template <class Handle, class Const_handle>
+class Index_handle
+{
+  typedef typename Handle::value_type             Item;
+  typedef CGAL::internal::Index_arena<Item>       Arena;
+
+  std::uint32_t index_;
+
+public:
+  Index_handle() : index_(Arena::null_index) {}
+  explicit Index_handle(Handle h) : index_(Arena::index(h.operator->())) {}
+
+  Index_handle& operator=(Handle h)
+  {
+    index_ = Arena::index(h.operator->());
+    return *this;
+  }
+
+  operator Handle() const { return Handle(Arena::pointer(index_)); }
+  operator Const_handle() const { return Const_handle(Arena::pointer(index_)); }
+
+  Item& operator*() const { return *Arena::pointer(index_); }
+  Item* operator->() const { return Arena::pointer(index_); }
+
+  // the ranges of the local graph of a vertex are moved with these
+  Index_handle& operator++() { return *this = ++Handle(*this); }
+  Index_handle& operator--() { return *this = --Handle(*this); }
+
+  friend bool operator==(const Index_handle& h, const Index_handle& g)
+  { return h.index_ == g.index_; }
+  friend bool operator!=(const Index_handle& h, const Index_handle& g)
+  { return h.index_ != g.index_; }
+  friend bool operator==(const Index_handle& h, Handle g)
+  { return Handle(h) == g; }
+  friend bool operator!=(const Index_handle& h, Handle g)
+  { return Handle(h) != g; }
+  friend bool operator==(Handle h, const Index_handle& g)
+  { return h == Handle(g); }
+  friend bool operator!=(Handle h, const Index_handle& g)
+  { return h != Handle(g); }
+  friend bool operator==(const Index_handle& h, Const_handle g)
+  { return Const_handle(h) == g; }
+  friend bool operator!=(const Index_handle& h, Const_handle g)
+  { return Const_handle(h) != g; }
+  friend bool operator==(Const_handle h, const Index_handle& g)
+  { return h == Const_handle(g); }
+  friend bool operator!=(Const_handle h, const Index_handle& g)
+  { return h != Const_handle(g); }
+};
+
+// `make_object()` must store the handle, and not the index.
+template <class Handle, class Const_handle>
+Object make_object(Index_handle<Handle, Const_handle>& h)
+{ return CGAL::make_object(Handle(h)); }
+
+template <class Handle, class Const_handle>
+Object make_object(const Index_handle<Handle, Const_handle>& h)
+{ return CGAL::make_object(Handle(h)); }
+
+template <class Handle, class Const_handle>
+Object make_object(Index_handle<Handle, Const_handle>&& h)
+{ return CGAL::make_object(Handle(h)); }
+
+} // namespace Nef_3_internal
+
+/*{\Manpage {SNC_compact_items}{}{Compact items of the SNC structure}{}}*/
+
+/*{\Mdefinition The items of |SNC_indexed_items|, whose vertices, halfedges
+and halffacets store the handles to the other items as 32-bit indices instead
+of pointers. All items of an SNC structure using these items are allocated,
+per type, in a range of addresses reserved for all SNC structures of the
+program, and the index of an item is its offset in this range.}*/
+
+class SNC_compact_items : public SNC_indexed_items {
+ public:
+  template <class T>
+  using Allocator = internal::Index_arena_allocator<T>;
+
+  template <class Refs> class Vertex {
+#ifdef CGAL_I_DO_WANT_TO_USE_GENINFO
+    typedef void* GenPtr;
+#else
+    typedef std::any GenPtr;
+#endif
+    typedef typename Refs::Mark  Mark;
+    typedef typename Refs::Point_3 Point_3;
+
+    typedef typename Refs::SHalfloop_handle SHalfloop_handle;
+    typedef typename Refs::SHalfloop_const_handle SHalfloop_const_handle;
+
+    typedef typename Refs::SVertex_iterator SVertex_iterator;
+    typedef typename Refs::SHalfedge_iterator SHalfedge_iterator;
+    typedef typename Refs::SFace_iterator SFace_iterator;
+
+    typedef typename Refs::SVertex_const_iterator SVertex_const_iterator;
+    typedef typename Refs::SHalfedge_const_iterator SHalfedge_const_iterator;
+    typedef typename Refs::SFace_const_iterator SFace_const_iterator;
+
+    typedef Nef_3_internal::Index_handle<SVertex_iterator, SVertex_const_iterator> SVertex_index;
+    typedef Nef_3_internal::Index_handle<SHalfedge_iterator, SHalfedge_const_iterator> SHalfedge_index;
+    typedef Nef_3_internal::Index_handle<SFace_iterator, SFace_const_iterator> SFace_index;
+    typedef Nef_3_internal::Index_handle<SHalfloop_handle, SHalfloop_const_handle> SHalfloop_index;
+
+    typedef typename Refs::Size_type  Size_type;
+
+    Point_3            point_at_center_;
+    // local view (surface graph):
+    Refs*              sncp_;
+    GenPtr             info_;
+    SVertex_index      svertices_begin_, svertices_last_;
+    SHalfedge_index    shalfedges_begin_, shalfedges_last_;
+    SFace_index        sfaces_begin_, sfaces_last_;
+    SHalfloop_index    shalfloop_;
+    Mark               mark_;
+
+  public:
+    Vertex() : point_at_center_(), sncp_(), info_(), mark_() {}
+
+    Vertex(const Point_3& p, Mark m) :
+      point_at_center_(p), sncp_(), info_(), mark_(m) {}
+
+    Vertex(const Vertex<Refs>& v) :
+      point_at_center_(v.point_at_center_), sncp_(v.sncp_), info_(0),
+      svertices_begin_(v.svertices_begin_), svertices_last_(v.svertices_last_),
+      shalfedges_begin_(v.shalfedges_begin_), shalfedges_last_(v.shalfedges_last_),
+      sfaces_begin_(v.sfaces_begin_), sfaces_last_(v.sfaces_last_),
+      shalfloop_(v.shalfloop_), mark_(v.mark_) {}
+
+    Vertex<Refs>& operator=(const Vertex<Refs>& v)
+    { if (this == &v) return *this;
+      point_at_center_ = v.point_at_center_;
+      mark_ = v.mark_;
+      sncp_ = v.sncp_;
+      svertices_begin_ = v.svertices_begin_;
+      svertices_last_ = v.svertices_last_;
+      shalfedges_begin_ = v.shalfedges_begin_;
+      shalfedges_last_ = v.shalfedges_last_;
+      sfaces_begin_ = v.sfaces_begin_;
+      sfaces_last_ = v.sfaces_last_;
+      shalfloop_ = v.shalfloop_;
+      return *this;
+    }
+
+    Refs* sncp() const { return sncp_; }
+    Refs*& sncp() { return sncp_; }
+
+    // see `Vertex_base` for the ranges of the objects of the local graph
+    void init_range(SVertex_iterator it)
+    { svertices_begin_ = svertices_last_ = it; }
+    void init_range(SHalfedge_iterator it)
+    { shalfedges_begin_ = shalfedges_last_ = it; }
+    void init_range(SFace_iterator it)
+    { sfaces_begin_ = sfaces_last_ = it; }
+
+    SVertex_index& svertices_begin() { return svertices_begin_; }
+    SVertex_index& svertices_last() { return svertices_last_; }
+    SVertex_iterator svertices_end()
+    { SVertex_iterator last(svertices_last_);
+      if ( last == sncp()->svertices_end() )
+        return last;
+      else
+        return ++last; }
+
+    SHalfedge_index& shalfedges_begin() { return shalfedges_begin_; }
+    SHalfedge_index& shalfedges_last() { return shalfedges_last_; }
+    SHalfedge_iterator shalfedges_end()
+    { SHalfedge_iterator last(shalfedges_last_);
+      if ( last == sncp()->shalfedges_end() )
+        return last;
+      else
+        return ++last; }
+
+    SFace_index& sfaces_begin() { return sfaces_begin_; }
+    SFace_index& sfaces_last() { return sfaces_last_; }
+    SFace_iterator sfaces_end()
+    { SFace_iterator last(sfaces_last_);
+      if ( last == sncp()->sfaces_end() )
+        return last;
+      else
+        return ++last; }
+
+    SVertex_const_iterator svertices_begin() const
+    { return SVertex_iterator(svertices_begin_); }
+    SVertex_const_iterator svertices_last() const
+    { return SVertex_iterator(svertices_last_); }
+    SVertex_const_iterator svertices_end() const
+    { SVertex_const_iterator last(svertices_last());
+      if ( last == sncp()->svertices_end() )
+        return last;
+      else
+        return ++last; }
+
+    SHalfedge_const_iterator shalfedges_begin() const
+    { return SHalfedge_iterator(shalfedges_begin_); }
+    SHalfedge_const_iterator shalfedges_last() const
+    { return SHalfedge_iterator(shalfedges_last_); }
+    SHalfedge_const_iterator shalfedges_end() const
+    { SHalfedge_const_iterator last(shalfedges_last());
+      if ( last == sncp()->shalfedges_end() )
+        return last;
+      else
+        return ++last; }
+
+    SFace_const_iterator sfaces_begin() const
+    { return SFace_iterator(sfaces_begin_); }
+    SFace_const_iterator sfaces_last() const
+    { return SFace_iterator(sfaces_last_); }
+    SFace_const_iterator sfaces_end() const
+    { SFace_const_iterator last(sfaces_last());
+      if ( last == sncp()->sfaces_end() )
+        return last;
+      else
+        return ++last; }
+
+    SHalfloop_index& shalfloop() { return shalfloop_; }
+    SHalfloop_handle shalfloop() const { return shalfloop_; }
+
+    bool has_shalfloop() const {
+      return shalfloop() != sncp()->shalfloops_end();
+    }
+
+    Size_type number_of_svertices() const
+    { Size_type n(0);
+      SVertex_const_iterator vit;
+      CGAL_forall_svertices(vit, *this) ++n;
+      return n; }
+
+    Size_type number_of_shalfedges() const
+    { Size_type n(0);
+      SHalfedge_const_iterator eit;
+      CGAL_forall_shalfedges(eit, *this) ++n;
+      return n;}
+
+    Size_type number_of_sedges() const
+    { return number_of_shalfedges()/2; }
+
+    Size_type number_of_shalfloops() const
+    { return ( has_shalfloop() ? 2 : 0); }
+
+    Size_type number_of_sloops() const
+    { return number_of_shalfloops()/2; }
+
+    Size_type number_of_sfaces() const
+    { Size_type n(0);
+      SFace_const_iterator fit;
+      CGAL_forall_sfaces(fit, *this) ++n;
+      return n; }
+
+    void clear() {
+      SFace_iterator fit = sfaces_begin(),
+        fend = sfaces_end();
+      while (fit != fend) {
+        SFace_iterator fdel = fit++;
+        sncp()->reset_sm_object_list(fdel->boundary_entry_objects());
+        sncp()->delete_sface_only(fdel);
+      }
+      sfaces_begin_ = sfaces_last_ = sncp()->sfaces_end();
+
+      if ( shalfloop() != sncp()->shalfloops_end() ) {
+        sncp()->delete_shalfloop_only(shalfloop_->twin());
+        sncp()->delete_shalfloop_only(shalfloop_);
+        shalfloop_ = sncp()->shalfloops_end();
+      }
+
+      SHalfedge_iterator eit = shalfedges_begin(),
+        eend = shalfedges_end();
+      while (eit != eend) {
+        SHalfedge_iterator edel = eit++;
+        sncp()->delete_shalfedge_only(edel);
+      }
+      shalfedges_begin_ = shalfedges_last_ = sncp()->shalfedges_end();
+
+      SVertex_iterator vit = svertices_begin(),
+        vend = svertices_end();
+      while (vit != vend) {
+        SVertex_iterator vdel = vit++;
+        sncp()->delete_halfedge_only(vdel);
+      }
+      svertices_begin_ = svertices_last_ = sncp()->halfedges_end();
+    }
+
+    Point_3& point() { return point_at_center_; }
+    const Point_3& point() const { return point_at_center_; }
+    Mark& mark() { return mark_; }
+    const Mark& mark() const { return mark_;}
+    GenPtr& info() { return info_; }
+    const GenPtr& info() const { return info_; }
+
+    std::string debug() const
+    { std::stringstream os;
+      CGAL::IO::set_pretty_mode(os);
+      os<<"{ addr, point, mark, snc, svb, sve, seb, see, sfb, sfe, sl }"<<std::endl;
+      os<<"{ "<<this<<", "<<point_at_center_<<", "<<mark_<<", "<<&*sncp_<<", "
+        <<&*svertices_begin_ <<", "<<&*svertices_last_ <<", "
+        <<&*shalfedges_begin_<<", "<<&*shalfedges_last_<<", "
+        <<&*sfaces_begin_    <<", "<<&*sfaces_last_    <<", "
+        <<&*shalfloop_       <<" }";
+      return os.str();
+    }
+
+    bool check_basic_functions() { return true; }
+
+    bool is_valid( bool verb = false, int level = 0) const {
+
+      Verbose_ostream verr(verb);
+      verr << "begin CGAL::SNC_compact_items<...>::Vertex::is_valid( verb=true, "
+        "level = " << level << "):" << std::endl;
+
+      bool valid = (sncp_ != nullptr);
+      valid = valid && (svertices_begin() != SVertex_const_iterator());
+      valid = valid && (svertices_last() != SVertex_const_iterator());
+      valid = valid && (shalfedges_begin() != SHalfedge_const_iterator());
+      valid = valid && (shalfedges_last() != SHalfedge_const_iterator());
+      valid = valid && (sfaces_begin() != SFace_const_iterator());
+      valid = valid && (sfaces_last() != SFace_const_iterator());
+      valid = valid && (shalfloop() != SHalfloop_handle());
+
+      if(valid && shalfedges_begin() == sncp()->shalfedges_end()) {
+        // point in volume or on plane, which is either isolated or has one outgoing edge
+        if(shalfloop() != sncp()->shalfloops_end())
+          valid = valid && (++sfaces_begin() == sfaces_last());
+        else
+          valid = valid && (sfaces_begin() == sfaces_last());
+      }
+
+      valid = valid && (sfaces_begin() != sncp()->sfaces_end());
+      if(sfaces_begin() == sfaces_last()) {
+        valid = valid && (shalfloop() == sncp()->shalfloops_end());
+      }
+      else
+        valid = valid && (sfaces_begin()->sface_cycles_begin() !=
+                          sfaces_begin()->sface_cycles_end());
+
+      verr << "end of CGAL::SNC_compact_items<...>::Vertex::is_valid(): structure is "
+           << ( valid ? "valid." : "NOT VALID.") << std::endl;
+      return valid;
+    }
+  };
+
+  template <class Refs> class SVertex {
+#ifdef CGAL_I_DO_WANT_TO_USE_GENINFO
+    typedef void* GenPtr;
+#else
+    typedef std::any GenPtr;
+#endif
+    typedef typename Refs::Mark  Mark;
+    typedef typename Refs::Vector_3  Vector_3;
+    typedef typename Refs::Sphere_point  Sphere_point;
+    typedef typename Refs::Vertex_handle    Vertex_handle;
+    typedef typename Refs::SVertex_handle   SVertex_handle;
+    typedef typename Refs::SHalfedge_handle SHalfedge_handle;
+    typedef typename Refs::SFace_handle     SFace_handle;
+    typedef typename Refs::Vertex_const_handle    Vertex_const_handle;
+    typedef typename Refs::SVertex_const_handle   SVertex_const_handle;
+    typedef typename Refs::SHalfedge_const_handle SHalfedge_const_handle;
+    typedef typename Refs::SFace_const_handle     SFace_const_handle;
+
+    typedef Nef_3_internal::Index_handle<Vertex_handle, Vertex_const_handle> Vertex_index;
+    typedef Nef_3_internal::Index_handle<SVertex_handle, SVertex_const_handle> SVertex_index;
+    typedef Nef_3_internal::Index_handle<SHalfedge_handle, SHalfedge_const_handle> SHalfedge_index;
+    typedef Nef_3_internal::Index_handle<SFace_handle, SFace_const_handle> SFace_index;
+
+    Sphere_point       point_;
+    GenPtr             info_;
+    Vertex_index       center_vertex_;
+    SVertex_index      twin_;
+    SHalfedge_index    out_sedge_;
+    SFace_index        incident_sface_;
+    int                index;
+    Mark               mark_;
+
+  public:
+    SVertex() : point_(), info_(), index(0), mark_() {}
+    SVertex(Mark m) : point_(), info_(), index(0), mark_(m) {}
+
+    SVertex(const SVertex<Refs>& e) :
+      point_(e.point_), info_(0), center_vertex_(e.center_vertex_),
+      twin_(e.twin_), out_sedge_(e.out_sedge_),
+      incident_sface_(e.incident_sface_), index(e.index), mark_(e.mark_) {}
+
+    SVertex<Refs>& operator=(const SVertex<Refs>& e)
+    { center_vertex_ = e.center_vertex_;
+      point_ = e.point_;
+      mark_ = e.mark_;
+      twin_ = e.twin_;
+      out_sedge_ = e.out_sedge_;
+      incident_sface_ = e.incident_sface_;
+      info_ = 0;
+      index = e.index;
+      return *this;
+    }
+
+    Vertex_index& center_vertex() { return center_vertex_; }
+    Vertex_const_handle center_vertex() const { return Vertex_handle(center_vertex_); }
+
+    Vertex_index& source() { return center_vertex_; }
+    Vertex_const_handle source() const { return Vertex_handle(center_vertex_); }
+
+    Vertex_index& target() { return twin()->source(); }
+    Vertex_const_handle target() const { return twin()->source(); }
+
+    Mark& mark() { return mark_; }
+    const Mark& mark() const { return mark_; }
+
+    Vector_3 vector() const { return (point_ - CGAL::ORIGIN); }
+    Sphere_point& point(){ return point_; }
+    const Sphere_point& point() const { return point_; }
+
+    SVertex_index& twin() { return twin_; }
+    SVertex_const_handle twin() const { return SVertex_handle(twin_); }
+
+    SHalfedge_index& out_sedge() { return out_sedge_; }
+    SHalfedge_const_handle out_sedge() const { return SHalfedge_handle(out_sedge_); }
+
+    SFace_index& incident_sface() { return incident_sface_; }
+    SFace_const_handle incident_sface() const { return SFace_handle(incident_sface_); }
+
+    bool is_isolated() const { return (out_sedge() == SHalfedge_const_handle()); }
+
+    GenPtr& info() { return info_; }
+    const GenPtr& info() const { return info_; }
+
+    int new_index()
+    { index = Index_generator::get_unique_index(); return index; }
+    void set_index(int idx)
+    { index = idx; }
+    int get_index() const { return index; }
+
+    std::string debug() const
+    { std::stringstream os;
+      CGAL::IO::set_pretty_mode(os);
+      os<<"sv [ "<<point_<<" ] ";
+      return os.str();
+    }
+
+    bool is_twin() const { return (&*twin_ < this); }
+
+    bool is_valid( bool verb = false, int level = 0) const {
+
+      Verbose_ostream verr(verb);
+      verr << "begin CGAL::SNC_compact_items<...>::SVertex::is_valid( verb=true, "
+        "level = " << level << "):" << std::endl;
+
+      bool valid = (center_vertex() != Vertex_const_handle());
+      valid = valid && (twin() != SVertex_const_handle());
+      valid = valid && (out_sedge() != SHalfedge_const_handle() ||
+                        incident_sface() != SFace_const_handle());
+
+      verr << "end of CGAL::SNC_compact_items<...>::SVertex::is_valid(): structure is "
+           << ( valid ? "valid." : "NOT VALID.") << std::endl;
+
+      return valid;
+    }
+  };
+
+  template <class Refs> class Halffacet {
+    typedef typename Refs::Mark  Mark;
+    typedef typename Refs::Plane_3   Plane_3;
+    typedef typename Refs::Halffacet_handle         Halffacet_handle;
+    typedef typename Refs::Halffacet_const_handle   Halffacet_const_handle;
+    typedef typename Refs::Volume_handle            Volume_handle;
+    typedef typename Refs::Volume_const_handle      Volume_const_handle;
+    typedef typename Refs::Object_list    Object_list;
+    typedef typename Refs::Halffacet_cycle_iterator
+      Halffacet_cycle_iterator;
+    typedef typename Refs::Halffacet_cycle_const_iterator
+      Halffacet_cycle_const_iterator;
+    typedef typename Refs::SHalfedge_around_facet_const_circulator
+      SHalfedge_around_facet_const_circulator;
+    typedef typename Refs::SHalfedge_const_handle SHalfedge_const_handle;
+    typedef typename Refs::SHalfloop_const_handle SHalfloop_const_handle;
+
+    typedef Nef_3_internal::Index_handle<Halffacet_handle, Halffacet_const_handle> Halffacet_index;
+    typedef Nef_3_internal::Index_handle<Volume_handle, Volume_const_handle> Volume_index;
+
+    Plane_3              supporting_plane_;
+    Object_list          boundary_entry_objects_; // SEdges, SLoops
+    Halffacet_index      twin_;
+    Volume_index         volume_;
+    Mark                 mark_;
+
+  public:
+    Halffacet() : supporting_plane_(), mark_() {}
+
+    Halffacet(const Plane_3& h, Mark m) :
+      supporting_plane_(h), mark_(m) {}
+
+    Halffacet(const Halffacet<Refs>& f) :
+      supporting_plane_(f.supporting_plane_),
+      boundary_entry_objects_(f.boundary_entry_objects_),
+      twin_(f.twin_), volume_(f.volume_), mark_(f.mark_) {}
+
+    Halffacet<Refs>& operator=(const Halffacet<Refs>& f)
+    { if (this == &f) return *this;
+      supporting_plane_ = f.supporting_plane_;
+      mark_ = f.mark_;
+      twin_ = f.twin_;
+      volume_ = f.volume_;
+      boundary_entry_objects_ = f.boundary_entry_objects_;
+      return *this;
+    }
+
+    Mark& mark() { return mark_; }
+    const Mark& mark() const { return mark_; }
+
+    Halffacet_index& twin() { return twin_; }
+    Halffacet_const_handle twin() const { return Halffacet_handle(twin_); }
+
+    Plane_3& plane() { return supporting_plane_; }
+    const Plane_3& plane() const { return supporting_plane_; }
+
+    Volume_index& incident_volume() { return volume_; }
+    Volume_const_handle incident_volume() const { return Volume_handle(volume_); }
+
+    Object_list& boundary_entry_objects() { return boundary_entry_objects_; }
+    const Object_list& boundary_entry_objects() const { return boundary_entry_objects_; }
+
+    Halffacet_cycle_iterator facet_cycles_begin()
+    { return boundary_entry_objects_.begin(); }
+    Halffacet_cycle_iterator facet_cycles_end()
+    { return boundary_entry_objects_.end(); }
+    Halffacet_cycle_const_iterator facet_cycles_begin() const
+    { return boundary_entry_objects_.begin(); }
+    Halffacet_cycle_const_iterator facet_cycles_end() const
+    { return boundary_entry_objects_.end(); }
+
+    bool is_twin() const { return (&*twin_ < this); }
+
+    bool is_valid( bool verb = false, int level = 0) const {
+
+      Verbose_ostream verr(verb);
+      verr << "begin CGAL::SNC_compact_items<...>::Halffacet::is_valid( verb=true, "
+        "level = " << level << "):" << std::endl;
+
+      bool valid = (twin() != Halffacet_const_handle());
+      valid = valid && (incident_volume() != Volume_const_handle());
+
+      valid = valid && (supporting_plane_.a() != 0 ||
+                        supporting_plane_.b() != 0 ||
+                        supporting_plane_.c() != 0);
+
+      valid = valid && (!boundary_entry_objects_.empty());
+
+      // as for `SNC_indexed_items`, all sedges and sloops of the facet
+      // have the same index
+      Halffacet_cycle_const_iterator fci(facet_cycles_begin());
+      if(!valid || !fci.is_shalfedge()) return false;
+      int index = SHalfedge_const_handle(fci)->get_index();
+      for(; fci != facet_cycles_end(); ++fci) {
+        if(fci.is_shalfedge()) {
+          SHalfedge_const_handle se(fci);
+          SHalfedge_around_facet_const_circulator sfc(se), send(sfc);
+          do {
+            valid = valid && sfc->get_index() == index;
+            ++sfc;
+          } while(sfc != send);
+        } else if(fci.is_shalfloop()) {
+          valid = valid && SHalfloop_const_handle(fci)->get_index() == index;
+        } else
+          return false;
+      }
+
+      verr << "end of CGAL::SNC_compact_items<...>::Halffacet::is_valid(): structure is "
+           << ( valid ? "valid." : "NOT VALID.") << std::endl;
+
+      return valid;
+    }
+  };
+};
+
+} //namespace CGAL
+#endif // CGAL_NEF_SNC_COMPACT_ITEMS_H
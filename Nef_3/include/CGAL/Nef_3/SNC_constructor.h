@@ -2153,5 +2153,13 @@ class SNC_constructor<SNC_indexed_items, SNC_structure_>
 
 };
 
+template<typename SNC_structure_>
+class SNC_constructor<SNC_compact_items, SNC_structure_>
+  : public SNC_constructor<SNC_indexed_items, SNC_structure_> {
+  typedef SNC_constructor<SNC_indexed_items, SNC_structure_> Base;
+public:
+  using Base::Base;
+};
+
 } //namespace CGAL
 #endif //CGAL_SNC_CONSTRUCTOR_H
@@ -419,7 +419,7 @@ class SNC_decorator : public SNC_const_decorator<Map> {
         SM_decorator S1(&*he->source());
         SM_decorator S2(&*he->twin()->source());
         SHalfedge_handle se1(S1.first_out_edge(he));
-        SHalfedge_handle se2(S2.first_out_edge(he->twin()));
+        SHalfedge_handle se2(S2.first_out_edge(SVertex_handle(he->twin())));
         if(se1 != nullptr && se2 != nullptr) {
           SHalfedge_handle start1(se1);
           SHalfedge_handle start2(se2->twin()->snext());
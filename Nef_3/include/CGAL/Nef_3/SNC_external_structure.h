@@ -27,9 +27,12 @@
 #include <CGAL/Nef_3/SNC_FM_decorator.h>
 #include <CGAL/Nef_3/SNC_halfedge_key.h>
 #include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
 #include <CGAL/Nef_3/SNC_simplify.h>
+#include <CGAL/Handle.h>
 #include <map>
 #include <list>
+#include <type_traits>
 #include <unordered_map>
 
 #undef CGAL_NEF_DEBUG
@@ -244,6 +247,22 @@ public:
     : SNC_decorator(W), pl(spl) {}
   /*{\Mcreate makes |\Mvar| a decorator of |W|.}*/
 
+  // Circles of reference counted kernels are often copies of each other,
+  // e.g. the circles of the sedges of a facet built from a polygon mesh.
+  // Comparing their representations first spares the computation of
+  // their exact coordinates.
+  static bool equal_circles(const Sphere_circle& c0, const Sphere_circle& c1,
+                            std::true_type)
+  { return CGAL::identical(static_cast<const Handle&>(c0),
+                           static_cast<const Handle&>(c1)) || c0 == c1; }
+
+  static bool equal_circles(const Sphere_circle& c0, const Sphere_circle& c1,
+                            std::false_type)
+  { return c0 == c1; }
+
+  static bool equal_circles(const Sphere_circle& c0, const Sphere_circle& c1)
+  { return equal_circles(c0, c1, std::is_base_of<Handle, Sphere_circle>()); }
+
  public:
   //#define CGAL_NEF_NO_HALFEDGE_KEYS
 #ifdef CGAL_NEF_NO_HALFEDGE_KEYS
@@ -586,7 +605,7 @@ public:
       } else
 #endif
         CGAL_For_all(cet,cete)
-          if ( cet->circle() == ce->circle().opposite() &&
+          if ( equal_circles(cet->circle(), ce->twin()->circle()) &&
                cet->source()->twin() == ce->source() )
             break;
 
@@ -1323,5 +1342,13 @@ public:
   }
 };
 
+template <typename SNC_structure_>
+class SNC_external_structure<SNC_compact_items, SNC_structure_>
+  : public SNC_external_structure<SNC_indexed_items, SNC_structure_> {
+  typedef SNC_external_structure<SNC_indexed_items, SNC_structure_> Base;
+public:
+  using Base::Base;
+};
+
 } //namespace CGAL
 #endif //CGAL_SNC_EXTERNAL_STRUCTURE_H
@@ -18,8 +18,24 @@
 
 #include <CGAL/Nef_S2/SM_list.h>
 
+#include <type_traits>
+
 namespace CGAL {
 
+// The allocator of the items of type `T` of an SNC structure: the member
+// template `Allocator` of the items class, if it has one, and the default
+// allocator otherwise.
+template <typename Items, typename T, typename = void>
+struct SNC_items_allocator {
+  typedef CGAL_ALLOCATOR(T) type;
+};
+
+template <typename Items, typename T>
+struct SNC_items_allocator<Items, T,
+                           std::void_t<typename Items::template Allocator<T> > > {
+  typedef typename Items::template Allocator<T> type;
+};
+
 template < class Sphere_map>
 class SNC_in_place_list_sm
     : public Sphere_map,
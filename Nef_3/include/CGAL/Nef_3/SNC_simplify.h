@@ -19,6 +19,7 @@
 
 #include <CGAL/basic.h>
 #include <CGAL/Nef_3/SNC_decorator.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
 #include <CGAL/Nef_S2/SM_decorator.h>
 
 #undef CGAL_NEF_DEBUG
@@ -406,8 +407,8 @@ class SNC_simplify_base : public SNC_decorator<SNC_structure> {
             Halffacet_handle f1(e1->facet());
             Halffacet_handle f2(e2->facet());
             CGAL_NEF_TRACEN("UNION of f1 & f2->twin()");
-            merge_sets( f1, f2->twin(), hash_facet, uf_facet);
-            merge_sets( f1->twin(), f2, hash_facet, uf_facet);
+            merge_sets( f1, Halffacet_handle(f2->twin()), hash_facet, uf_facet);
+            merge_sets( Halffacet_handle(f1->twin()), f2, hash_facet, uf_facet);
             CGAL_NEF_TRACEN("removing e");
             remove_edge_and_merge_facet_cycles(e);
             update_facets = true;
@@ -751,5 +752,13 @@ class SNC_simplify<SNC_indexed_items, SNC_structure>
   }
 };
 
+template<typename SNC_structure>
+class SNC_simplify<SNC_compact_items, SNC_structure>
+  : public SNC_simplify<SNC_indexed_items, SNC_structure> {
+  typedef SNC_simplify<SNC_indexed_items, SNC_structure> Base;
+public:
+  using Base::Base;
+};
+
 } //namespace CGAL
 #endif // CGAL_SNC_STRUCTURE_H
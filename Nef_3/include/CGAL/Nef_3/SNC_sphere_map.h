@@ -80,8 +80,8 @@ class SNC_sphere_map : public Items_::template Vertex<SNC_structure<Kernel_, Ite
 
   typedef Self                                              Vertex_base;
   typedef SNC_in_place_list_sm<Vertex_base>                 Vertex;
-  typedef CGAL::In_place_list<Vertex,false>                 Vertex_list;
-  typedef CGAL_ALLOCATOR(Vertex)                            Vertex_alloc;
+  typedef typename SNC_items_allocator<Items,Vertex>::type  Vertex_alloc;
+  typedef CGAL::In_place_list<Vertex,false,Vertex_alloc>    Vertex_list;
   typedef typename Vertex_list::iterator                    Vertex_handle;
   typedef typename Vertex_list::const_iterator              Vertex_const_handle;
   typedef typename Vertex_list::iterator                    Vertex_iterator;
@@ -89,8 +89,8 @@ class SNC_sphere_map : public Items_::template Vertex<SNC_structure<Kernel_, Ite
 
   typedef typename Items::template SVertex<SNC_structure>   SVertex_base;
   typedef SNC_in_place_list_svertex<SVertex_base>           SVertex;
-  typedef CGAL::In_place_list<SVertex,false>                SVertex_list;
-  typedef CGAL_ALLOCATOR(SVertex)                           SVertex_alloc;
+  typedef typename SNC_items_allocator<Items,SVertex>::type SVertex_alloc;
+  typedef CGAL::In_place_list<SVertex,false,SVertex_alloc>  SVertex_list;
   typedef typename SVertex_list::iterator                   SVertex_handle;
   typedef typename SVertex_list::const_iterator             SVertex_const_handle;
   typedef typename SVertex_list::iterator                   SVertex_iterator;
@@ -98,8 +98,8 @@ class SNC_sphere_map : public Items_::template Vertex<SNC_structure<Kernel_, Ite
 
   typedef typename Items::template SHalfedge<SNC_structure> SHalfedge_base;
   typedef SNC_in_place_list_shalfedge<SHalfedge_base>       SHalfedge;
-  typedef CGAL::In_place_list<SHalfedge,false>              SHalfedge_list;
-  typedef CGAL_ALLOCATOR(SHalfedge)                         SHalfedge_alloc;
+  typedef typename SNC_items_allocator<Items,SHalfedge>::type SHalfedge_alloc;
+  typedef CGAL::In_place_list<SHalfedge,false,SHalfedge_alloc> SHalfedge_list;
   typedef typename SHalfedge_list::iterator                 SHalfedge_handle;
   typedef typename SHalfedge_list::const_iterator           SHalfedge_const_handle;
   typedef typename SHalfedge_list::iterator                 SHalfedge_iterator;
@@ -107,8 +107,8 @@ class SNC_sphere_map : public Items_::template Vertex<SNC_structure<Kernel_, Ite
 
   typedef typename Items::template SHalfloop<SNC_structure> SHalfloop_base;
   typedef SNC_in_place_list_shalfloop<SHalfloop_base>       SHalfloop;
-  typedef CGAL::In_place_list<SHalfloop,false>              SHalfloop_list;
-  typedef CGAL_ALLOCATOR(SHalfloop)                         SHalfloop_alloc;
+  typedef typename SNC_items_allocator<Items,SHalfloop>::type SHalfloop_alloc;
+  typedef CGAL::In_place_list<SHalfloop,false,SHalfloop_alloc> SHalfloop_list;
   typedef typename SHalfloop_list::iterator                 SHalfloop_handle;
   typedef typename SHalfloop_list::const_iterator           SHalfloop_const_handle;
   typedef typename SHalfloop_list::iterator                 SHalfloop_iterator;
@@ -116,8 +116,8 @@ class SNC_sphere_map : public Items_::template Vertex<SNC_structure<Kernel_, Ite
 
   typedef typename Items::template SFace<SNC_structure>     SFace_base;
   typedef SNC_in_place_list_sface<SFace_base>               SFace;
-  typedef CGAL::In_place_list<SFace,false>                  SFace_list;
-  typedef CGAL_ALLOCATOR(SFace)                             SFace_alloc;
+  typedef typename SNC_items_allocator<Items,SFace>::type   SFace_alloc;
+  typedef CGAL::In_place_list<SFace,false,SFace_alloc>      SFace_list;
   typedef typename SFace_list::iterator                     SFace_handle;
   typedef typename SFace_list::const_iterator               SFace_const_handle;
   typedef typename SFace_list::iterator                     SFace_iterator;
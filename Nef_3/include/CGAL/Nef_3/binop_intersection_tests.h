@@ -18,6 +18,7 @@
 #include <CGAL/Nef_3/Nef_box.h>
 #include <CGAL/Nef_3/Infimaximal_box.h>
 #include <CGAL/Nef_3/SNC_const_decorator.h>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -36,6 +37,26 @@ struct binop_intersection_test_segment_tree {
   typedef CGAL::SNC_const_decorator<SNC_structure>        Const_decorator;
   typedef CGAL::Nef_box<SNC_decorator>                    Nef_box;
 
+  typedef std::pair<Halfedge_iterator, Halfedge_iterator>  Edge_edge_pair;
+  typedef std::pair<Halfedge_iterator, Halffacet_iterator> Edge_facet_pair;
+
+  template<class Callback>
+  static void test_edge_facet(Halfedge_iterator e, Halffacet_iterator f, Callback& cb) {
+    if( Infi_box::degree( f->plane().d() ) > 0 )
+      return;
+    Point_3 ip;
+    if( SNC_intersection::does_intersect_internally( Const_decorator::segment(e), f, ip ))
+      cb(e,f,ip);
+  }
+
+  template<class Callback>
+  static void test_edge_edge(Halfedge_iterator e0, Halfedge_iterator e1, Callback& cb) {
+    Point_3 ip;
+    if( SNC_intersection::does_intersect_internally( Const_decorator::segment( e0 ),
+                                                     Const_decorator::segment( e1 ), ip ))
+      cb(e0,e1,ip);
+  }
+
   template<class Callback>
   struct Bop_edge0_face1_callback {
     Callback           &cb;
@@ -49,14 +70,7 @@ struct binop_intersection_test_segment_tree {
 #ifdef CGAL_NEF3_DUMP_STATISTICS
       ++number_of_intersection_candidates;
 #endif
-      Halfedge_iterator  e0 = box0.get_halfedge();
-      Halffacet_iterator f1 = box1.get_halffacet();
-      if( Infi_box::degree( f1->plane().d() ) > 0 )
-        return;
-      Point_3 ip;
-      if( SNC_intersection::does_intersect_internally( Const_decorator::segment(e0), f1, ip )) {
-        cb(e0,f1,ip);
-      }
+      test_edge_facet(box0.get_halfedge(), box1.get_halffacet(), cb);
     }
   };
 
@@ -73,14 +87,7 @@ struct binop_intersection_test_segment_tree {
 #ifdef CGAL_NEF3_DUMP_STATISTICS
       ++number_of_intersection_candidates;
 #endif
-      Halfedge_iterator  e1 = box0.get_halfedge();
-      Halffacet_iterator f0 = box1.get_halffacet();
-      if( Infi_box::degree( f0->plane().d() ) > 0 )
-        return;
-      Point_3 ip;
-      if( SNC_intersection::does_intersect_internally( Const_decorator::segment( e1 ),
-                                                       f0, ip ) )
-        cb(e1,f0,ip);
+      test_edge_facet(box0.get_halfedge(), box1.get_halffacet(), cb);
     }
   };
 
@@ -97,12 +104,31 @@ struct binop_intersection_test_segment_tree {
 #ifdef CGAL_NEF3_DUMP_STATISTICS
       ++number_of_intersection_candidates;
 #endif
-      Halfedge_iterator e0 = box0.get_halfedge();
-      Halfedge_iterator e1 = box1.get_halfedge();
-      Point_3 ip;
-      if( SNC_intersection::does_intersect_internally( Const_decorator::segment( e0 ),
-                                                       Const_decorator::segment( e1 ), ip ))
-        cb(e0,e1,ip);
+      test_edge_edge(box0.get_halfedge(), box1.get_halfedge(), cb);
+    }
+  };
+
+  struct Collect_edge_edge_callback {
+    std::vector<Edge_edge_pair>& pairs;
+
+    Collect_edge_edge_callback(std::vector<Edge_edge_pair>& pairs)
+    : pairs(pairs)
+    {}
+
+    void operator()( Nef_box& box0, Nef_box& box1 ) {
+      pairs.emplace_back(box0.get_halfedge(), box1.get_halfedge());
+    }
+  };
+
+  struct Collect_edge_facet_callback {
+    std::vector<Edge_facet_pair>& pairs;
+
+    Collect_edge_facet_callback(std::vector<Edge_facet_pair>& pairs)
+    : pairs(pairs)
+    {}
+
+    void operator()( Nef_box& box0, Nef_box& box1 ) {
+      pairs.emplace_back(box0.get_halfedge(), box1.get_halffacet());
     }
   };
 
@@ -144,6 +170,49 @@ struct binop_intersection_test_segment_tree {
                         f0boxes.begin(), f0boxes.end(),
                         callback_edge1_face0);
   }
+
+  // Stores the pairs of items whose boxes intersect, in the order in which
+  // `operator()` tests them: the pairs (edge of snc0, edge of snc1),
+  // (edge of snc0, facet of snc1), and (edge of snc1, facet of snc0).
+  // The pairs can then be tested independently with `test_edge_edge()`
+  // and `test_edge_facet()`.
+  void collect_candidates(const SNC_structure& snc0,
+                          const SNC_structure& snc1,
+                          std::vector<Edge_edge_pair>& e0e1,
+                          std::vector<Edge_facet_pair>& e0f1,
+                          std::vector<Edge_facet_pair>& e1f0)
+  {
+    Halfedge_iterator e0, e1;
+    Halffacet_iterator f0, f1;
+    std::vector<Nef_box> e0boxes, e1boxes, f0boxes, f1boxes;
+
+    e0boxes.reserve(snc0.number_of_halfedges());
+    e1boxes.reserve(snc1.number_of_halfedges());
+    f0boxes.reserve(snc0.number_of_halffacets());
+    f1boxes.reserve(snc1.number_of_halffacets());
+
+    CGAL_forall_edges( e0, snc0) e0boxes.push_back( Nef_box( e0 ) );
+    CGAL_forall_edges( e1, snc1) e1boxes.push_back( Nef_box( e1 ) );
+    CGAL_forall_facets( f0, snc0) f0boxes.push_back( Nef_box( f0 ) );
+    CGAL_forall_facets( f1, snc1) f1boxes.push_back( Nef_box( f1 ) );
+
+    Collect_edge_edge_callback collect_edge0_edge1( e0e1 );
+    box_intersection_d( e0boxes.begin(), e0boxes.end(),
+                        e1boxes.begin(), e1boxes.end(),
+                        collect_edge0_edge1);
+    Collect_edge_facet_callback collect_edge0_face1( e0f1 );
+    box_intersection_d( e0boxes.begin(), e0boxes.end(),
+                        f1boxes.begin(), f1boxes.end(),
+                        collect_edge0_face1);
+    Collect_edge_facet_callback collect_edge1_face0( e1f0 );
+    box_intersection_d( e1boxes.begin(), e1boxes.end(),
+                        f0boxes.begin(), f0boxes.end(),
+                        collect_edge1_face0);
+
+#ifdef CGAL_NEF3_DUMP_STATISTICS
+    number_of_intersection_candidates += int(e0e1.size() + e0f1.size() + e1f0.size());
+#endif
+  }
 };
 
 } //namespace CGAL
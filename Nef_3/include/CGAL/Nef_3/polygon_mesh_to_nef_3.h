@@ -23,6 +23,7 @@
 #include <CGAL/normal_vector_newell_3.h>
 #include <CGAL/Nef_S2/SM_point_locator.h>
 #include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
 #include <CGAL/Plane_3.h>
 #include <CGAL/Point_3.h>
 #include <CGAL/Vector_3.h>
@@ -171,6 +172,14 @@ public:
   }
 };
 
+template<typename PolygonMesh, typename SNC_structure, typename HalfedgeIndexMap>
+class Face_graph_index_adder<CGAL::SNC_compact_items, PolygonMesh, SNC_structure, HalfedgeIndexMap>
+  : public Face_graph_index_adder<CGAL::SNC_indexed_items, PolygonMesh, SNC_structure, HalfedgeIndexMap> {
+  typedef Face_graph_index_adder<CGAL::SNC_indexed_items, PolygonMesh, SNC_structure, HalfedgeIndexMap> Base;
+public:
+  using Base::Base;
+};
+
 template <class PolygonMesh, class SNC_structure, class FaceIndexMap, class HalfedgeIndexMap>
 void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap fimap, HalfedgeIndexMap himap)
 {
@@ -193,7 +202,9 @@ void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap
 
   PMap pmap = get(CGAL::vertex_point,P);
 
-  std::vector<Vector_3> normals(num_faces(P));
+  // The sedges of all the vertices of a face share its circle, so that
+  // reference counted kernels store and compute it (exactly) only once.
+  std::vector<Sphere_circle> circles(num_faces(P)), opposite_circles(num_faces(P));
   CGAL_assertion_code(std::vector<std::size_t>  num_edges(num_faces(P));)
 
   for(face_descriptor f : faces(P)){
@@ -201,7 +212,8 @@ void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap
     Vector_3 v;
     normal_vector_newell_3(vafc, done, pmap, v);
     std::size_t i = get(fimap,f);
-    normals[i] = -v;
+    circles[i] = Sphere_circle(CGAL::ORIGIN, -v);
+    opposite_circles[i] = circles[i].opposite();
     CGAL_assertion_code(num_edges[i] = circulator_size(vafc));
   }
 
@@ -253,7 +265,7 @@ void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap
         with_border = true;
       else {
         std::size_t i = get(fimap,face(pe_prev,P));
-        Sphere_circle ss_circle(CGAL::ORIGIN, normals[i]);
+        const Sphere_circle& ss_circle = circles[i];
         CGAL_assertion_code(if(num_edges[i] > 3) {
           CGAL_assertion(ss_circle.has_on(sp));
           CGAL_assertion(ss_circle.has_on(sv_prev->point()));
@@ -261,7 +273,7 @@ void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap
 
         SHalfedge_handle e = SM.new_shalfedge_pair(sv_prev, sv);
         e->circle() = ss_circle;
-        e->twin()->circle() = ss_circle.opposite();
+        e->twin()->circle() = opposite_circles[i];
         e->mark() = e->twin()->mark() = true;
 
         index_adder.set_edge(pe_prev, e);
@@ -285,7 +297,7 @@ void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap
       e = sv_prev->out_sedge();
     } else {
       std::size_t i = get(fimap,face(pe_prev,P));
-      Sphere_circle ss_circle(CGAL::ORIGIN, normals[i]);
+      const Sphere_circle& ss_circle = circles[i];
 
       CGAL_assertion_code(if(num_edges[i] > 3) {
         CGAL_assertion(ss_circle.has_on(sp_0));
@@ -294,7 +306,7 @@ void polygon_mesh_to_nef_3(const PolygonMesh& P, SNC_structure& S, FaceIndexMap
 
       e = SM.new_shalfedge_pair(sv_prev, sv_0);
       e->circle() = ss_circle;
-      e->twin()->circle() = ss_circle.opposite();
+      e->twin()->circle() = opposite_circles[i];
       e->mark() = e->twin()->mark() = true;
 
       index_adder.set_edge(pe_prev, e);
@@ -29,6 +29,7 @@
 
 // Nef polyhedra
 #include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
 
 namespace CGAL {
 
@@ -95,6 +96,15 @@ template<typename Edge, typename CompareEdges>
   }
 };
 
+template<typename Edge, typename CompareEdges>
+  class Index_matcher<CGAL::SNC_compact_items, Edge, CompareEdges>
+  : public Index_matcher<CGAL::SNC_indexed_items, Edge, CompareEdges>
+{
+  typedef Index_matcher<CGAL::SNC_indexed_items, Edge, CompareEdges> Base;
+ public:
+  using Base::Base;
+};
+
 // return value reports success ("true" means nef contains result)
 // note: facets are considered to be compact
 // CTP - Constrained_triangulation_plus
@@ -535,6 +535,10 @@ protected:
      }
  };
 
+ template<typename SNC_structure>
+ class Sphere_map_creator<CGAL::SNC_compact_items, SNC_structure>
+   : public Sphere_map_creator<CGAL::SNC_indexed_items, SNC_structure> {};
+
  template <typename InputIterator>
  Nef_polyhedron_3(InputIterator begin, InputIterator end, Polylines_tag)
   : Nef_polyhedron_3(Private_tag{})
@@ -1402,6 +1406,14 @@ protected:
   Nef_polyhedron_3<Kernel,Items, Mark>
   intersection(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
     /*{\Mop returns |\Mvar| $\cap$ |N1|. }*/ {
+    return intersection(N1, Sequential_tag());
+  }
+
+  template <typename ConcurrencyTag>
+  Nef_polyhedron_3<Kernel,Items, Mark>
+  intersection(const Nef_polyhedron_3<Kernel,Items, Mark>& N1, ConcurrencyTag tag) const
+  /*{\Mop same as above. With |ConcurrencyTag| being |Parallel_tag|,
+    the operation is performed in parallel. }*/ {
     CGAL_NEF_TRACEN(" intersection between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return *this;
     if (N1.is_empty()) return N1;
@@ -1410,7 +1422,7 @@ protected:
     AND _and;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo( res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _and);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _and, tag);
     return res;
   }
 
@@ -1428,6 +1440,14 @@ protected:
   Nef_polyhedron_3<Kernel,Items, Mark>
   join(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
   /*{\Mop returns |\Mvar| $\cup$ |N1|. }*/ {
+    return join(N1, Sequential_tag());
+  }
+
+  template <typename ConcurrencyTag>
+  Nef_polyhedron_3<Kernel,Items, Mark>
+  join(const Nef_polyhedron_3<Kernel,Items, Mark>& N1, ConcurrencyTag tag) const
+  /*{\Mop same as above. With |ConcurrencyTag| being |Parallel_tag|,
+    the operation is performed in parallel. }*/ {
     CGAL_NEF_TRACEN(" join between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return N1;
     if (N1.is_empty()) return *this;
@@ -1437,13 +1457,21 @@ protected:
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, OR> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo(res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _or);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _or, tag);
     return res;
   }
 
   Nef_polyhedron_3<Kernel,Items, Mark>
   difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
   /*{\Mop returns |\Mvar| $-$ |N1|. }*/ {
+    return difference(N1, Sequential_tag());
+  }
+
+  template <typename ConcurrencyTag>
+  Nef_polyhedron_3<Kernel,Items, Mark>
+  difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1, ConcurrencyTag tag) const
+  /*{\Mop same as above. With |ConcurrencyTag| being |Parallel_tag|,
+    the operation is performed in parallel. }*/ {
     CGAL_NEF_TRACEN(" difference between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return *this;
     if (N1.is_empty()) return *this;
@@ -1453,7 +1481,7 @@ protected:
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, DIFF> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo(res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _diff);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _diff, tag);
     return res;
   }
 
@@ -1461,6 +1489,14 @@ protected:
   symmetric_difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
   /*{\Mop returns the symmectric difference |\Mvar - T| $\cup$
           |T - \Mvar|. }*/ {
+    return symmetric_difference(N1, Sequential_tag());
+  }
+
+  template <typename ConcurrencyTag>
+  Nef_polyhedron_3<Kernel,Items, Mark>
+  symmetric_difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1, ConcurrencyTag tag) const
+  /*{\Mop same as above. With |ConcurrencyTag| being |Parallel_tag|,
+    the operation is performed in parallel. }*/ {
     CGAL_NEF_TRACEN(" symmetric difference between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return N1;
     if (N1.is_empty()) return *this;
@@ -1470,7 +1506,7 @@ protected:
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, XOR> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo(res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _xor);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _xor, tag);
     return res;
   }
 
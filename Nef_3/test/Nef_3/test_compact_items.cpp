@@ -0,0 +1,132 @@
+// Checks that the Boolean operations on Nef polyhedra with SNC_compact_items
+// give valid polyhedra, equal to the ones obtained with SNC_indexed_items.
+
+#include <CGAL/Exact_integer.h>
+#include <CGAL/Homogeneous.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Homogeneous<CGAL::Exact_integer> Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef Kernel::Vector_3 Vector_3;
+typedef Kernel::Aff_transformation_3 Aff_transformation_3;
+typedef CGAL::Polyhedron_3<Kernel> Polyhedron;
+typedef CGAL::Nef_polyhedron_3<Kernel, CGAL::SNC_indexed_items> Nef_indexed;
+typedef CGAL::Nef_polyhedron_3<Kernel, CGAL::SNC_compact_items> Nef_compact;
+
+Polyhedron cube(int x, int y, int z, int size)
+{
+  Polyhedron P;
+  CGAL::make_hexahedron(Point_3(x, y, z), Point_3(x+size, y, z),
+                        Point_3(x+size, y+size, z), Point_3(x, y+size, z),
+                        Point_3(x, y+size, z+size), Point_3(x, y, z+size),
+                        Point_3(x+size, y, z+size), Point_3(x+size, y+size, z+size), P);
+  return P;
+}
+
+Polyhedron tetrahedron(CGAL::Random& rnd)
+{
+  std::vector<Point_3> p;
+  do {
+    p.clear();
+    for(int i = 0; i < 4; ++i)
+      p.emplace_back(rnd.get_int(-2, 6), rnd.get_int(-2, 6), rnd.get_int(-2, 6));
+  } while(CGAL::orientation(p[0], p[1], p[2], p[3]) == CGAL::COPLANAR);
+  Polyhedron P;
+  CGAL::make_tetrahedron(p[0], p[1], p[2], p[3], P);
+  return P;
+}
+
+void check_same(Nef_compact& C, const Nef_indexed& N)
+{
+  assert(C.is_valid());
+  assert(C.number_of_vertices() == N.number_of_vertices());
+  assert(C.number_of_halfedges() == N.number_of_halfedges());
+  assert(C.number_of_edges() == N.number_of_edges());
+  assert(C.number_of_halffacets() == N.number_of_halffacets());
+  assert(C.number_of_facets() == N.number_of_facets());
+  assert(C.number_of_volumes() == N.number_of_volumes());
+  assert(C.number_of_sfaces() == N.number_of_sfaces());
+}
+
+void check_operations(const Polyhedron& P0, const Polyhedron& P1)
+{
+  Nef_compact C0(P0), C1(P1);
+  Nef_indexed N0(P0), N1(P1);
+  assert(C0.is_valid() && C1.is_valid());
+
+  Nef_compact C = C0.join(C1);
+  check_same(C, N0.join(N1));
+  C = C0.intersection(C1);
+  check_same(C, N0.intersection(N1));
+  C = C0.difference(C1);
+  check_same(C, N0.difference(N1));
+  C = C0.symmetric_difference(C1);
+  check_same(C, N0.symmetric_difference(N1));
+  assert(C == C0.join(C1) - C0.intersection(C1));
+
+  C = C0.complement();
+  check_same(C, N0.complement());
+  C = C0.boundary();
+  check_same(C, N0.boundary());
+  C = (C0 + C1).interior();
+  check_same(C, (N0 + N1).interior());
+  C = (C0 - C1).closure();
+  check_same(C, (N0 - N1).closure());
+
+  C = C0 * C1;
+  C += C1 - C0;
+  assert(C == C1);
+  C ^= C0;
+  assert(C.is_valid());
+  assert(C == (C0 ^ C1));
+}
+
+int main()
+{
+  // overlapping cubes, and cubes sharing a facet, an edge or a vertex
+  check_operations(cube(0, 0, 0, 4), cube(2, 2, 2, 4));
+  check_operations(cube(0, 0, 0, 4), cube(4, 1, 1, 2));
+  check_operations(cube(0, 0, 0, 4), cube(4, 4, 0, 4));
+  check_operations(cube(0, 0, 0, 4), cube(4, 4, 4, 4));
+
+  CGAL::Random rnd(0);
+  for(int i = 0; i < 10; ++i)
+    check_operations(tetrahedron(rnd), tetrahedron(rnd));
+
+  // a sequence of operations, with a transformation and a conversion
+  Nef_compact C(cube(0, 0, 0, 4));
+  Nef_indexed N(cube(0, 0, 0, 4));
+  for(int i = 1; i < 4; ++i) {
+    C += Nef_compact(cube(i, i, 2*i, 3));
+    N += Nef_indexed(cube(i, i, 2*i, 3));
+    C -= Nef_compact(cube(2*i-1, -1, -1, 2));
+    N -= Nef_indexed(cube(2*i-1, -1, -1, 2));
+    check_same(C, N);
+  }
+  C.transform(Aff_transformation_3(CGAL::TRANSLATION, Vector_3(1, 2, 3)));
+  N.transform(Aff_transformation_3(CGAL::TRANSLATION, Vector_3(1, 2, 3)));
+  check_same(C, N);
+
+  C = C.regularization();
+  N = N.regularization();
+  check_same(C, N);
+  assert(C.is_simple());
+  Polyhedron P0, P1;
+  C.convert_to_polyhedron(P0);
+  N.convert_to_polyhedron(P1);
+  assert(P0.size_of_vertices() == P1.size_of_vertices());
+  assert(P0.size_of_facets() == P1.size_of_facets());
+  assert(Nef_compact(P0) == C);
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Checks that the parallel Boolean operations compute the same
+// polyhedra as the sequential ones.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Nef_3/SNC_indexed_items.h>
+#include <CGAL/Nef_3/SNC_compact_items.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point_3;
+typedef CGAL::Polyhedron_3<Kernel> Polyhedron;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <class Nef_polyhedron>
+Nef_polyhedron tetrahedron(CGAL::Random& rnd)
+{
+  std::vector<Point_3> p;
+  for(int i = 0; i < 4; ++i)
+    p.emplace_back(rnd.get_int(-2, 6), rnd.get_int(-2, 6), rnd.get_int(-2, 6));
+  if(CGAL::orientation(p[0], p[1], p[2], p[3]) == CGAL::COPLANAR)
+    return Nef_polyhedron();
+  Polyhedron P;
+  CGAL::make_tetrahedron(p[0], p[1], p[2], p[3], P);
+  return Nef_polyhedron(P);
+}
+
+template <class Nef_polyhedron>
+Nef_polyhedron cube(int x, int y, int z, int size)
+{
+  Polyhedron P;
+  CGAL::make_hexahedron(Point_3(x, y, z), Point_3(x+size, y, z),
+                        Point_3(x+size, y+size, z), Point_3(x, y+size, z),
+                        Point_3(x, y+size, z+size), Point_3(x, y, z+size),
+                        Point_3(x+size, y, z+size), Point_3(x+size, y+size, z+size), P);
+  return Nef_polyhedron(P);
+}
+
+template <class Nef_polyhedron>
+void check_same(const Nef_polyhedron& N0, const Nef_polyhedron& N1)
+{
+  assert(N0.number_of_vertices() == N1.number_of_vertices());
+  assert(N0.number_of_halfedges() == N1.number_of_halfedges());
+  assert(N0.number_of_halffacets() == N1.number_of_halffacets());
+  assert(N0.number_of_volumes() == N1.number_of_volumes());
+  assert(N0.symmetric_difference(N1).is_empty());
+}
+
+template <class Nef_polyhedron>
+void test_operations(const Nef_polyhedron& N0, const Nef_polyhedron& N1)
+{
+  check_same(N0.intersection(N1), N0.intersection(N1, Concurrency_tag()));
+  check_same(N0.join(N1), N0.join(N1, Concurrency_tag()));
+  check_same(N0.difference(N1), N0.difference(N1, Concurrency_tag()));
+  check_same(N0.symmetric_difference(N1), N0.symmetric_difference(N1, Concurrency_tag()));
+}
+
+template <class Nef_polyhedron>
+void test(CGAL::Random& rnd)
+{
+  // vertices on vertices, edges and facets
+  Nef_polyhedron C0 = cube<Nef_polyhedron>(0, 0, 0, 4);
+  test_operations(C0, cube<Nef_polyhedron>(2, 2, 2, 4));
+  test_operations(C0, cube<Nef_polyhedron>(0, 2, 2, 4));
+  test_operations(C0, cube<Nef_polyhedron>(4, 0, 0, 4));
+  test_operations(C0, cube<Nef_polyhedron>(1, 1, 1, 2));
+
+  // edges crossing edges and facets in general position
+  Nef_polyhedron U, U_par;
+  for(int i = 0; i < 6; ++i)
+  {
+    Nef_polyhedron T = tetrahedron<Nef_polyhedron>(rnd);
+    test_operations(C0, T);
+    Nef_polyhedron U_seq = U.join(T);
+    U_par = U_par.join(T, Concurrency_tag());
+    check_same(U_seq, U_par);
+    U = U_seq;
+  }
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  test<CGAL::Nef_polyhedron_3<Kernel> >(rnd);
+  test<CGAL::Nef_polyhedron_3<Kernel, CGAL::SNC_indexed_items> >(rnd);
+  test<CGAL::Nef_polyhedron_3<Kernel, CGAL::SNC_compact_items> >(rnd);
+  std::cout << "OK" << std::endl;
+  return 0;
+}
@@ -200,7 +200,7 @@ SHalfloop_iterator shalfloops_begin() const
 SHalfloop_iterator shalfloops_end() const
 { return psm_->shalfloops_end(); }
 
-SHalfloop_handle& shalfloop()
+decltype(auto) shalfloop()
 { return psm_->shalfloop(); }
 SHalfloop_const_handle shalfloop() const
 { return psm_->shalfloop(); }
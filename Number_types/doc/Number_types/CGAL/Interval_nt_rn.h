@@ -0,0 +1,137 @@
+
+namespace CGAL {
+
+/*!
+\ingroup nt_cgal
+
+The class `Interval_nt_rn` provides an interval arithmetic number type
+which, contrary to `Interval_nt`, does not change the rounding mode of the
+processor: all its operations are performed in the default rounding mode,
+to the nearest.
+
+An interval is represented by a midpoint and a radius, and the
+operations follow the midpoint-radius arithmetic of Rump
+("Fast and parallel interval arithmetic", BIT 39(3), 1999): the rounding
+error of the midpoint of a sum or of a product is computed exactly, with
+TwoSum or with a fused multiply-add when available, and it is added with
+the radii of the operands to the radius of the result, with a small relative
+and absolute margin covering the roundoff errors of the radius itself.
+As with `Interval_nt`, all arithmetic operations preserve the inclusion,
+and exact operations on points produce points, so that, for example, the
+exact zeros of predicates evaluated on small integer coordinates are
+certified. The intervals are slightly wider than those of `Interval_nt`.
+
+The additions, subtractions and multiplications do not contain branches nor
+opaque assembly, so that compilers can inline and vectorize them. This
+number type is meant to be used in loops evaluating many predicates at once,
+where it can be faster than `Interval_nt` when vector and fused
+multiply-add instructions are enabled, or where changing the rounding mode is
+not possible. For isolated predicates, `Interval_nt` is faster.
+
+Overflows produce infinite or NaN midpoints or radii, for which all
+comparisons are uncertain.
+
+\pre The rounding mode is to the nearest when operations are performed
+on this number type, and subnormal numbers are not flushed to zero.
+In particular, it must not be used in the scope of a
+`Protect_FPU_rounding` object.
+
+\cgalModels{FieldWithSqrt,RealEmbeddable}
+
+\sa `CGAL::Interval_nt<Protected>`
+\sa `CGAL::Filtered_predicate`
+*/
+class Interval_nt_rn {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+The type of the midpoint, of the radius and of the bounds of the interval.
+*/
+typedef double value_type;
+
+/*!
+The type of the
+exceptions raised when uncertain comparisons are performed.
+*/
+typedef Uncertain_conversion_exception unsafe_comparison;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+introduces a small interval containing \a i (possibly a point).
+*/
+Interval_nt_rn(long long i);
+
+/*!
+introduces the interval [`d`;`d`].
+*/
+Interval_nt_rn(double d);
+
+/*!
+introduces a small interval containing [`i`;`s`].
+*/
+Interval_nt_rn(double i, double s);
+
+/*!
+introduces a small interval containing [`p.first`;`p.second`].
+*/
+Interval_nt_rn(std::pair<double, double> p);
+
+/// @}
+
+/// \name Operations
+/// All functions required by a class to be considered as a \cgal number type (see \ref Numbertype) are present, as well as the utility functions, sometimes with a particular semantic which is described below. There are also a few additional functions.
+/// @{
+
+/*!
+returns an interval containing all reals when the denominator contains 0.
+*/
+Interval_nt_rn operator/(Interval_nt_rn J);
+
+/*!
+returns the midpoint of the interval.
+*/
+double midpoint();
+
+/*!
+returns the radius of the interval.
+*/
+double radius();
+
+/*!
+returns a lower bound of the interval.
+*/
+double inf();
+
+/*!
+returns an upper bound of the interval.
+*/
+double sup();
+
+/*!
+returns whether the radius is zero.
+*/
+bool is_point();
+
+/*!
+returns whether both intervals have
+the same midpoint and radius.
+*/
+bool is_same(Interval_nt_rn J);
+
+/*!
+returns whether both intervals
+have a non empty intersection.
+*/
+bool do_overlap(Interval_nt_rn J);
+
+/// @}
+
+}; /* end Interval_nt_rn */
+} /* end namespace CGAL */
@@ -0,0 +1,683 @@
+// Copyright (c) 2024 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent
+
+#ifndef CGAL_INTERVAL_NT_RN_H
+#define CGAL_INTERVAL_NT_RN_H
+
+// This file contains the class Interval_nt_rn, an interval arithmetic number
+// type that does not need the rounding mode to be changed.
+//
+// An interval is stored as a midpoint m and a radius r, and represents the
+// real numbers x with |x - m| <= r.  The operations follow the midpoint-radius
+// arithmetic of Rump ("Fast and parallel interval arithmetic", BIT 1999) in
+// the default rounding mode, to nearest:
+//
+// - The midpoint is the rounded result of the operation on the midpoints.
+//   The rounding error of sums is computed exactly with TwoSum, and the one
+//   of products with an FMA, or bounded by half an ulp without a fast FMA.
+// - The radius is the sum of this error and of the propagated radii, scaled
+//   by 1 + 2^-50 to absorb the rounding errors of its own computation, and
+//   increased by 2^-1022 when the operands could underflow.
+//
+// Exact operations on points thus give points, so that exact computations,
+// and in particular exact zeros, are certified as with Interval_nt.  There
+// are no rounding mode switches, no opaque asm and no branches in additions,
+// subtractions and multiplications, so compilers can inline, schedule and
+// vectorize them, and the sign of an interval is obtained with a single
+// comparison.  The intervals are slightly wider than those of Interval_nt,
+// which is irrelevant for filtering.  Divisions and square roots, which are
+// rare in predicates, are computed from the bounds.
+//
+// Overflows produce infinite or NaN midpoints or radii, for which all
+// comparisons are uncertain.  Contrary to Interval_nt, this type must not be
+// used while the rounding mode is changed (e.g. by a Protect_FPU_rounding
+// object), and subnormals must not be flushed to zero.
+
+#include <CGAL/number_type_config.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/utils_classes.h>
+#include <CGAL/Uncertain.h>
+#include <CGAL/Coercion_traits.h>
+#include <CGAL/double.h>
+#include <CGAL/IO/io.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <utility>
+
+namespace CGAL {
+
+class Interval_nt_rn
+{
+  typedef Interval_nt_rn             IA;
+  typedef std::pair<double, double>  Pair;
+
+public:
+
+  typedef double      value_type;
+
+  typedef Uncertain_conversion_exception  unsafe_comparison;
+
+  Interval_nt_rn()
+#ifndef CGAL_NO_ASSERTIONS
+    : _mid(-0.5), _rad(0.5)  // to early and deterministically detect use of uninitialized
+#endif
+  {}
+
+  Interval_nt_rn(int i) : _mid(i), _rad(0) {}
+
+  Interval_nt_rn(unsigned i) : _mid(i), _rad(0) {}
+
+  Interval_nt_rn(long long i)
+    : _mid(static_cast<double>(i)), _rad(0)
+  {
+    const long long safe = 1LL << 53;
+    if (i > safe || i < -safe)
+      _rad = std::fabs(_mid) * 0x1p-52;
+  }
+
+  Interval_nt_rn(unsigned long long i)
+    : _mid(static_cast<double>(i)), _rad(0)
+  {
+    const unsigned long long safe = 1ULL << 53;
+    if (i > safe)
+      _rad = _mid * 0x1p-52;
+  }
+
+  Interval_nt_rn(long i)
+  {
+    *this = (sizeof(int)==sizeof(long)) ? IA((int)i) : IA((long long)i);
+  }
+
+  Interval_nt_rn(unsigned long i)
+  {
+    *this = (sizeof(int)==sizeof(long)) ? IA((unsigned)i) : IA((unsigned long long)i);
+  }
+
+  Interval_nt_rn(double d)
+    : _mid(d), _rad(0)
+  {
+    CGAL_assertion(is_finite(d));
+  }
+
+  // Unchecked version, from a midpoint and a radius.
+  struct no_check_t {};
+  Interval_nt_rn(double m, double r, no_check_t)
+    : _mid(m), _rad(r)
+  {}
+
+  Interval_nt_rn(double i, double s)
+  {
+    CGAL_assertion_msg( (!is_valid(i)) || (!is_valid(s)) || (!(i>s)),
+              " Variable used before being initialized (or CGAL bug)");
+    *this = from_bounds(i, s);
+  }
+
+  Interval_nt_rn(const Pair & p)
+    : Interval_nt_rn(p.first, p.second)
+  {}
+
+  // Returns a double larger than the exact result of any operation whose
+  // result rounded to nearest is `c`: the successor computation of Rump,
+  // Zimmermann, Boldo and Melquiond (BIT 2009) with a margin twice as large,
+  // which stays valid if the compiler contracts the operation and the
+  // addition of the margin into an FMA.
+  static double round_up(double c)
+  {
+    return c + (std::fabs(c) * 0x1p-52 + 0x1p-1022);
+  }
+
+  // Returns a double smaller than the exact result of any operation whose
+  // result rounded to nearest is `c`.
+  static double round_down(double c)
+  {
+    return - round_up(-c);
+  }
+
+  IA operator-() const { return IA(-_mid, _rad, no_check_t()); }
+
+  IA & operator+= (const IA &d) { return *this = *this + d; }
+  IA & operator-= (const IA &d) { return *this = *this - d; }
+  IA & operator*= (const IA &d) { return *this = *this * d; }
+  IA & operator/= (const IA &d) { return *this = *this / d; }
+
+  bool is_point() const
+  {
+    return _rad == 0;
+  }
+
+  bool is_same (const IA & d) const
+  {
+    return _mid == d._mid && _rad == d._rad;
+  }
+
+  bool do_overlap (const IA & d) const
+  {
+    return !(d.inf() > sup() || d.sup() < inf());
+  }
+
+  double midpoint() const { return _mid; }
+  double radius() const { return _rad; }
+
+  double inf() const { return (_rad == 0) ? _mid : round_down(_mid - _rad); }
+  double sup() const { return (_rad == 0) ? _mid : round_up(_mid + _rad); }
+
+  std::pair<double, double> pair() const
+  {
+    return std::pair<double, double>(inf(), sup());
+  }
+
+  static IA largest()
+  {
+    return IA(0, std::numeric_limits<double>::infinity(), no_check_t());
+  }
+
+  static IA smallest()
+  {
+    return IA(0, std::numeric_limits<double>::denorm_min(), no_check_t());
+  }
+
+  // Returns the smallest interval, in this representation, containing [i,s].
+  static IA from_bounds(double i, double s)
+  {
+    if (i == s)
+      return IA(i, 0, no_check_t());
+    if (! (is_finite(i) && is_finite(s)))
+      return largest();
+    double m = i * 0.5 + s * 0.5;
+    return IA(m, round_up((std::max)(m - i, s - m)), no_check_t());
+  }
+
+private:
+
+  double _mid, _rad;
+
+  // 1 + 2^-50 covers the rounding errors of the at most five operations
+  // computing a radius, which are all nonnegative.
+  static double scale_radius(double r)
+  {
+    return r * (1 + 0x1p-50);
+  }
+
+  // Returns a bound on the error of the product p of x and y, rounded to
+  // nearest, which is zero if the product is exact.  It is not a bound if
+  // the product underflows, which the caller has to check.
+  static double product_error(double x, double y, double p)
+  {
+#if defined(FP_FAST_FMA) || defined(__FMA__) || defined(__AVX2__)
+    return std::fabs(std::fma(x, y, -p));
+#else
+    // Veltkamp's splitting leaves x unchanged iff it fits in 26 bits,
+    // and the product of two such numbers fits in 53 bits.
+    const double c = 0x1p27 + 1;
+    double cx = c * x, cy = c * y;
+    bool short_x = (cx - (cx - x)) == x;
+    bool short_y = (cy - (cy - y)) == y;
+    double ap = std::fabs(p);
+    bool exact = short_x & short_y & (ap <= (std::numeric_limits<double>::max)());
+    return exact ? 0. : ap * 0x1p-53;
+#endif
+  }
+
+  // The sum of the midpoints, whose error is computed exactly with TwoSum
+  // (Knuth).  The error is NaN in case of overflow.
+  static IA add(double am, double ar, double bm, double br)
+  {
+    double m = am + bm;
+    double z = m - am;
+    double err = (am - (m - z)) + (bm - z);
+    return IA(m, scale_radius((ar + br) + std::fabs(err)), no_check_t());
+  }
+
+  friend
+    Interval_nt_rn
+    operator+ (const Interval_nt_rn &a, const Interval_nt_rn & b)
+    {
+      return add(a._mid, a._rad, b._mid, b._rad);
+    }
+
+  friend
+    Interval_nt_rn
+    operator+( const Interval_nt_rn& a ) {
+      return a;
+    }
+
+  friend
+    Interval_nt_rn
+    operator- (const Interval_nt_rn &a, const Interval_nt_rn & b)
+    {
+      return add(a._mid, a._rad, -b._mid, b._rad);
+    }
+
+  friend
+    Interval_nt_rn
+    operator* (const Interval_nt_rn &a, const Interval_nt_rn & b)
+    {
+      double m = a._mid * b._mid;
+      double err = product_error(a._mid, b._mid, m);
+      double am = std::fabs(a._mid), bm = std::fabs(b._mid);
+      // |(am + da)(bm + db) - m| <= err + am*|db| + (bm + |db|)*|da|
+      double r = (am * b._rad + (bm + b._rad) * a._rad) + err;
+      // Only the exact products of points are not increased by 2^-1022,
+      // which covers the errors of the products which underflow.
+      bool underflow = (std::fabs(m) < 0x1p-969) & (a._mid != 0) & (b._mid != 0);
+      bool exact = ((a._rad + b._rad) + err == 0) & !underflow;
+      return IA(m, scale_radius(r + (exact ? 0. : 0x1p-1022)), no_check_t());
+    }
+
+  friend
+    Interval_nt_rn
+    operator/ (const Interval_nt_rn &a, const Interval_nt_rn & b)
+    {
+      if (a.is_point() && b.is_point())
+      {
+        // The quotient of points is exact if it multiplies back exactly.
+        double q = a._mid / b._mid;
+        double p = q * b._mid;
+        if (p == a._mid && product_error(q, b._mid, p) == 0 &&
+            (q == 0 || std::fabs(p) >= 0x1p-969) && is_finite(q))
+          return IA(q, 0, no_check_t());
+      }
+      double bi = b.inf(), bs = b.sup();
+      // We could do slightly better when one bound of b is 0.
+      if (! (bi > 0 || bs < 0))
+        return largest();
+      double ai = a.inf(), as = a.sup();
+      double q1 = ai / bi, q2 = ai / bs, q3 = as / bi, q4 = as / bs;
+      if (! (is_finite(q1) && is_finite(q2) && is_finite(q3) && is_finite(q4)))
+        return largest();
+      return from_bounds(round_down((std::min)((std::min)(q1, q2), (std::min)(q3, q4))),
+                         round_up((std::max)((std::max)(q1, q2), (std::max)(q3, q4))));
+    }
+
+  friend Uncertain<Sign> sign_of_difference(const Interval_nt_rn &a, const Interval_nt_rn &b);
+
+  friend
+    Uncertain<bool>
+    operator<(const Interval_nt_rn &a, const Interval_nt_rn &b)
+    {
+      return sign_of_difference(a, b) == NEGATIVE;
+    }
+
+  friend
+    Uncertain<bool>
+    operator>(const Interval_nt_rn &a, const Interval_nt_rn &b)
+    { return b < a; }
+
+  friend
+    Uncertain<bool>
+    operator<=(const Interval_nt_rn &a, const Interval_nt_rn &b)
+    {
+      return sign_of_difference(a, b) != POSITIVE;
+    }
+
+  friend
+    Uncertain<bool>
+    operator>=(const Interval_nt_rn &a, const Interval_nt_rn &b)
+    { return b <= a; }
+
+  friend
+    Uncertain<bool>
+    operator==(const Interval_nt_rn &a, const Interval_nt_rn &b)
+    {
+      return sign_of_difference(a, b) == ZERO;
+    }
+
+  friend
+    Uncertain<bool>
+    operator!=(const Interval_nt_rn &a, const Interval_nt_rn &b)
+    { return ! (a == b); }
+
+  friend
+    std::ostream & operator<< (std::ostream &os, const Interval_nt_rn & I )
+    {
+      return os << "[" << I.inf() << ";" << I.sup() << "]";
+    }
+
+  friend
+    std::istream & operator>> (std::istream &is, Interval_nt_rn & I)
+    {
+      char c;
+      do is.get(c); while (isspace(c));
+      is.putback(c);
+      if(c == '['){ // read the output of operator<<
+        double inf, sup;
+        is.get(c);
+        is >> IO::iformat(inf);
+        do is.get(c); while (isspace(c));
+        if (c != ';') is.setstate(std::ios_base::failbit);
+        is >> IO::iformat(sup);
+        do is.get(c); while (isspace(c));
+        if (c != ']') is.setstate(std::ios_base::failbit);
+        if (is) I = Interval_nt_rn(inf, sup);
+      }else{
+        double d;
+        is >> d;
+        if (is) I = d;
+      }
+      return is;
+    }
+};
+
+
+// Non-documented
+inline
+bool
+fit_in_double (const Interval_nt_rn & d, double &r)
+{
+  bool b = d.is_point();
+  if (b)
+    r = d.midpoint();
+  return b;
+}
+
+// Non-documented
+inline
+double
+width (const Interval_nt_rn & d)
+{
+  return d.sup() - d.inf();
+}
+
+template<>
+class Is_valid< Interval_nt_rn >
+  : public CGAL::cpp98::unary_function< Interval_nt_rn, bool > {
+  public :
+    bool operator()( const Interval_nt_rn& x ) const {
+      return is_valid(x.midpoint()) &&
+             is_valid(x.radius()) &&
+             x.radius() >= 0;
+    }
+};
+
+template <>
+struct Min <Interval_nt_rn>
+  : public CGAL::cpp98::binary_function<Interval_nt_rn, Interval_nt_rn, Interval_nt_rn>
+{
+  Interval_nt_rn operator()( const Interval_nt_rn& d, const Interval_nt_rn& e) const
+  {
+    return Interval_nt_rn::from_bounds((std::min)(d.inf(), e.inf()),
+                                       (std::min)(d.sup(), e.sup()));
+  }
+};
+
+template <>
+struct Max <Interval_nt_rn>
+  : public CGAL::cpp98::binary_function<Interval_nt_rn, Interval_nt_rn, Interval_nt_rn>
+{
+  Interval_nt_rn operator()( const Interval_nt_rn& d, const Interval_nt_rn& e) const
+  {
+    return Interval_nt_rn::from_bounds((std::max)(d.inf(), e.inf()),
+                                       (std::max)(d.sup(), e.sup()));
+  }
+};
+
+inline
+Interval_nt_rn min BOOST_PREVENT_MACRO_SUBSTITUTION(const Interval_nt_rn & x,
+                                                    const Interval_nt_rn & y)
+{
+  return CGAL::Min<Interval_nt_rn>()(x,y);
+}
+
+inline
+Interval_nt_rn max BOOST_PREVENT_MACRO_SUBSTITUTION(const Interval_nt_rn & x,
+                                                    const Interval_nt_rn & y)
+{
+  return CGAL::Max<Interval_nt_rn>()(x,y);
+}
+
+
+namespace INTERN_INTERVAL_NT_RN {
+
+  inline
+  Interval_nt_rn
+  sqrt (const Interval_nt_rn & d)
+  {
+    // sqrt([-a,+b]) => [0;sqrt(+b)] => assumes roundoff error.
+    // sqrt([-a,-b]) => [0;0] => assumes user bug (unspecified result).
+    if (d.is_point())
+    {
+      double s = std::sqrt((std::max)(d.midpoint(), 0.));
+      double s2 = s * s;
+      if (s2 == d.midpoint() && (s == 0 || s2 >= 0x1p-969) &&
+          s2 <= (std::numeric_limits<double>::max)() &&
+          std::fabs(std::fma(s, s, -s2)) == 0)
+        return Interval_nt_rn(s, 0, Interval_nt_rn::no_check_t());
+    }
+    double i = std::sqrt((std::max)(d.inf(), 0.));
+    double s = std::sqrt((std::max)(d.sup(), 0.));
+    return Interval_nt_rn::from_bounds((std::max)(Interval_nt_rn::round_down(i), 0.),
+                                       Interval_nt_rn::round_up(s));
+  }
+
+  inline
+  Interval_nt_rn
+  abs (const Interval_nt_rn & d)
+  {
+    double am = std::fabs(d.midpoint());
+    if (d.radius() <= am)
+      return Interval_nt_rn(am, d.radius(), Interval_nt_rn::no_check_t());
+    return Interval_nt_rn::from_bounds(0.0, Interval_nt_rn::round_up(am + d.radius()));
+  }
+
+  inline
+  Interval_nt_rn
+  square (const Interval_nt_rn & d)
+  {
+    return d * d;
+  }
+
+  inline
+  Uncertain<Sign>
+  sign (const Interval_nt_rn & d)
+  {
+    // Comparisons with NaN are false.
+    if (d.radius() <  d.midpoint()) return POSITIVE;
+    if (d.radius() < -d.midpoint()) return NEGATIVE;
+    if (d.radius() == 0 && d.midpoint() == 0) return ZERO;
+    return Uncertain<Sign>::indeterminate();
+  }
+
+  inline
+  Uncertain<Comparison_result>
+  compare (const Interval_nt_rn & d, const Interval_nt_rn & e)
+  {
+    return enum_cast<Comparison_result>(INTERN_INTERVAL_NT_RN::sign(d - e));
+  }
+
+  inline
+  Uncertain<bool>
+  is_zero (const Interval_nt_rn & d)
+  {
+    return INTERN_INTERVAL_NT_RN::sign(d) == ZERO;
+  }
+
+  inline
+  Uncertain<bool>
+  is_positive (const Interval_nt_rn & d)
+  {
+    return INTERN_INTERVAL_NT_RN::sign(d) == POSITIVE;
+  }
+
+  inline
+  Uncertain<bool>
+  is_negative (const Interval_nt_rn & d)
+  {
+    return INTERN_INTERVAL_NT_RN::sign(d) == NEGATIVE;
+  }
+
+} // namespace INTERN_INTERVAL_NT_RN
+
+inline
+Uncertain<Sign>
+sign_of_difference(const Interval_nt_rn &a, const Interval_nt_rn &b)
+{
+  return INTERN_INTERVAL_NT_RN::sign(a - b);
+}
+
+
+template <> class Algebraic_structure_traits< Interval_nt_rn >
+  : public Algebraic_structure_traits_base< Interval_nt_rn, Field_with_sqrt_tag >  {
+  public:
+    typedef Interval_nt_rn      Type;
+    typedef Tag_false           Is_exact;
+    typedef Tag_true            Is_numerical_sensitive;
+    typedef Uncertain<bool>     Boolean;
+
+    class Is_zero
+      : public CGAL::cpp98::unary_function< Type, Boolean > {
+      public:
+        Boolean operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT_RN::is_zero( x );
+        }
+    };
+
+    // Specialized just to specify the result type
+    class Is_one
+      : public CGAL::cpp98::unary_function< Type, Boolean > {
+      public:
+        Boolean operator()( const Type& x ) const {
+          return x == 1;
+        }
+    };
+
+    class Square
+      : public CGAL::cpp98::unary_function< Type, Type > {
+      public:
+        Type operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT_RN::square( x );
+        }
+    };
+
+    class Sqrt
+      : public CGAL::cpp98::unary_function< Type, Type > {
+      public:
+        Type operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT_RN::sqrt( x );
+        }
+    };
+
+    struct Is_square
+      : public CGAL::cpp98::binary_function< Type, Type&, Boolean > {
+        Boolean operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT_RN::is_positive( x );
+        }
+
+        Boolean operator()( const Type& x, Type& result ) const {
+          Boolean is_positive = INTERN_INTERVAL_NT_RN::is_positive( x );
+          if ( is_positive.inf() == true )
+            result = INTERN_INTERVAL_NT_RN::sqrt( x );
+          else
+            result = INTERN_INTERVAL_NT_RN::sqrt( INTERN_INTERVAL_NT_RN::abs( x ) );
+          return is_positive;
+        }
+    };
+
+  class Divides
+    : public CGAL::cpp98::binary_function< Type, Type, Boolean > {
+  public:
+    Boolean operator()( const Type& x, const Type&) const {
+      return ! Is_zero()(x);
+    }
+    // second operator computing q
+    Boolean operator()( const Type& x, const Type& y, Type& q) const {
+      if (! Is_zero()(x) )
+        q  = y/x ;
+      return Boolean(true);
+    }
+  };
+};
+
+template <> class Real_embeddable_traits< Interval_nt_rn >
+  : public INTERN_RET::Real_embeddable_traits_base< Interval_nt_rn , CGAL::Tag_true> {
+  public:
+    typedef Interval_nt_rn  Type;
+    typedef Uncertain<CGAL::Sign> Sign;
+    typedef Uncertain<bool> Boolean;
+    typedef Uncertain<CGAL::Comparison_result> Comparison_result;
+
+    class Abs
+      : public CGAL::cpp98::unary_function< Type, Type > {
+      public:
+        Type operator()( const Type& x ) const {
+            return INTERN_INTERVAL_NT_RN::abs( x );
+        }
+    };
+
+    class Sgn
+        : public CGAL::cpp98::unary_function< Type, Uncertain< ::CGAL::Sign > > {
+      public:
+        Uncertain< ::CGAL::Sign > operator()( const Type& x ) const {
+            return INTERN_INTERVAL_NT_RN::sign( x );
+        }
+    };
+
+    class Is_positive
+      : public CGAL::cpp98::unary_function< Type, Uncertain<bool> > {
+      public:
+        Uncertain<bool> operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT_RN::is_positive( x );
+        }
+    };
+
+    class Is_negative
+      : public CGAL::cpp98::unary_function< Type, Uncertain<bool> > {
+      public:
+        Uncertain<bool> operator()( const Type& x ) const {
+          return INTERN_INTERVAL_NT_RN::is_negative( x );
+        }
+    };
+
+    class Compare
+      : public CGAL::cpp98::binary_function< Type, Type, Comparison_result > {
+      public:
+      Comparison_result operator()( const Type& x, const Type& y ) const {
+        return INTERN_INTERVAL_NT_RN::compare( x, y );
+      }
+      CGAL_IMPLICIT_INTEROPERABLE_BINARY_OPERATOR_WITH_RT( Type,
+          Comparison_result )
+    };
+
+    class To_double
+      : public CGAL::cpp98::unary_function< Type, double > {
+      public:
+        double operator()( const Type& x ) const {
+            return x.midpoint();
+        }
+    };
+
+    class To_interval
+      : public CGAL::cpp98::unary_function< Type, std::pair< double, double > > {
+      public:
+        std::pair<double, double> operator()( const Type& x ) const {
+            return x.pair();
+        }
+    };
+
+    class Is_finite
+      : public CGAL::cpp98::unary_function< Type, Boolean > {
+      public :
+        Boolean operator()( const Type& x ) const {
+          return CGAL_NTS is_finite( x.inf() ) && CGAL_NTS is_finite( x.sup() );
+        }
+    };
+};
+
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(short, Interval_nt_rn)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(int, Interval_nt_rn)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(float, Interval_nt_rn)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(double, Interval_nt_rn)
+
+} //namespace CGAL
+
+#endif // CGAL_INTERVAL_NT_RN_H
@@ -0,0 +1,229 @@
+// Test file for the Interval_nt_rn class.
+
+#include <CGAL/config.h>
+#include <CGAL/Interval_nt_rn.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/MP_Float.h>
+#include <CGAL/Quotient.h>
+#include <CGAL/Random.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Filtered_predicate.h>
+#include <CGAL/Cartesian_converter.h>
+#include <CGAL/Test/_test_algebraic_structure.h>
+#include <CGAL/Test/_test_real_embeddable.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+typedef CGAL::Interval_nt_rn IA;
+typedef CGAL::Quotient<CGAL::MP_Float> Exact;
+
+const double inf = std::numeric_limits<double>::infinity();
+const double max_double = (std::numeric_limits<double>::max)();
+
+bool is_finite(const IA& i)
+{
+  return CGAL::is_finite(i.midpoint()) && CGAL::is_finite(i.radius());
+}
+
+// Overflows may produce infinite or NaN midpoints and radii, which are fine
+// as long as the sign is not certain.
+bool contains(const IA& i, const Exact& e)
+{
+  if(!is_finite(i))
+    return !CGAL::is_certain(CGAL::sign(i)) ||
+           (CGAL::is_finite(i.midpoint()) && i.radius() == inf);
+  const Exact d = e - Exact(i.midpoint()), r(i.radius());
+  return -r <= d && d <= r;
+}
+
+// The exact bounds of the midpoint-radius representation.
+std::vector<Exact> corners(const IA& i)
+{
+  std::vector<Exact> res;
+  if(is_finite(i))
+  {
+    res.push_back(Exact(i.midpoint()) - Exact(i.radius()));
+    res.push_back(Exact(i.midpoint()) + Exact(i.radius()));
+  }
+  return res;
+}
+
+double random_double(CGAL::Random& rnd)
+{
+  switch(rnd.get_int(0, 5))
+  {
+    case 0: return rnd.get_double(-1, 1);
+    case 1: return rnd.get_int(-1000, 1000);
+    case 2: return std::ldexp(rnd.get_double(-1, 1), rnd.get_int(-1070, -960));
+    case 3: return std::ldexp(rnd.get_double(-1, 1), rnd.get_int(900, 1023));
+    default: return rnd.get_int(-3, 3) + std::ldexp(rnd.get_double(-1, 1), -40);
+  }
+}
+
+IA random_interval(CGAL::Random& rnd)
+{
+  double a = random_double(rnd);
+  if(rnd.get_bool())
+    return IA(a);
+  double b = random_double(rnd);
+  return IA((std::min)(a, b), (std::max)(a, b));
+}
+
+// Checks that the results of the operations contain the exact results
+// computed from the bounds of the operands.
+void inclusion_test(CGAL::Random& rnd)
+{
+  for(int i = 0; i < 20000; ++i)
+  {
+    const IA a = random_interval(rnd), b = random_interval(rnd);
+    const IA s = a + b, d = a - b, p = a * b;
+    const IA sa = CGAL::square(a), r = CGAL::sqrt(CGAL::abs(a));
+    if(std::fabs(a.inf()) < 0x1p500 && std::fabs(a.sup()) < 0x1p500 &&
+       std::fabs(b.inf()) < 0x1p500 && std::fabs(b.sup()) < 0x1p500)
+    {
+      assert(CGAL::is_valid(s) && CGAL::is_valid(d) && CGAL::is_valid(p));
+      assert(CGAL::is_valid(sa) && CGAL::is_valid(r));
+    }
+
+    // inf() and sup() enclose the representation.
+    if(is_finite(a))
+      assert(Exact(a.inf()) <= corners(a)[0] && corners(a)[1] <= Exact(a.sup()));
+
+    // The extrema are reached at the bounds of the operands.
+    const std::vector<Exact> cr = corners(r);
+    for(const Exact& x : corners(a))
+    {
+      assert(contains(sa, x * x));
+      // sqrt: r_inf^2 <= |x| <= r_sup^2
+      const Exact ax = CGAL::abs(x);
+      if(!cr.empty())
+      {
+        assert(cr[0] <= Exact(0) || cr[0] * cr[0] <= ax);
+        assert(cr[1] * cr[1] >= ax);
+      }
+      for(const Exact& y : corners(b))
+      {
+        assert(contains(s, x + y));
+        assert(contains(d, x - y));
+        assert(contains(p, x * y));
+        if(b.inf() > 0 || b.sup() < 0)
+          assert(contains(a / b, x / y));
+      }
+    }
+
+    // Exact sums and products of points are points.
+    if(a.is_point() && b.is_point())
+    {
+      const Exact ex(a.inf()), ey(b.inf());
+      if(Exact(s.inf()) == ex + ey)
+        assert(s.is_point());
+      if(std::fabs(a.inf()) < 1e6 && std::fabs(b.inf()) < 1e6 &&
+         a.inf() == std::floor(a.inf()) && b.inf() == std::floor(b.inf()))
+        assert(p.is_point() && sa.is_point());
+    }
+
+    // The results are not much wider than with directed rounding,
+    // away from the underflow range.
+    if(a.is_point() && b.is_point() && CGAL::is_finite(p) &&
+       std::fabs(p.midpoint()) > 0x1p-900)
+    {
+      CGAL::Interval_nt<> ap = CGAL::Interval_nt<>(a.inf()) * CGAL::Interval_nt<>(b.inf());
+      assert(p.inf() <= ap.inf() && ap.sup() <= p.sup());
+      double up = ap.sup();
+      for(int k = 0; k < 3; ++k)
+        up = std::nextafter(up, inf);
+      assert(p.sup() <= up);
+    }
+  }
+}
+
+void special_values_test()
+{
+  // Overflow.
+  IA a(1e300), b(-1e300), c(max_double);
+  assert(!CGAL::is_certain(CGAL::sign(a * a)));
+  assert(!CGAL::is_certain(CGAL::sign(a * b)));
+  assert(!CGAL::is_certain(CGAL::sign(c + c)));
+  assert(!CGAL::is_certain(CGAL::sign(a * a - a * a)));
+
+  // Underflow.
+  IA t(1e-200);
+  IA u = t * t;
+  assert(u.inf() <= 0 && u.sup() > 0);
+  assert(!CGAL::is_certain(CGAL::sign(u)));
+
+  // Infinite bounds and division by an interval containing zero.
+  IA l = IA(1) / IA(-1, 1);
+  assert(l.is_same(IA::largest()));
+  assert(!CGAL::is_certain(CGAL::sign(IA(0) * l)));
+  assert(!CGAL::is_finite(IA(2) * l));
+  assert((IA(1, 2) / IA(2, inf)).inf() <= 0);
+
+  // Exact zeros are certified.
+  IA z = IA(3) * IA(5) - IA(15);
+  assert(z.is_point() && CGAL::sign(z) == CGAL::ZERO);
+  IA z2 = IA(0.5) / IA(4) - IA(0.125);
+  assert(z2.is_point() && CGAL::sign(z2) == CGAL::ZERO);
+  IA z3 = CGAL::sqrt(IA(2.25)) - IA(1.5);
+  assert(z3.is_point() && CGAL::sign(z3) == CGAL::ZERO);
+
+  // Integers which are not exactly representable.
+  IA big((1LL << 62) + 1);
+  assert(big.inf() < big.sup());
+  assert(contains(big, Exact(CGAL::MP_Float(double(1LL << 62))) + Exact(1)));
+}
+
+void predicate_test(CGAL::Random& rnd)
+{
+  typedef CGAL::Exact_predicates_inexact_constructions_kernel Epick;
+  typedef CGAL::Simple_cartesian<IA> IK;
+  typedef CGAL::Cartesian_converter<Epick, IK> C2I;
+  typedef CGAL::Cartesian_converter<Epick, CGAL::Simple_cartesian<Exact> > C2E;
+  typedef CGAL::Filtered_predicate<CGAL::Simple_cartesian<Exact>::Orientation_3,
+                                   IK::Orientation_3, C2E, C2I, false> Orientation_3;
+
+  C2I c2i;
+  Orientation_3 orientation;
+  std::vector<Epick::Point_3> pts;
+  for(int i = 0; i < 4000; ++i)
+    pts.emplace_back(rnd.get_int(0, 3), rnd.get_int(0, 3), rnd.get_int(0, 3) + (i % 2) * rnd.get_double(0, 1));
+
+  int nb_certain = 0;
+  for(std::size_t i = 0; i + 3 < pts.size(); i += 4)
+  {
+    CGAL::Orientation o = Epick().orientation_3_object()(pts[i], pts[i+1], pts[i+2], pts[i+3]);
+    assert(orientation(pts[i], pts[i+1], pts[i+2], pts[i+3]) == o);
+    CGAL::Uncertain<CGAL::Orientation> io = IK().orientation_3_object()(c2i(pts[i]), c2i(pts[i+1]),
+                                                                         c2i(pts[i+2]), c2i(pts[i+3]));
+    if(CGAL::is_certain(io))
+    {
+      assert(CGAL::get_certain(io) == o);
+      ++nb_certain;
+    }
+  }
+  // Most of these configurations, including the degenerate ones, are decided.
+  assert(nb_certain > 900);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  typedef CGAL::Field_with_sqrt_tag Tag;
+  typedef CGAL::Tag_false Is_exact;
+  CGAL::test_algebraic_structure<IA, Tag, Is_exact>();
+  CGAL::test_algebraic_structure<IA, Tag, Is_exact>(IA(4), IA(6), IA(15));
+  CGAL::test_real_embeddable<IA>();
+
+  inclusion_test(rnd);
+  special_values_test();
+  predicate_test(rnd);
+
+  std::cout << "OK" << std::endl;
+  return 0;
+}
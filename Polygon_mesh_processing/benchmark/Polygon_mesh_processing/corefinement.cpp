@@ -0,0 +1,57 @@
+// Times `corefine_and_compute_union()` sequentially and in parallel
+// (if TBB is available) between a mesh and a translated copy of it.
+//
+// Usage: corefinement [mesh] [translation along each axis]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel        K;
+typedef CGAL::Surface_mesh<K::Point_3>                             Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <typename ConcurrencyTag>
+void bench_union(const Mesh& mesh, const K::Vector_3& shift, const char* name)
+{
+  Mesh tm1 = mesh, tm2 = mesh, out;
+  PMP::transform(K::Aff_transformation_3(CGAL::TRANSLATION, shift), tm2);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  bool valid = PMP::corefine_and_compute_union(tm1, tm2, out,
+                                               CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  timer.stop();
+  std::cout << "  corefine_and_compute_union() (" << name << "): " << num_faces(out) << " faces"
+            << (valid ? "" : " (invalid)") << " in " << timer.time() << " sec." << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/armadillo.off");
+  const double t = (argc > 2) ? std::stod(argv[2]) : 0.01;
+
+  Mesh mesh;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const K::Vector_3 shift(t, t, t);
+  std::cout << num_faces(mesh) << " faces" << std::endl;
+  bench_union<CGAL::Sequential_tag>(mesh, shift, "sequential");
+#ifdef CGAL_LINKED_WITH_TBB
+  bench_union<CGAL::Parallel_tag>(mesh, shift, "parallel");
+#endif
+
+  return EXIT_SUCCESS;
+}
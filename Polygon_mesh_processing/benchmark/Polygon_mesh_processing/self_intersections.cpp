@@ -0,0 +1,104 @@
+// Times the box intersection step of `self_intersections()` alone, then
+// the full function, sequentially and in parallel (if TBB is available).
+//
+// Usage: self_intersections [mesh] [number of copies of the mesh]
+// Several slightly shifted copies of the mesh can be used to obtain
+// a workload with many intersecting boxes.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/box_intersection_d.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Real_timer.h>
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel        K;
+typedef CGAL::Surface_mesh<K::Point_3>                             Mesh;
+typedef boost::graph_traits<Mesh>::face_descriptor                 face_descriptor;
+typedef CGAL::Box_intersection_d::ID_FROM_BOX_ADDRESS              Box_policy;
+typedef CGAL::Box_intersection_d::Box_with_info_d<double, 3, face_descriptor, Box_policy> Box;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+struct Count_pairs
+{
+  std::atomic<std::size_t>* counter;
+  void operator()(const Box*, const Box*) const { ++ *counter; }
+};
+
+template <typename ConcurrencyTag>
+void bench_boxes(std::vector<const Box*> boxes, const char* name)
+{
+  std::atomic<std::size_t> counter(0);
+  CGAL::Real_timer timer;
+  timer.start();
+  // same cutoff as in `self_intersections()`
+  CGAL::box_self_intersection_d<ConcurrencyTag>(boxes.begin(), boxes.end(),
+                                                Count_pairs{&counter}, std::ptrdiff_t(2000));
+  timer.stop();
+  std::cout << "  box intersections (" << name << "): " << counter << " pairs in "
+            << timer.time() << " sec." << std::endl;
+}
+
+template <typename ConcurrencyTag>
+void bench_self_intersections(const Mesh& mesh, const char* name)
+{
+  std::vector<std::pair<face_descriptor, face_descriptor> > pairs;
+  CGAL::Real_timer timer;
+  timer.start();
+  PMP::self_intersections<ConcurrencyTag>(mesh, std::back_inserter(pairs));
+  timer.stop();
+  std::cout << "  self_intersections() (" << name << "): " << pairs.size() << " pairs in "
+            << timer.time() << " sec." << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/armadillo.off");
+  const int nb_copies = (argc > 2) ? std::stoi(argv[2]) : 1;
+
+  Mesh mesh;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Box> boxes;
+  boxes.reserve(nb_copies * num_faces(mesh));
+  for(int i = 0; i < nb_copies; ++i)
+  {
+    const K::Vector_3 shift(i * 1e-3, i * 1e-3, 0);
+    for(face_descriptor f : faces(mesh))
+    {
+      CGAL::Bbox_3 bbox;
+      for(auto v : vertices_around_face(halfedge(f, mesh), mesh))
+        bbox += (mesh.point(v) + shift).bbox();
+      boxes.emplace_back(bbox, f);
+    }
+  }
+
+  std::vector<const Box*> box_ptr;
+  box_ptr.reserve(boxes.size());
+  for(const Box& b : boxes)
+    box_ptr.push_back(&b);
+
+  std::cout << boxes.size() << " boxes" << std::endl;
+  bench_boxes<CGAL::Sequential_tag>(box_ptr, "sequential");
+#ifdef CGAL_LINKED_WITH_TBB
+  bench_boxes<CGAL::Parallel_tag>(box_ptr, "parallel");
+#endif
+
+  std::cout << num_faces(mesh) << " faces" << std::endl;
+  bench_self_intersections<CGAL::Sequential_tag>(mesh, "sequential");
+#ifdef CGAL_LINKED_WITH_TBB
+  bench_self_intersections<CGAL::Parallel_tag>(mesh, "parallel");
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -224,6 +224,14 @@ enum Boolean_operation_type {UNION = 0, INTERSECTION=1,
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
   *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. In parallel, the filtering of intersecting edges and faces and the
+  *                     constrained triangulations used to refine intersected faces are computed using several threads.}
+  *   \cgalParamNEnd
+  *
   *   \cgalParamNBegin{throw_on_self_intersection}
   *     \cgalParamDescription{If `true`, the set of triangles close to the intersection of `tm1` and `tm2` will be
   *                           checked for self-intersections and `Corefinement::Self_intersection_exception`
@@ -459,6 +467,12 @@ corefine_and_compute_boolean_operations(
   > ::type User_visitor;
   User_visitor uv(choose_parameter<User_visitor>(get_parameter(np1, internal_np::visitor)));
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NPIn1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
   // surface intersection algorithm call
   typedef Corefinement::Face_graph_output_builder<TriangleMesh,
                                                   VPM1,
@@ -472,7 +486,8 @@ corefine_and_compute_boolean_operations(
                                                   User_visitor> Ob;
 
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor> Algo_visitor;
+            TriangleMesh, VPM1, VPM2, Ob, Ecm_in, User_visitor,
+            false, false, Concurrency_tag> Algo_visitor;
 
   Ecm_in ecm_in(tm1,tm2,ecm1,ecm2);
   Edge_mark_map_tuple ecms_out(ecm_out_0, ecm_out_1, ecm_out_2, ecm_out_3);
@@ -563,6 +578,14 @@ corefine_and_compute_boolean_operations(
   *     \cgalParamExtra{`np1` only}
   *   \cgalParamNEnd
   *
+  *   \cgalParamNBegin{concurrency_tag}
+  *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+  *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+  *     \cgalParamDefault{`CGAL::Sequential_tag`}
+  *     \cgalParamExtra{`np1` only. In parallel, the filtering of intersecting edges and faces and the
+  *                     constrained triangulations used to refine intersected faces are computed using several threads.}
+  *   \cgalParamNEnd
+  *
   *   \cgalParamNBegin{throw_on_self_intersection}
   *     \cgalParamDescription{If `true` the set of triangles close to the intersection of `tm1` and `tm2` will be
   *                           checked for self-intersections and `Corefinement::Self_intersection_exception`
@@ -730,6 +753,14 @@ corefine_and_compute_difference(      TriangleMesh& tm1,
  *     \cgalParamExtra{`np1` only}
  *   \cgalParamNEnd
  *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{`np1` only. In parallel, the filtering of intersecting edges and faces and the
+ *                     constrained triangulations used to refine intersected faces are computed using several threads.}
+ *   \cgalParamNEnd
+ *
  *   \cgalParamNBegin{throw_on_self_intersection}
  *     \cgalParamDescription{If `true` the set of triangles close to the intersection of `tm1` and `tm2` will be
  *                           checked for self-intersections and `Corefinement::Self_intersection_exception`
@@ -827,10 +858,17 @@ corefine(      TriangleMesh& tm1,
     !parameters::is_default_parameter<NamedParameters1, internal_np::non_manifold_feature_map_t>::value ||
     !parameters::is_default_parameter<NamedParameters2, internal_np::non_manifold_feature_map_t>::value;
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters1,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
 // surface intersection algorithm call
   typedef Corefinement::No_extra_output_from_corefinement<TriangleMesh> Ob;
   typedef Corefinement::Surface_intersection_visitor_for_corefinement<
-  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features> Algo_visitor;
+  TriangleMesh, VPM1, VPM2, Ob, Ecm, User_visitor, false, handle_non_manifold_features,
+  Concurrency_tag> Algo_visitor;
 
   Ob ob;
   Ecm ecm(tm1,tm2,ecm1,ecm2);
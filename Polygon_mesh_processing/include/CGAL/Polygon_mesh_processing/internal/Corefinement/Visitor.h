@@ -25,10 +25,20 @@
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Projection_traits_3.h>
 #include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/tags.h>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
 namespace CGAL{
 namespace Polygon_mesh_processing {
 namespace Corefinement{
@@ -440,8 +450,13 @@ template< class TriangleMesh,
           class EdgeMarkMapBind_ = Default,
           class UserVisitor_ = Default,
           bool doing_autorefinement = false,
-          bool handle_non_manifold_features = false >
+          bool handle_non_manifold_features = false,
+          class ConcurrencyTag = Sequential_tag >
 class Surface_intersection_visitor_for_corefinement{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
 //default template parameters
   typedef typename Default::Get<EdgeMarkMapBind_,
     Ecm_bind<TriangleMesh, No_mark<TriangleMesh> > >::type      EdgeMarkMapBind;
@@ -454,6 +469,7 @@ class Surface_intersection_visitor_for_corefinement{
 public:
   static const bool Predicates_on_constructions_needed = true;
   static const bool do_need_vertex_graph = true;
+  typedef ConcurrencyTag Concurrency_tag;
 // typdefs
 private:
   typedef std::size_t                                                   Node_id;
@@ -1188,59 +1204,225 @@ public:
     }
   }
 
-  template <class OnFaceMapIterator, class VPM>
-  void triangulate_intersected_faces(OnFaceMapIterator it,
-                                     const VPM& vpm,
-                                     INodes& nodes,
-                                     std::map<TriangleMesh*, Face_boundaries>& mesh_to_face_boundaries)
+  // Data needed to retriangulate a face, computed before the face is
+  // modified in the mesh
+  struct Face_retriangulation
   {
-    TriangleMesh& tm=*it->first;
-    CGAL_assertion(&tm!=const_mesh_ptr);
-
-    On_face_map& on_face_map=it->second;
-    Face_boundaries& face_boundaries=mesh_to_face_boundaries[&tm];
-    Node_id_to_vertex& node_id_to_vertex=mesh_to_node_id_to_vertex[&tm];
-    Vertex_to_node_id& vertex_to_node_id=mesh_to_vertex_to_node_id[&tm];
+    // the vertices of f
+    std::array<vertex_descriptor,3> f_vertices;
+    // the node_id of an input vertex or a fake id (>=nb_nodes)
+    std::array<Node_id,3> f_indices;
+    std::unique_ptr<CDT> cdt;
+    std::map<Node_id,CDT_Vertex_handle> id_to_CDT_vh;
+    //associate an edge of the triangulation to a halfedge in a given polyhedron
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+  };
 
-    const Node_id nb_nodes = nodes.size();
+  void collect_face_vertices(face_descriptor f,
+                             Face_boundary* f_boundary,
+                             TriangleMesh& tm,
+                             Vertex_to_node_id& vertex_to_node_id,
+                             const Node_id nb_nodes,
+                             Face_retriangulation& fr)
+  {
+    fr.f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
+    if (f_boundary!=nullptr){ //the boundary of the triangle face was refined
+      fr.f_vertices[0]=f_boundary->vertices[0];
+      fr.f_vertices[1]=f_boundary->vertices[1];
+      fr.f_vertices[2]=f_boundary->vertices[2];
+      update_face_indices(fr.f_vertices,fr.f_indices,vertex_to_node_id);
+    }
+    else{
+      CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
+      halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
+      fr.f_vertices[0]=target(h0,tm); //nb_nodes
+      fr.f_vertices[1]=target(h1,tm); //nb_nodes+1
+      fr.f_vertices[2]=target(h2,tm); //nb_nodes+2
+
+      update_face_indices(fr.f_vertices,fr.f_indices,vertex_to_node_id);
+      fr.edge_to_hedge[std::make_pair( fr.f_indices[2],fr.f_indices[0] )] = h0;
+      fr.edge_to_hedge[std::make_pair( fr.f_indices[0],fr.f_indices[1] )] = h1;
+      fr.edge_to_hedge[std::make_pair( fr.f_indices[1],fr.f_indices[2] )] = h2;
+    }
+  }
 
-    for (typename On_face_map::iterator it=on_face_map.begin();
-          it!=on_face_map.end();++it)
+  // build in `fr.cdt` the constrained triangulation of a face. The mesh
+  // and the members of the visitor are only read.
+  template <class VPM>
+  void build_face_cdt(Node_ids& node_ids,
+                      Face_boundary* f_boundary,
+                      TriangleMesh& tm,
+                      const VPM& vpm,
+                      const INodes& nodes,
+                      const Node_id nb_nodes,
+                      Face_retriangulation& fr)
+  {
+    typename EK::Point_3 p = nodes.to_exact(get(vpm,fr.f_vertices[0])),
+                         q = nodes.to_exact(get(vpm,fr.f_vertices[1])),
+                         r = nodes.to_exact(get(vpm,fr.f_vertices[2]));
+///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
+    CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
+    fr.cdt.reset(new CDT(traits));
+    CDT& cdt = *fr.cdt;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = fr.edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> >& constrained_edges = fr.constrained_edges;
+    std::map<Node_id,CDT_Vertex_handle>& id_to_CDT_vh = fr.id_to_CDT_vh;
+
+    // insert triangle points
+    std::array<CDT_Vertex_handle,3> triangle_vertices;
+    //we can do this to_exact because these are supposed to be input points.
+    triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
+    triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
+    triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
+    triangle_vertices[2]->set_point(r);
+
+    triangle_vertices[0]->info()=fr.f_indices[0];
+    triangle_vertices[1]->info()=fr.f_indices[1];
+    triangle_vertices[2]->info()=fr.f_indices[2];
+
+    //if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik){
+      if ( fr.f_indices[ik]<nb_nodes )
+        id_to_CDT_vh.insert(
+            std::make_pair(fr.f_indices[ik],triangle_vertices[ik]));
+    }
+    //insert points on edges
+    if (f_boundary!=nullptr) //if f not a triangle?
     {
-      user_visitor.triangulating_faces_step();
-      face_descriptor f = it->first; //the face to be triangulated
-      Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
-      typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
-
-      std::map<Node_id,typename CDT::Vertex_handle> id_to_CDT_vh;
-
-      //associate an edge of the triangulation to a halfedge in a given polyhedron
-      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
-
-      // the vertices of f
-      std::array<vertex_descriptor,3> f_vertices;
-      // the node_id of an input vertex or a fake id (>=nb_nodes)
-      std::array<Node_id,3> f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
-      if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
-        f_vertices[0]=it_fb->second.vertices[0];
-        f_vertices[1]=it_fb->second.vertices[1];
-        f_vertices[2]=it_fb->second.vertices[2];
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        if (doing_autorefinement || handle_non_manifold_features)
-          it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
+      // collect infinite faces incident to the initial triangle
+      typename CDT::Face_handle infinite_faces[3];
+      for (int i=0;i<3;++i)
+      {
+        int oi=-1;
+        CGAL_assertion_code(bool is_edge = )
+        cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
+        CGAL_assertion(is_edge);
+        CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
       }
-      else{
-        CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
-        halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
-        f_vertices[0]=target(h0,tm); //nb_nodes
-        f_vertices[1]=target(h1,tm); //nb_nodes+1
-        f_vertices[2]=target(h2,tm); //nb_nodes+2
-
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
-        edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
-        edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+
+      // In this loop, for each original edge of the triangle, we insert
+      // the constrained edges and we recover the halfedge_descriptor
+      // corresponding to these constrained (they are already in tm)
+      for (int i=0;i<3;++i){
+        //handle case of halfedge starting at triangle_vertices[i]
+        // and ending at triangle_vertices[(i+1)%3]
+
+        const Node_ids& ids_on_edge=f_boundary->node_ids_array[i];
+        CDT_Vertex_handle previous=triangle_vertices[i];
+        Node_id prev_index=fr.f_indices[i];// node-id of the mesh vertex
+        halfedge_descriptor hedge = next(f_boundary->halfedges[(i+2)%3],tm);
+        CGAL_assertion( source(hedge,tm)==f_boundary->vertices[i] );
+        if (!ids_on_edge.empty()){ //is there at least one node on this edge?
+          // fh must be an infinite face
+          // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
+          for(Node_id id : ids_on_edge)
+          {
+            CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
+            vh->info()=id;
+            id_to_CDT_vh.insert(std::make_pair(id,vh));
+            edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
+            previous=vh;
+            hedge=next(hedge,tm);
+            prev_index=id;
+          }
+        }
+        else{
+        CGAL_assertion_code(halfedge_descriptor hd=f_boundary->halfedges[i]);
+          CGAL_assertion( target(hd,tm) == f_boundary->vertices[(i+1)%3] );
+          CGAL_assertion( source(hd,tm) == f_boundary->vertices[ i ] );
+        }
+        CGAL_assertion(hedge==f_boundary->halfedges[i]);
+        edge_to_hedge[std::make_pair(prev_index,fr.f_indices[(i+1)%3])] =
+          f_boundary->halfedges[i];
+      }
+    }
+
+    //insert point inside face
+    for(Node_id node_id : node_ids)
+    {
+      CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
+      vh->info()=node_id;
+      id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    }
+
+    // insert constraints that are interior to the triangle (in the case
+    // no edges are collinear in the meshes)
+    insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
+
+    // insert constraints between points that are on the boundary
+    // (not a constrained on the triangle boundary)
+    if (f_boundary!=nullptr) //is f not a triangle ?
+    {
+      for (int i=0;i<3;++i)
+      {
+        Node_ids& ids=f_boundary->node_ids_array[i];
+        insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
       }
+    }
+
+    //insert coplanar edges for endpoints of triangles
+    for (int i=0;i<3;++i){
+      Node_id nindex=triangle_vertices[i]->info();
+      if ( nindex < nb_nodes )
+        insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+    }
+  }
+
+  // returns `true` if the triangulation of a face can be built while other faces
+  // are being retriangulated: its nodes must not be the intersection of
+  // coplanar faces (see XSL_TAG_CPL_VERT), and the face must not be degenerate.
+  template <class VPM>
+  bool can_build_face_cdt_independently(const Node_ids& node_ids,
+                                        const Face_boundary* f_boundary,
+                                        const VPM& vpm,
+                                        const Face_retriangulation& fr) const
+  {
+    if (doing_autorefinement || handle_non_manifold_features)
+      return false;
+    if (const_mesh_ptr && collinear( get(vpm,fr.f_vertices[0]), get(vpm,fr.f_vertices[1]), get(vpm,fr.f_vertices[2]) ) )
+      return false;
+    if (number_coplanar_vertices==0)
+      return true;
+    auto is_coplanar_vertex = [this](Node_id id) { return id < number_coplanar_vertices; };
+    if (std::any_of(fr.f_indices.begin(), fr.f_indices.end(), is_coplanar_vertex) ||
+        std::any_of(node_ids.begin(), node_ids.end(), is_coplanar_vertex))
+      return false;
+    if (f_boundary!=nullptr)
+      for (int i=0;i<3;++i)
+        if (std::any_of(f_boundary->node_ids_array[i].begin(),
+                        f_boundary->node_ids_array[i].end(), is_coplanar_vertex))
+          return false;
+    return true;
+  }
+
+  // retriangulate the face `it->first`. If `fr.cdt` is not null, the triangulation
+  // has already been built by `build_face_cdt()`.
+  template <class OnFaceIterator, class VPM>
+  void triangulate_intersected_face(OnFaceIterator it,
+                                    Face_retriangulation& fr,
+                                    TriangleMesh& tm,
+                                    const VPM& vpm,
+                                    INodes& nodes,
+                                    Face_boundaries& face_boundaries,
+                                    Node_id_to_vertex& node_id_to_vertex,
+                                    Vertex_to_node_id& vertex_to_node_id,
+                                    const Node_id nb_nodes)
+  {
+    user_visitor.triangulating_faces_step();
+    face_descriptor f = it->first; //the face to be triangulated
+    Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
+    typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+    Face_boundary* f_boundary = it_fb!=face_boundaries.end() ? &it_fb->second : nullptr;
+
+    std::array<vertex_descriptor,3>& f_vertices = fr.f_vertices;
+    std::array<Node_id,3>& f_indices = fr.f_indices;
+
+    if (!fr.cdt)
+    {
+      collect_face_vertices(f, f_boundary, tm, vertex_to_node_id, nb_nodes, fr);
+      if (f_boundary!=nullptr && (doing_autorefinement || handle_non_manifold_features))
+        f_boundary->update_node_id_to_vertex_map(node_id_to_vertex, tm);
 
       // handle possible presence of degenerate faces
       if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
@@ -1330,207 +1512,184 @@ public:
           }
         }
 
-        continue;
+        return;
       }
 
-      typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
-                           q = nodes.to_exact(get(vpm,f_vertices[1])),
-                           r = nodes.to_exact(get(vpm,f_vertices[2]));
-///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
-      CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
-      CDT cdt(traits);
-
-      // insert triangle points
-      std::array<CDT_Vertex_handle,3> triangle_vertices;
-      //we can do this to_exact because these are supposed to be input points.
-      triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
-      triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
-      triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
-      triangle_vertices[2]->set_point(r);
+      build_face_cdt(node_ids, f_boundary, tm, vpm, nodes, nb_nodes, fr);
+    }
 
-      triangle_vertices[0]->info()=f_indices[0];
-      triangle_vertices[1]->info()=f_indices[1];
-      triangle_vertices[2]->info()=f_indices[2];
+    CDT& cdt = *fr.cdt;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = fr.edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> >& constrained_edges = fr.constrained_edges;
 
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
 
+    if (doing_autorefinement || handle_non_manifold_features)
+    {
       //if one of the triangle input vertex is also a node
       for (int ik=0;ik<3;++ik){
         if ( f_indices[ik]<nb_nodes )
-        {
-          id_to_CDT_vh.insert(
-              std::make_pair(f_indices[ik],triangle_vertices[ik]));
-          if (doing_autorefinement || handle_non_manifold_features)
-            // update the current vertex in node_id_to_vertex
-            // to match the one of the face
-            node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
-            // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
-            // it is OK not to store all vertices corresponding to this id as the approximate version
-            // is already tight and the call in Intersection_nodes::finalize() will not fix anything
-        }
-      }
-      //insert points on edges
-      if (it_fb!=face_boundaries.end()) //if f not a triangle?
-      {
-        // collect infinite faces incident to the initial triangle
-        typename CDT::Face_handle infinite_faces[3];
-        for (int i=0;i<3;++i)
-        {
-          int oi=-1;
-          CGAL_assertion_code(bool is_edge = )
-          cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
-          CGAL_assertion(is_edge);
-          CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
-        }
-
-        // In this loop, for each original edge of the triangle, we insert
-        // the constrained edges and we recover the halfedge_descriptor
-        // corresponding to these constrained (they are already in tm)
-        Face_boundary& f_boundary=it_fb->second;
-        for (int i=0;i<3;++i){
-          //handle case of halfedge starting at triangle_vertices[i]
-          // and ending at triangle_vertices[(i+1)%3]
-
-          const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
-          CDT_Vertex_handle previous=triangle_vertices[i];
-          Node_id prev_index=f_indices[i];// node-id of the mesh vertex
-          halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
-          CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
-          if (!ids_on_edge.empty()){ //is there at least one node on this edge?
-            // fh must be an infinite face
-            // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
-            for(Node_id id : ids_on_edge)
-            {
-              CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
-              vh->info()=id;
-              id_to_CDT_vh.insert(std::make_pair(id,vh));
-              edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
-              previous=vh;
-              hedge=next(hedge,tm);
-              prev_index=id;
-            }
-          }
-          else{
-          CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
-            CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
-            CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
-          }
-          CGAL_assertion(hedge==f_boundary.halfedges[i]);
-          edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
-            it_fb->second.halfedges[i];
-        }
+          // update the current vertex in node_id_to_vertex
+          // to match the one of the face
+          node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
+          // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
+          // it is OK not to store all vertices corresponding to this id as the approximate version
+          // is already tight and the call in Intersection_nodes::finalize() will not fix anything
       }
+    }
 
-      //insert point inside face
-      for(Node_id node_id : node_ids)
+    //XSL_TAG_CPL_VERT
+    //collect edges incident to a point that is the intersection of two
+    // coplanar faces. This ensure that triangulations are compatible.
+    if (it_fb!=face_boundaries.end()) //is f not a triangle ?
+    {
+      for (typename CDT::Finite_vertices_iterator
+            vit=cdt.finite_vertices_begin(),
+            vit_end=cdt.finite_vertices_end();vit_end!=vit;++vit)
       {
-        CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
-        vh->info()=node_id;
-        id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+        //skip original vertices (that are not nodes) and non-coplanar face
+        // issued vertices (this is working because intersection points
+        // between coplanar facets are the first inserted)
+        if (vit->info() >= nb_nodes ||
+            vit->info() >= number_coplanar_vertices) continue;
+        // \todo no need to insert constrained edges (they also are constrained
+        // in the other mesh)!!
+        typename std::map< Node_id,std::set<Node_id> >::iterator res =
+            coplanar_constraints.insert(
+                std::make_pair(vit->info(),std::set<Node_id>())).first;
+        //turn around the vertex and get incident edge
+        typename CDT::Edge_circulator  start=cdt.incident_edges(vit);
+        typename CDT::Edge_circulator  curr=start;
+        do{
+          if (cdt.is_infinite(*curr) ) continue;
+          typename CDT::Edge mirror=cdt.mirror_edge(*curr);
+          if ( cdt.is_infinite( curr->first->vertex(curr->second) ) ||
+               cdt.is_infinite( mirror.first->vertex(mirror.second) ) )
+            continue; // skip edges that are on the boundary of the triangle
+                      // (these are already constrained)
+          //insert edges in the set of constraints
+          CDT_Vertex_handle vh=vit;
+          int nindex = curr->first->vertex((curr->second+1)%3)==vh
+                         ? (curr->second+2)%3
+                         : (curr->second+1)%3;
+          CDT_Vertex_handle vn=curr->first->vertex(nindex);
+          if ( vit->info() > vn->info() || vn->info()>=nb_nodes)
+            continue; //take only one out of the two edges + skip input
+          CGAL_assertion(vn->info()<nb_nodes);
+          res->second.insert( vn->info() );
+        }while(start!=++curr);
       }
+    }
 
-      std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+    // import the triangle in `cdt` in the face `f` of `tm`
+    triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
+      edge_to_hedge, cdt, vpm, output_builder, user_visitor);
 
-      // insert constraints that are interior to the triangle (in the case
-      // no edges are collinear in the meshes)
-      insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
+    // TODO Here we do the update only for internal edges.
+    // Update for border halfedges could be done during the split
 
-      // insert constraints between points that are on the boundary
-      // (not a constrained on the triangle boundary)
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (int i=0;i<3;++i)
-        {
-          Node_ids& ids=it_fb->second.node_ids_array[i];
-          insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
-        }
+    //3) mark halfedges that are common to two polyhedral surfaces
+    //recover halfedges inserted that are on the intersection
+    typedef std::pair<Node_id,Node_id> Node_id_pair;
+    for(const Node_id_pair& node_id_pair : constrained_edges)
+    {
+      typename std::map<Node_id_pair,halfedge_descriptor>
+        ::iterator it_poly_hedge=edge_to_hedge.find(node_id_pair);
+      //we cannot have an assertion here in case an edge or part of an edge is a constraints.
+      //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
+      //is defined as one of them defines an adjacent face
+      //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
+      if( it_poly_hedge!=edge_to_hedge.end() ){
+        call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
+        output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
       }
-
-      //insert coplanar edges for endpoints of triangles
-      for (int i=0;i<3;++i){
-        Node_id nindex=triangle_vertices[i]->info();
-        if ( nindex < nb_nodes )
-          insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+      else{
+        //WARNING: in few case this is needed if the marked edge is on the border
+        //to optimize it might be better to only use sorted pair. TAG_SLXX1
+        Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
+        it_poly_hedge=edge_to_hedge.find(opposite_pair);
+        CGAL_assertion( it_poly_hedge!=edge_to_hedge.end() );
+
+        call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
+        output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
       }
+    }
+  }
 
-      //XSL_TAG_CPL_VERT
-      //collect edges incident to a point that is the intersection of two
-      // coplanar faces. This ensure that triangulations are compatible.
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (typename CDT::Finite_vertices_iterator
-              vit=cdt.finite_vertices_begin(),
-              vit_end=cdt.finite_vertices_end();vit_end!=vit;++vit)
-        {
-          //skip original vertices (that are not nodes) and non-coplanar face
-          // issued vertices (this is working because intersection points
-          // between coplanar facets are the first inserted)
-          if (vit->info() >= nb_nodes ||
-              vit->info() >= number_coplanar_vertices) continue;
-          // \todo no need to insert constrained edges (they also are constrained
-          // in the other mesh)!!
-          typename std::map< Node_id,std::set<Node_id> >::iterator res =
-              coplanar_constraints.insert(
-                  std::make_pair(vit->info(),std::set<Node_id>())).first;
-          //turn around the vertex and get incident edge
-          typename CDT::Edge_circulator  start=cdt.incident_edges(vit);
-          typename CDT::Edge_circulator  curr=start;
-          do{
-            if (cdt.is_infinite(*curr) ) continue;
-            typename CDT::Edge mirror=cdt.mirror_edge(*curr);
-            if ( cdt.is_infinite( curr->first->vertex(curr->second) ) ||
-                 cdt.is_infinite( mirror.first->vertex(mirror.second) ) )
-              continue; // skip edges that are on the boundary of the triangle
-                        // (these are already constrained)
-            //insert edges in the set of constraints
-            CDT_Vertex_handle vh=vit;
-            int nindex = curr->first->vertex((curr->second+1)%3)==vh
-                           ? (curr->second+2)%3
-                           : (curr->second+1)%3;
-            CDT_Vertex_handle vn=curr->first->vertex(nindex);
-            if ( vit->info() > vn->info() || vn->info()>=nb_nodes)
-              continue; //take only one out of the two edges + skip input
-            CGAL_assertion(vn->info()<nb_nodes);
-            res->second.insert( vn->info() );
-          }while(start!=++curr);
-        }
-      }
+  template <class OnFaceMapIterator, class VPM>
+  void triangulate_intersected_faces(OnFaceMapIterator it,
+                                     const VPM& vpm,
+                                     INodes& nodes,
+                                     std::map<TriangleMesh*, Face_boundaries>& mesh_to_face_boundaries)
+  {
+    TriangleMesh& tm=*it->first;
+    CGAL_assertion(&tm!=const_mesh_ptr);
 
-      // import the triangle in `cdt` in the face `f` of `tm`
-      triangulate_a_face(f, tm, nodes, node_ids, node_id_to_vertex,
-        edge_to_hedge, cdt, vpm, output_builder, user_visitor);
+    On_face_map& on_face_map=it->second;
+    Face_boundaries& face_boundaries=mesh_to_face_boundaries[&tm];
+    Node_id_to_vertex& node_id_to_vertex=mesh_to_node_id_to_vertex[&tm];
+    Vertex_to_node_id& vertex_to_node_id=mesh_to_vertex_to_node_id[&tm];
 
-      // TODO Here we do the update only for internal edges.
-      // Update for border halfedges could be done during the split
+    const Node_id nb_nodes = nodes.size();
 
-      //3) mark halfedges that are common to two polyhedral surfaces
-      //recover halfedges inserted that are on the intersection
-      typedef std::pair<Node_id,Node_id> Node_id_pair;
-      for(const Node_id_pair& node_id_pair : constrained_edges)
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // Faces are handled by blocks: the constrained triangulations of the
+      // faces of a block are built in parallel, then imported in `tm`
+      // sequentially and in the same order as in the sequential version,
+      // so that the output does not depend on the number of threads.
+      const std::size_t block_size = 4096;
+      std::vector<typename On_face_map::iterator> block_faces;
+      std::vector<Face_retriangulation> block;
+      block_faces.reserve((std::min)(block_size, on_face_map.size()));
+      for (typename On_face_map::iterator it_f=on_face_map.begin();
+                                          it_f!=on_face_map.end();)
       {
-        typename std::map<Node_id_pair,halfedge_descriptor>
-          ::iterator it_poly_hedge=edge_to_hedge.find(node_id_pair);
-        //we cannot have an assertion here in case an edge or part of an edge is a constraints.
-        //Indeed, the graph_of_constraints report an edge 0,1 and 1,0 for example while only one of the two
-        //is defined as one of them defines an adjacent face
-        //CGAL_assertion(it_poly_hedge!=edge_to_hedge.end());
-        if( it_poly_hedge!=edge_to_hedge.end() ){
-          call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
-          output_builder.set_edge_per_polyline(tm,node_id_pair,it_poly_hedge->second);
-        }
-        else{
-          //WARNING: in few case this is needed if the marked edge is on the border
-          //to optimize it might be better to only use sorted pair. TAG_SLXX1
-          Node_id_pair opposite_pair(node_id_pair.second,node_id_pair.first);
-          it_poly_hedge=edge_to_hedge.find(opposite_pair);
-          CGAL_assertion( it_poly_hedge!=edge_to_hedge.end() );
-
-          call_put(marks_on_edges,tm,edge(it_poly_hedge->second,tm),true);
-          output_builder.set_edge_per_polyline(tm,opposite_pair,it_poly_hedge->second);
+        block_faces.clear();
+        for (; it_f!=on_face_map.end() && block_faces.size()<block_size; ++it_f)
+          block_faces.push_back(it_f);
+        block.clear();
+        block.resize(block_faces.size());
+
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, block_faces.size()),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          for (std::size_t i=r.begin(); i!=r.end(); ++i)
+          {
+            face_descriptor f = block_faces[i]->first;
+            Node_ids& node_ids = block_faces[i]->second;
+            typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+            Face_boundary* f_boundary = it_fb!=face_boundaries.end() ? &it_fb->second : nullptr;
+
+            Face_retriangulation& fr = block[i];
+            collect_face_vertices(f, f_boundary, tm, vertex_to_node_id, nb_nodes, fr);
+            if (can_build_face_cdt_independently(node_ids, f_boundary, vpm, fr))
+              build_face_cdt(node_ids, f_boundary, tm, vpm, nodes, nb_nodes, fr);
+            else
+              fr.edge_to_hedge.clear();
+          }
+        });
+
+        for (std::size_t i=0; i<block_faces.size(); ++i)
+        {
+          triangulate_intersected_face(block_faces[i], block[i], tm, vpm, nodes, face_boundaries,
+                                       node_id_to_vertex, vertex_to_node_id, nb_nodes);
+          block[i] = Face_retriangulation();
         }
       }
+      return;
+    }
+#endif
+
+    for (typename On_face_map::iterator it=on_face_map.begin();
+          it!=on_face_map.end();++it)
+    {
+      Face_retriangulation fr;
+      triangulate_intersected_face(it, fr, tm, vpm, nodes, face_boundaries,
+                                   node_id_to_vertex, vertex_to_node_id, nb_nodes);
     }
   }
 
@@ -116,7 +116,14 @@ public:
   , visitor(visitor)
   {}
 
-  void operator()( const Box& face_box, const Box& edge_box) const {
+  // flags describing how an edge and a face interact (see `classify()`)
+  enum { NO_INTERSECTION = 0,
+         EDGE_CROSSES_FACE_PLANE = 1,
+         COPLANAR_WITH_FACE_OF_EDGE = 2,
+         COPLANAR_WITH_FACE_OF_OPPOSITE_EDGE = 4 };
+
+  // only evaluates predicates, it can be called concurrently
+  unsigned int classify(const Box& face_box, const Box& edge_box) const {
     halfedge_descriptor fh = face_box.info();
     halfedge_descriptor eh = edge_box.info();
     if(is_border(eh,tm_edges)) eh = opposite(eh, tm_edges);
@@ -131,32 +138,51 @@ public:
     const Orientation abcq = orientation(a,b,c, get(vpmap_tme, source(eh, tm_edges)));
     if (abcp==abcq){
       if (abcp!=COPLANAR){
-        return; //no intersection
+        return NO_INTERSECTION;
       }
 
+      unsigned int res = NO_INTERSECTION;
       if (orientation(a,b,c,get(vpmap_tme, target( next(eh, tm_edges), tm_edges)))==COPLANAR)
-      {
-        coplanar_faces.insert(
-            &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
-            ? std::make_pair(face(eh, tm_edges), face(fh, tm_faces))
-            : std::make_pair(face(fh, tm_faces), face(eh, tm_edges))
-          );
-      }
+        res |= COPLANAR_WITH_FACE_OF_EDGE;
       halfedge_descriptor eh_opp=opposite(eh, tm_edges);
       if (!is_border(eh_opp, tm_edges) &&
           orientation(a,b,c,get(vpmap_tme, target(next(eh_opp, tm_edges),tm_edges)))==COPLANAR)
-      {
-        coplanar_faces.insert(
-            &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
-            ? std::make_pair(face(opposite(eh, tm_edges), tm_edges), face(fh, tm_faces))
-            : std::make_pair(face(fh, tm_faces), face(opposite(eh, tm_edges), tm_edges))
-          );
-      }
+        res |= COPLANAR_WITH_FACE_OF_OPPOSITE_EDGE;
       //in case only the edge is coplanar, the intersection points will be detected using an incident facet
-      return;
+      return res;
     }
     // non-coplanar case
-    edge_to_faces[edge(eh,tm_edges)].insert(face(fh, tm_faces));
+    return EDGE_CROSSES_FACE_PLANE;
+  }
+
+  // records the result of `classify()`
+  void report(const Box& face_box, const Box& edge_box, unsigned int type) const {
+    halfedge_descriptor fh = face_box.info();
+    halfedge_descriptor eh = edge_box.info();
+    if(is_border(eh,tm_edges)) eh = opposite(eh, tm_edges);
+
+    if (type & COPLANAR_WITH_FACE_OF_EDGE)
+    {
+      coplanar_faces.insert(
+          &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
+          ? std::make_pair(face(eh, tm_edges), face(fh, tm_faces))
+          : std::make_pair(face(fh, tm_faces), face(eh, tm_edges))
+        );
+    }
+    if (type & COPLANAR_WITH_FACE_OF_OPPOSITE_EDGE)
+    {
+      coplanar_faces.insert(
+          &tm_edges < &tm_faces // TODO can we avoid by reporting them in only of the two calls to the filter function?
+          ? std::make_pair(face(opposite(eh, tm_edges), tm_edges), face(fh, tm_faces))
+          : std::make_pair(face(fh, tm_faces), face(opposite(eh, tm_edges), tm_edges))
+        );
+    }
+    if (type & EDGE_CROSSES_FACE_PLANE)
+      edge_to_faces[edge(eh,tm_edges)].insert(face(fh, tm_faces));
+  }
+
+  void operator()( const Box& face_box, const Box& edge_box) const {
+    report(face_box, edge_box, classify(face_box, edge_box));
   }
 
   bool is_face_degenerated(halfedge_descriptor fh) const
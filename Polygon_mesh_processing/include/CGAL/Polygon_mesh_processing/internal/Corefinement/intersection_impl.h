@@ -26,12 +26,20 @@
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
 #include <CGAL/Polygon_mesh_processing/bbox.h>
 #include <CGAL/utility.h>
+#include <CGAL/tags.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_sort.h>
+#endif
+
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -111,6 +119,7 @@ struct Default_surface_intersection_visitor{
   // If we implement a predicate only test, we can get rid of it.
   static const bool Predicates_on_constructions_needed = doing_autorefinement;
   static const bool do_need_vertex_graph = false;
+  typedef Sequential_tag Concurrency_tag;
   void set_non_manifold_feature_map(
     const TriangleMesh&,
     const Non_manifold_feature_map<TriangleMesh>&)
@@ -213,6 +222,8 @@ class Intersection_of_triangle_meshes
   static const bool Predicates_on_constructions_needed =
     Node_visitor::Predicates_on_constructions_needed;
 
+  typedef typename Node_visitor::Concurrency_tag Concurrency_tag;
+
   typedef std::pair<face_descriptor, face_descriptor> Face_pair;
   typedef std::set< Face_pair > Coplanar_face_set;
 
@@ -393,9 +404,33 @@ class Intersection_of_triangle_meshes
                                     filtered_callback, cutoff );
         }
         else
+        {
+#if defined(CGAL_LINKED_WITH_TBB) && !defined(DO_NOT_HANDLE_COPLANAR_FACES)
+          if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+          {
+            // predicates are evaluated in parallel while boxes are reported,
+            // the maps are then filled sequentially in a deterministic order
+            typedef std::tuple<const Box*, const Box*, unsigned int> Candidate;
+            tbb::concurrent_vector<Candidate> candidates;
+            auto parallel_callback = [&callback, &candidates](const Box* fb, const Box* eb)
+            {
+              unsigned int type = callback.classify(*fb, *eb);
+              if (type != Callback::NO_INTERSECTION)
+                candidates.emplace_back(fb, eb, type);
+            };
+            CGAL::box_intersection_d<Parallel_tag>( face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                                                    edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                                                    parallel_callback, cutoff );
+            tbb::parallel_sort(candidates.begin(), candidates.end());
+            for (const Candidate& c : candidates)
+              callback.report(*std::get<0>(c), *std::get<1>(c), std::get<2>(c));
+          }
+          else
+#endif
           CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
                                     edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
                                     callback, cutoff );
+        }
       }
     }
   }
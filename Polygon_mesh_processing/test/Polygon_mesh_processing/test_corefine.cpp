@@ -63,6 +63,31 @@ void test(const char* f1, const char* f2)
   assert(vertices(sm1).size() == (nbv1_before+(*sm_v.vmap)[&sm1]) );
   assert(vertices(sm2).size() == (nbv2_before+(*sm_v.vmap)[&sm2]) );
 
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "  with Surface_mesh in parallel\n";
+  Surface_mesh sm1_par, sm2_par;
+  input.open(f1);
+  assert(input);
+  input >> sm1_par;
+  input.close();
+  input.open(f2);
+  assert(input);
+  input >> sm2_par;
+  input.close();
+  My_visitor<Surface_mesh> sm_v_par;
+
+  CGAL::Polygon_mesh_processing::corefine(sm1_par, sm2_par,
+    CGAL::parameters::visitor(sm_v_par).concurrency_tag(CGAL::Parallel_tag()));
+
+  assert(sm1_par.is_valid());
+  assert(sm2_par.is_valid());
+  assert(*(sm_v_par.i) == *(sm_v.i));
+  assert(num_vertices(sm1_par) == num_vertices(sm1));
+  assert(num_vertices(sm2_par) == num_vertices(sm2));
+  assert(num_faces(sm1_par) == num_faces(sm1));
+  assert(num_faces(sm2_par) == num_faces(sm2));
+#endif
+
   std::cout << "  with Polyhedron_3\n";
   Polyhedron_3 P, Q;
   input.open(f1);
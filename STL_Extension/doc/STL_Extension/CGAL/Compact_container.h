@@ -618,6 +618,16 @@ iterator emplace(const T1& t1);
 
 
 
+/*!
+constructs `n` objects of type `T` from `args...`, inserts them in `cc`
+in new blocks, and returns an iterator pointing to the first one.
+The new items are the `n` consecutive items starting at this iterator
+in the iteration order. The free slots remaining in the last new block
+are used by the next insertions.
+*/
+template < class... Args >
+iterator emplace_n(size_type n, const Args&... args);
+
 /// @}
 
 
@@ -686,6 +696,30 @@ The time complexity is \cgalBigO{cc.capacity()-cc.size()}.
 */
 void merge(Compact_container<T, Allocator> &cc);
 
+/*!
+moves the items of `cc` to new memory, in the order of the range [`first, last`),
+which must contain exactly one iterator to each item of `cc`.
+After the call, the items are stored without holes, the iteration order is the order of
+the range, and `cc[i]` is the `i`-th item of the range. If `T` has time stamps,
+the time stamp of each item becomes its index in this order.
+
+Once the items are moved, and before the memory of the old items is released,
+`update(forward)` is called. `forward` is a functor that maps a `const_iterator`
+to the old position of an item to an `iterator` to its new position, and the
+default constructed `const_iterator` to the default constructed `iterator`.
+It is used to update the handles stored in the items or elsewhere, for example in
+the items of another container.
+All iterators, pointers, and references to the items of `cc` are invalidated.
+*/
+template < class InputIterator, class Update >
+void defragment(InputIterator first, InputIterator last, const Update& update);
+
+/*!
+same as above, keeping the iteration order.
+*/
+template < class Update >
+void defragment(const Update& update);
+
 
 
 /// @}
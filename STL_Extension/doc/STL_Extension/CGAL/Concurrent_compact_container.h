@@ -237,6 +237,9 @@ complexity. No exception is thrown.
   size_type max_size() const;
   /// returns the total number of elements that `ccc` can hold without requiring reallocation.
   size_type capacity() const;
+  /// if necessary, allocates a block so that `capacity()` becomes greater than or equal to `n`.
+  /// The new free slots are only used by the insertions of the calling thread.
+  void reserve(size_type n);
   /// returns the allocator
   Allocator get_allocator() const;
 
@@ -254,6 +257,17 @@ complexity. No exception is thrown.
   template < class T1 >
   iterator emplace(const T1& t1);
 
+  /*!
+  constructs `n` objects of type `T` from `args...`, inserts them in `ccc`
+  in a new block, and returns an iterator pointing to the first one.
+  The new items are contiguous in memory, and are the `n` consecutive items
+  starting at this iterator in the iteration order.
+  Concurrent calls allocate and construct their blocks independently, and only
+  synchronize to link them to the others.
+  */
+  template < class... Args >
+  iterator emplace_n(size_type n, const Args&... args);
+
   /*!
   inserts a copy of `t` in `ccc` and returns the iterator pointing
   to it.
@@ -290,6 +304,8 @@ complexity. No exception is thrown.
 /// \name Ownership testing
 /// The following functions are mostly helpful for efficient debugging, since
 /// their complexity is \cgalBigO{\sqrt{\mathrm{c.capacity()}}}.
+/// They can be called while other threads insert items, in which case the
+/// items of the blocks allocated during the call may not be found.
 /// @{
   /// returns whether `pos` is in the range `[ccc.begin(),  ccc.end()]` (`ccc.end()` included).
   bool owns(const_iterator pos);
@@ -307,6 +323,27 @@ The time complexity is \cgalBigO{ccc.capacity()-ccc.size()}.
 */
 void merge(Concurrent_compact_container<T, Allocator> &ccc2);
 
+/*!
+moves the items of `ccc` to a single new block, in the order of the range [`first, last`),
+which must contain exactly one iterator to each item of `ccc`.
+If `T` has time stamps, the time stamp of each item becomes its index in this order.
+
+Once the items are moved, and before the memory of the old items is released,
+`update(forward)` is called. `forward` is a functor that maps a `const_iterator`
+to the old position of an item to an `iterator` to its new position, and the
+default constructed `const_iterator` to the default constructed `iterator`.
+All iterators, pointers, and references to the items of `ccc` are invalidated.
+\pre No other thread inserts or erases items in `ccc`.
+*/
+template < class InputIterator, class Update >
+void defragment(InputIterator first, InputIterator last, const Update& update);
+
+/*!
+same as above, keeping the iteration order.
+*/
+template < class Update >
+void defragment(const Update& update);
+
 /// @}
 
 /// \name Comparison Operations
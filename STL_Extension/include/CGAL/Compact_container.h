@@ -434,6 +434,43 @@ public:
     return iterator(ret, 0);
   }
 
+  // Constructs `n` elements from `args` in new blocks, and returns an iterator
+  // to the first one. The new elements are the `n` elements starting at this
+  // iterator in the iteration order, and the free elements of the container
+  // are left for the next insertions.
+  template < typename... Args >
+  iterator
+  emplace_n(size_type n, const Args&... args)
+  {
+    if (n == 0)
+      return end();
+
+    pointer first = nullptr;
+    pointer block = nullptr, block_end = nullptr;
+    for (size_type i = 0; i < n; ++i)
+    {
+      if (block == block_end) {
+        block = append_new_block() + 1;
+        block_end = block + all_items.back().second - 2;
+      }
+      pointer ret = block++;
+      new (ret) value_type(args...);
+      Time_stamper::initialize_time_stamp(ret);
+      Time_stamper::set_time_stamp(ret, time_stamp);
+      CGAL_assertion(type(ret) == USED);
+      if (first == nullptr)
+        first = ret;
+    }
+    size_ += n;
+
+    // the remaining elements of the last block are put on the free list,
+    // in reverse order so that the insertion order corresponds to the iterator order
+    while (block_end != block)
+      put_on_free_list(--block_end);
+
+    return iterator(first, 0);
+  }
+
   template < class InputIterator >
   void insert(InputIterator first, InputIterator last)
   {
@@ -480,6 +517,28 @@ public:
   // The complexity is O(size(free list = capacity-size)).
   void merge(Self &d);
 
+  // Moves the elements to new blocks without free elements between them, in the
+  // order of the range `[first, last)`, which must contain exactly one iterator
+  // (or handle) to each element of the container. The elements get new time
+  // stamps, equal to their index in this order.
+  // Once the elements are moved, and before the memory of the old elements is
+  // released, `update(forward)` is called: `forward(it)` returns an iterator to
+  // the new position of the element that was at `it`, to update the handles
+  // stored in the elements or elsewhere. All iterators are invalidated.
+  template < class InputIterator, class Update >
+  void defragment(InputIterator first, InputIterator last, const Update& update);
+
+  // Same as above, keeping the iteration order.
+  template < class Update >
+  void defragment(const Update& update)
+  {
+    std::vector<iterator> order;
+    order.reserve(size_);
+    for (iterator it = begin(), itend = end(); it != itend; ++it)
+      order.push_back(it);
+    defragment(order.begin(), order.end(), update);
+  }
+
   size_type size() const
   {
     CGAL_expensive_assertion(size_ ==
@@ -638,6 +697,10 @@ private:
 
   void allocate_new_block();
 
+  // Adds a block at the end without putting its elements on the free list,
+  // and returns its first (boundary) element.
+  pointer append_new_block();
+
   void put_on_free_list(pointer x)
   {
     set_type(x, free_list, FREE);
@@ -802,8 +865,60 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::clear()
   init();
 }
 
+template < class T, class Allocator, class Increment_policy, class TimeStamper >
+template < class InputIterator, class Update >
+void Compact_container<T, Allocator, Increment_policy, TimeStamper>::
+defragment(InputIterator first, InputIterator last, const Update& update)
+{
+  // The new blocks follow the increment policy, so that operator[] still works.
+  Self tmp(get_allocator());
+  tmp.reserve(size_);
+
+  size_type n = 0;
+  for (; first != last; ++first, ++n)
+  {
+    pointer p = &*(*first);
+    CGAL_precondition(type(p) == USED);
+    pointer q = tmp.free_list;
+    tmp.free_list = clean_pointee(q);
+    new (q) value_type(std::move(*p));
+    if constexpr (Time_stamper::has_timestamp) {
+      q->set_time_stamp(n);
+    }
+    CGAL_assertion(type(q) == USED);
+
+    // the old element is replaced by a pointer to the new one
+    std::allocator_traits<allocator_type>::destroy(alloc, p);
+    set_type(p, q, FREE);
+  }
+  CGAL_precondition(n == size_);
+  tmp.size_ = n;
+  tmp.time_stamp = n;
+
+  swap(tmp);
+  update([](const_iterator it) -> iterator
+         {
+           if (it == const_iterator())
+             return iterator();
+           return iterator(clean_pointee(&*it), 0);
+         });
+  // the old blocks are released with tmp
+}
+
 template < class T, class Allocator, class Increment_policy, class TimeStamper >
 void Compact_container<T, Allocator, Increment_policy, TimeStamper>::allocate_new_block()
+{
+  pointer new_block = append_new_block();
+  // We don't touch the first and the last one.
+  // We mark them free in reverse order, so that the insertion order
+  // will correspond to the iterator order...
+  for (size_type i = all_items.back().second - 2; i >= 1; --i)
+    put_on_free_list(new_block + i);
+}
+
+template < class T, class Allocator, class Increment_policy, class TimeStamper >
+typename Compact_container<T, Allocator, Increment_policy, TimeStamper>::pointer
+Compact_container<T, Allocator, Increment_policy, TimeStamper>::append_new_block()
 {
   typedef internal::Erase_counter_strategy<
     internal::has_increment_erase_counter<T>::value> EraseCounterStrategy;
@@ -811,14 +926,10 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::allocate_ne
   pointer new_block = alloc.allocate(block_size + 2);
   all_items.push_back(std::make_pair(new_block, block_size + 2));
   capacity_ += block_size;
-  // We don't touch the first and the last one.
-  // We mark them free in reverse order, so that the insertion order
-  // will correspond to the iterator order...
   for (size_type i = block_size; i >= 1; --i)
   {
     EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
     Time_stamper::initialize_time_stamp(new_block + i);
-    put_on_free_list(new_block + i);
   }
   // We insert this new block at the end.
   if (last_item == nullptr) // First time
@@ -836,6 +947,7 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::allocate_ne
   set_type(last_item, nullptr, START_END);
   // Increase the block_size for the next time.
   Increment_policy::increase_size(*this);
+  return new_block;
 }
 
 template < class T, class Allocator, class Increment_policy, class TimeStamper >
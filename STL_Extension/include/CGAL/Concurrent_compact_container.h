@@ -21,9 +21,11 @@
 
 #include <iterator>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 #include <cstring>
 #include <cstddef>
+#include <utility>
 
 #include <CGAL/Compact_container.h>
 
@@ -34,7 +36,8 @@
 #include <CGAL/Time_stamper.h>
 
 #include <tbb/enumerable_thread_specific.h>
-#include <tbb/queuing_mutex.h>
+#include <tbb/concurrent_vector.h>
+#include <tbb/spin_mutex.h>
 
 namespace CGAL {
 
@@ -193,6 +196,8 @@ protected:
 //
 // Safe concurrent "insert" and "erase".
 // Do not parse the container while others are modifying it.
+// New blocks are allocated without locks, and only their linking to the
+// others is serialized.
 //
 template < class T, class Allocator_ = Default >
 class Concurrent_compact_container
@@ -253,7 +258,7 @@ public:
   : m_alloc(c.get_allocator())
   {
     init();
-    m_block_size = c.m_block_size;
+    m_block_size = c.m_block_size.load();
     std::copy(c.begin(), c.end(), CGAL::inserter(*this));
   }
 
@@ -292,18 +297,14 @@ public:
   void swap(Self &c)
   {
     std::swap(m_alloc, c.m_alloc);
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    // non-atomic swap of m_capacity
+    // non-atomic swaps of m_capacity, m_block_size, and m_last_item
     c.m_capacity = m_capacity.exchange(c.m_capacity.load());
-#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    std::swap(m_capacity, c.m_capacity);
-#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-
-    std::swap(m_block_size, c.m_block_size);
+    c.m_block_size = m_block_size.exchange(c.m_block_size.load());
     std::swap(m_first_item, c.m_first_item);
-    std::swap(m_last_item, c.m_last_item);
+    c.m_last_item = m_last_item.exchange(c.m_last_item.load());
     std::swap(m_free_lists, c.m_free_lists);
     m_all_items.swap(c.m_all_items);
+    c.m_nb_blocks = m_nb_blocks.exchange(c.m_nb_blocks.load());
     // non-atomic swap of m_time_stamp
     c.m_time_stamp = m_time_stamp.exchange(c.m_time_stamp.load());
   }
@@ -313,10 +314,10 @@ public:
   }
 
   iterator begin() { return empty()?end():iterator(m_first_item, 0, 0); }
-  iterator end()   { return iterator(m_last_item, 0); }
+  iterator end()   { return iterator(m_last_item.load(), 0); }
 
   const_iterator begin() const { return empty()?end():const_iterator(m_first_item, 0, 0); }
-  const_iterator end()   const { return const_iterator(m_last_item, 0); }
+  const_iterator end()   const { return const_iterator(m_last_item.load(), 0); }
 
   reverse_iterator rbegin() { return reverse_iterator(end()); }
   reverse_iterator rend()   { return reverse_iterator(begin()); }
@@ -368,6 +369,34 @@ public:
     return finalize_insert(ret, fl);
   }
 
+  // Constructs `n` elements from `args` in a new block, and returns an iterator
+  // to the first one. The new elements are stored contiguously, and are the `n`
+  // elements starting at this iterator in the iteration order.
+  // The free lists are not used, so that concurrent calls only synchronize
+  // to link the new blocks to the others.
+  template < typename... Args >
+  iterator
+  emplace_n(size_type n, const Args&... args)
+  {
+    typedef CCC_internal::Erase_counter_strategy<
+      CCC_internal::has_increment_erase_counter<T>::value> EraseCounterStrategy;
+
+    if (n == 0)
+      return end();
+
+    pointer new_block = m_alloc.allocate(n + 2);
+    for (pointer ret = new_block + 1; ret != new_block + n + 1; ++ret)
+    {
+      new (ret) value_type(args...);
+      EraseCounterStrategy::set_erase_counter(*ret, 0);
+      Time_stamper::initialize_time_stamp(ret);
+      Time_stamper::set_time_stamp(ret, m_time_stamp);
+      CGAL_assertion(type(ret) == USED);
+    }
+    link_new_block(new_block, n);
+    return iterator(new_block + 1, 0);
+  }
+
   template < class InputIterator >
   void insert(InputIterator first, InputIterator last)
   {
@@ -413,14 +442,32 @@ public:
   // The complexity is O(size(free list = capacity-size)).
   void merge(Self &d);
 
+  // Moves the elements to a single new block, in the order of the range
+  // `[first, last)`, which must contain exactly one iterator (or handle) to each
+  // element of the container. The elements get new time stamps, equal to their
+  // index in this order.
+  // Once the elements are moved, and before the memory of the old elements is
+  // released, `update(forward)` is called: `forward(it)` returns an iterator to
+  // the new position of the element that was at `it`, to update the handles
+  // stored in the elements or elsewhere. All iterators are invalidated.
+  // Do not call this function while others are inserting/erasing elements.
+  template < class InputIterator, class Update >
+  void defragment(InputIterator first, InputIterator last, const Update& update);
+
+  // Same as above, keeping the iteration order.
+  template < class Update >
+  void defragment(const Update& update)
+  {
+    std::vector<iterator> order;
+    for (iterator it = begin(), itend = end(); it != itend; ++it)
+      order.push_back(it);
+    defragment(order.begin(), order.end(), update);
+  }
+
   // Do not call this function while others are inserting/erasing elements
   size_type size() const
   {
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     size_type size = m_capacity.load(std::memory_order_relaxed);
-#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    size_type size = m_capacity;
-#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     for( typename Free_lists::iterator it_free_list = m_free_lists.begin() ;
          it_free_list != m_free_lists.end() ;
          ++it_free_list )
@@ -451,11 +498,7 @@ public:
 
   size_type capacity() const
   {
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     return m_capacity.load(std::memory_order_relaxed);
-#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    return m_capacity;
-#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   }
 
   // void resize(size_type sz, T c = T()); // TODO  makes sense ???
@@ -475,6 +518,8 @@ public:
   // Complexity : O(#blocks) = O(sqrt(capacity())).
   // This function is mostly useful for purposes of efficient debugging at
   // higher levels.
+  // It can be called while others are inserting elements: the blocks linked
+  // after the call started are ignored.
   size_type index(const_iterator cit) const
   {
     // We use the block structure to provide an efficient version :
@@ -485,12 +530,10 @@ public:
     const_pointer c = &*cit;
     size_type res=0;
 
-    Mutex::scoped_lock lock(m_mutex);
-
-    for (typename All_items::const_iterator it = m_all_items.begin(),
-         itend = m_all_items.end(); it != itend; ++it) {
-      const_pointer p = it->first;
-      size_type s = it->second;
+    const size_type nb_blocks = m_nb_blocks.load(std::memory_order_acquire);
+    for (size_type i = 0; i < nb_blocks; ++i) {
+      const_pointer p = m_all_items[i].first;
+      size_type s = m_all_items[i].second;
 
       // Are we in the address range of this block (excluding first and last
       // elements) ?
@@ -510,6 +553,7 @@ public:
   // Complexity : O(#blocks) = O(sqrt(capacity())).
   // This function is mostly useful for purposes of efficient debugging at
   // higher levels.
+  // It can be called while others are inserting elements, as `index()`.
   bool owns(const_iterator cit) const
   {
     // We use the block structure to provide an efficient version :
@@ -521,12 +565,10 @@ public:
 
     const_pointer c = &*cit;
 
-    Mutex::scoped_lock lock(m_mutex);
-
-    for (typename All_items::const_iterator it = m_all_items.begin(), itend = m_all_items.end();
-         it != itend; ++it) {
-      const_pointer p = it->first;
-      size_type s = it->second;
+    const size_type nb_blocks = m_nb_blocks.load(std::memory_order_acquire);
+    for (size_type i = 0; i < nb_blocks; ++i) {
+      const_pointer p = m_all_items[i].first;
+      size_type s = m_all_items[i].second;
 
       // Are we in the address range of this block (excluding first and last
       // elements) ?
@@ -552,20 +594,14 @@ public:
 
   /** Reserve method to ensure that the capacity of the Concurrent_compact_container be
    * greater or equal than a given value n.
+   * The new elements are put on the free list of the calling thread only.
    */
-  // TODO?
-  //void reserve(size_type n)
-  //{
-    // Does it really make sense: it will reserve size for the current
-    // thread only!
-    /*Mutex::scoped_lock lock;
-    if ( m_capacity >= n ) return;
-    size_type tmp = m_block_size;
-    // TODO: use a tmpBlockSize instead of m_block_size
-    m_block_size = (std::max)( n - m_capacity, m_block_size );
-    allocate_new_block(free_list());
-    m_block_size = tmp + CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;*/
-  //}
+  void reserve(size_type n)
+  {
+    const size_type capacity = m_capacity.load(std::memory_order_relaxed);
+    if ( capacity >= n ) return;
+    allocate_new_block(get_free_list(), n - capacity);
+  }
 
 private:
 
@@ -600,6 +636,14 @@ private:
 
   void allocate_new_block(FreeList *fl);
 
+  // Allocates a block of `block_size` elements, and puts them on `fl`.
+  void allocate_new_block(FreeList *fl, size_type block_size);
+
+  // Inserts the block at the end of the list of blocks, and records it in
+  // `m_all_items`, in the same order.
+  // Concurrent calls are safe, the blocks being linked in an unspecified order.
+  void link_new_block(pointer new_block, size_type block_size);
+
   void put_on_free_list(pointer x, FreeList * fl)
   {
     set_type(x, fl->head(), FREE);
@@ -660,8 +704,6 @@ private:
       (reinterpret_cast<std::ptrdiff_t>(clean_pointer((char *) p)) + (int) t));
   }
 
-  typedef tbb::queuing_mutex Mutex;
-
   // We store a vector of pointers to all allocated blocks and their sizes.
   // Knowing all pointers, we don't have to walk to the end of a block to reach
   // the pointer to the next block.
@@ -669,7 +711,13 @@ private:
   // by walking through the block till its end.
   // This opens up the possibility for the compiler to optimize the clear()
   // function considerably when has_trivial_destructor<T>.
-  using All_items = std::vector<std::pair<pointer, size_type> >;
+  // The blocks are recorded in the iteration order, and `m_nb_blocks` is the
+  // number of the recorded blocks, which can be read while others are added.
+  using All_items = tbb::concurrent_vector<std::pair<pointer, size_type> >;
+
+  // Only protects the linking of a new block, which is done in constant time.
+  // The allocation and initialization of the blocks are done concurrently.
+  typedef tbb::spin_mutex Mutex;
 
   using time_stamp_t = std::atomic<std::size_t>;
 
@@ -687,21 +735,19 @@ private:
     m_first_item = nullptr;
     m_last_item  = nullptr;
     m_all_items  = All_items();
+    m_nb_blocks  = 0;
     m_time_stamp = 0;
   }
 
   allocator_type    m_alloc;
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  std::atomic<size_type> m_capacity = {};
-#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  size_type         m_capacity      = {};
-#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  size_type         m_block_size    = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
+  std::atomic<size_type> m_capacity   = {};
+  std::atomic<size_type> m_block_size = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
   Free_lists        m_free_lists;
   pointer           m_first_item    = nullptr;
-  pointer           m_last_item     = nullptr;
+  std::atomic<pointer> m_last_item  = nullptr;
   All_items         m_all_items     = {};
-  mutable Mutex     m_mutex;
+  std::atomic<size_type> m_nb_blocks = {};
+  Mutex             m_link_mutex;
   time_stamp_t      m_time_stamp    = {};
 
 };
@@ -737,23 +783,20 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
     it_free_list->merge(*it_free_list_d);
   }
   // Concatenate the blocks.
-  if (m_last_item == nullptr) { // empty...
+  if (m_last_item.load() == nullptr) { // empty...
     m_first_item = d.m_first_item;
-    m_last_item  = d.m_last_item;
-  } else if (d.m_last_item != nullptr) {
-    set_type(m_last_item, d.m_first_item, BLOCK_BOUNDARY);
-    set_type(d.m_first_item, m_last_item, BLOCK_BOUNDARY);
-    m_last_item = d.m_last_item;
-  }
-  m_all_items.insert(m_all_items.end(), d.m_all_items.begin(), d.m_all_items.end());
+    m_last_item  = d.m_last_item.load();
+  } else if (d.m_last_item.load() != nullptr) {
+    set_type(m_last_item.load(), d.m_first_item, BLOCK_BOUNDARY);
+    set_type(d.m_first_item, m_last_item.load(), BLOCK_BOUNDARY);
+    m_last_item = d.m_last_item.load();
+  }
+  m_all_items.grow_by(d.m_all_items.begin(), d.m_all_items.end());
+  m_nb_blocks = m_all_items.size();
   // Add the capacities.
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   m_capacity.fetch_add(d.m_capacity, std::memory_order_relaxed);
-#else // not  CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  m_capacity += d.m_capacity;
-#endif // not  CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   // It seems reasonable to take the max of the block sizes.
-  m_block_size = (std::max)(m_block_size, d.m_block_size);
+  m_block_size = (std::max)(m_block_size.load(), d.m_block_size.load());
   // Clear d.
   d.init();
 }
@@ -777,51 +820,105 @@ void Concurrent_compact_container<T, Allocator>::clear()
 template < class T, class Allocator >
 void Concurrent_compact_container<T, Allocator>::
   allocate_new_block(FreeList * fl)
+{
+  // Increase the m_block_size for the next time.
+  const size_type old_block_size =
+    m_block_size.fetch_add(CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE,
+                           std::memory_order_relaxed);
+  allocate_new_block(fl, old_block_size);
+}
+
+template < class T, class Allocator >
+void Concurrent_compact_container<T, Allocator>::
+  allocate_new_block(FreeList * fl, size_type block_size)
 {
   typedef CCC_internal::Erase_counter_strategy<
     CCC_internal::has_increment_erase_counter<T>::value> EraseCounterStrategy;
 
-  size_type old_block_size;
-  pointer new_block;
-
-  {
-    Mutex::scoped_lock lock(m_mutex);
-    old_block_size = m_block_size;
-    new_block = m_alloc.allocate(old_block_size + 2);
-    m_all_items.push_back(std::make_pair(new_block, old_block_size + 2));
-#if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    m_capacity.fetch_add(old_block_size, std::memory_order_relaxed);
-#else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    m_capacity += old_block_size;
-#endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-
-    // We insert this new block at the end.
-    if (m_last_item == nullptr) // First time
-    {
-        m_first_item = new_block;
-        m_last_item  = new_block + old_block_size + 1;
-        set_type(m_first_item, nullptr, START_END);
-    }
-    else
-    {
-        set_type(m_last_item, new_block, BLOCK_BOUNDARY);
-        set_type(new_block, m_last_item, BLOCK_BOUNDARY);
-        m_last_item = new_block + old_block_size + 1;
-    }
-    set_type(m_last_item, nullptr, START_END);
-    // Increase the m_block_size for the next time.
-    m_block_size += CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
-  }
+  pointer new_block = m_alloc.allocate(block_size + 2);
 
   // We don't touch the first and the last one.
   // We mark them free in reverse order, so that the insertion order
   // will correspond to the iterator order...
-  for (size_type i = old_block_size; i >= 1; --i)
+  for (size_type i = block_size; i >= 1; --i)
   {
     EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
     Time_stamper::initialize_time_stamp(new_block + i);
     put_on_free_list(new_block + i, fl);
   }
+
+  link_new_block(new_block, block_size);
+}
+
+template < class T, class Allocator >
+void Concurrent_compact_container<T, Allocator>::
+  link_new_block(pointer new_block, size_type block_size)
+{
+  m_capacity.fetch_add(block_size, std::memory_order_relaxed);
+
+  // We insert this new block at the end: the last element of the block
+  // becomes the end of the container.
+  pointer new_last_item = new_block + block_size + 1;
+  set_type(new_last_item, nullptr, START_END);
+
+  Mutex::scoped_lock lock(m_link_mutex);
+  pointer previous_last_item = m_last_item.load(std::memory_order_relaxed);
+  if (previous_last_item == nullptr) // First time
+  {
+    m_first_item = new_block;
+    set_type(m_first_item, nullptr, START_END);
+  }
+  else
+  {
+    set_type(previous_last_item, new_block, BLOCK_BOUNDARY);
+    set_type(new_block, previous_last_item, BLOCK_BOUNDARY);
+  }
+  m_last_item.store(new_last_item, std::memory_order_release);
+
+  // The entry of the block is constructed before it is counted.
+  m_all_items.push_back(std::make_pair(new_block, block_size + 2));
+  m_nb_blocks.store(m_all_items.size(), std::memory_order_release);
+}
+
+template < class T, class Allocator >
+template < class InputIterator, class Update >
+void Concurrent_compact_container<T, Allocator>::
+  defragment(InputIterator first, InputIterator last, const Update& update)
+{
+  const size_type n = size();
+  Self tmp(get_allocator());
+  pointer new_block = (n == 0) ? nullptr : m_alloc.allocate(n + 2);
+
+  size_type i = 0;
+  for (; first != last; ++first, ++i)
+  {
+    pointer p = &*(*first);
+    CGAL_precondition(type(p) == USED);
+    CGAL_precondition(i < n);
+    pointer q = new_block + i + 1;
+    new (q) value_type(std::move(*p));
+    if constexpr (Time_stamper::has_timestamp) {
+      q->set_time_stamp(i);
+    }
+    CGAL_assertion(type(q) == USED);
+
+    // the old element is replaced by a pointer to the new one
+    std::allocator_traits<allocator_type>::destroy(m_alloc, p);
+    set_type(p, q, FREE);
+  }
+  CGAL_precondition(i == n);
+  if (n != 0)
+    tmp.link_new_block(new_block, n);
+  tmp.m_time_stamp = n;
+
+  swap(tmp);
+  update([](const_iterator it) -> iterator
+         {
+           if (it == const_iterator())
+             return iterator();
+           return iterator(clean_pointee(&*it), 0);
+         });
+  // the old blocks are released with tmp
 }
 
 template < class T, class Allocator >
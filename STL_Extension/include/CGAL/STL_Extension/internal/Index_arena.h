@@ -0,0 +1,351 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_STL_EXTENSION_INTERNAL_INDEX_ARENA_H
+#define CGAL_STL_EXTENSION_INTERNAL_INDEX_ARENA_H
+
+#include <CGAL/config.h>
+#include <CGAL/assertions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  include <sys/resource.h>
+#endif
+
+// The maximal number of objects of a given type in an index arena.
+// The range of addresses reserved for this type is at most this number times
+// the size of the type, and at most an eighth of the limit of the address space
+// of the process, if any. If this range cannot be reserved, a smaller one is.
+#ifndef CGAL_INDEX_ARENA_MAX_SIZE
+#  define CGAL_INDEX_ARENA_MAX_SIZE 0xFFFFFFFEu
+#endif
+
+namespace CGAL {
+namespace internal {
+
+// All the objects of type `T` allocated with `Index_arena_allocator<T>` are
+// stored in a single range of addresses, reserved at the first allocation, and
+// backed by memory in chunks, as the used part of the range grows. An object is
+// then identified by its 32-bit index in this range, which is independent of
+// the container holding it. This is what the compact items of the
+// combinatorial data structures store instead of the handles.
+//
+// The blocks are allocated at the top of the used part without locks, so that
+// the containers of a parallel data structure allocate their blocks
+// concurrently. The released blocks are merged with the adjacent released
+// blocks, the memory of their pages is given back to the system, and they are
+// reused by the next allocations that fit in them, or given back to the top.
+template < class T >
+class Index_arena
+{
+public:
+  typedef std::uint32_t index_type;
+
+  static constexpr index_type null_index = (std::numeric_limits<index_type>::max)();
+
+  // The maximal number of objects, before the range is reserved.
+  static std::size_t max_size()
+  {
+    return (std::min)(std::size_t(CGAL_INDEX_ARENA_MAX_SIZE),
+                      (std::numeric_limits<std::size_t>::max)() / 16 / sizeof(T));
+  }
+
+  static T* pointer(index_type i)
+  {
+    return (i == null_index) ? nullptr : s_base + i;
+  }
+
+  static index_type index(const T* p)
+  {
+    if(p == nullptr)
+      return null_index;
+    CGAL_precondition(s_base <= p && p < s_base + instance().capacity());
+    return index_type(p - s_base);
+  }
+
+  // The arena is never destroyed, so that static containers can
+  // still release their memory at exit.
+  static Index_arena& instance()
+  {
+    static Index_arena* arena = new Index_arena();
+    return *arena;
+  }
+
+  // The number of objects of the reserved range.
+  std::size_t capacity() const
+  {
+    return m_capacity.load(std::memory_order_acquire);
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if(capacity() == 0)
+      reserve();
+
+    if(m_nb_free_ranges.load(std::memory_order_acquire) != 0)
+    {
+      T* p = allocate_in_free_range(n);
+      if(p != nullptr)
+        return p;
+    }
+
+    std::size_t top = m_top.load(std::memory_order_relaxed);
+    do {
+      if(n > capacity() - top)
+        throw std::bad_alloc();
+    } while(!m_top.compare_exchange_weak(top, top + n, std::memory_order_acq_rel));
+
+#if defined(_WIN32)
+    // the ranges given back to the top are decommitted
+    commit(top, top + n);
+#else
+    commit_up_to(top + n);
+#endif
+    return s_base + top;
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    std::size_t first = p - s_base;
+    std::size_t last = first + n;
+    decommit(first, last);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // merge with the adjacent free ranges
+    typename Free_ranges::iterator next = m_free_ranges.lower_bound(first);
+    if(next != m_free_ranges.end() && next->first == last)
+    {
+      last = next->second;
+      erase_free_range(next++);
+    }
+    if(next != m_free_ranges.begin())
+    {
+      typename Free_ranges::iterator previous = std::prev(next);
+      if(previous->second == first)
+      {
+        first = previous->first;
+        erase_free_range(previous);
+      }
+    }
+
+    // give the range back to the top, unless others allocated above it
+    std::size_t top = last;
+    if(!m_top.compare_exchange_strong(top, first, std::memory_order_acq_rel))
+      insert_free_range(first, last);
+  }
+
+private:
+  // The free ranges [first, last), by first, and by size.
+  typedef std::map<std::size_t, std::size_t>           Free_ranges;
+  typedef std::multimap<std::size_t, std::size_t>      Free_ranges_by_size;
+
+  // The memory of the pages entirely inside a released range is given back to
+  // the system. This granularity is a multiple of the page size on all systems.
+  static constexpr std::size_t release_granularity = std::size_t(1) << 16;
+
+  // The memory of the range is committed by chunks of this number of bytes.
+  static constexpr std::size_t commit_granularity = std::size_t(1) << 24;
+
+  Index_arena() {}
+
+  void insert_free_range(std::size_t first, std::size_t last)
+  {
+    m_free_ranges.emplace(first, last);
+    m_free_ranges_by_size.emplace(last - first, first);
+    m_nb_free_ranges.store(m_free_ranges.size(), std::memory_order_release);
+  }
+
+  void erase_free_range(typename Free_ranges::iterator it)
+  {
+    typename Free_ranges_by_size::iterator s =
+      m_free_ranges_by_size.lower_bound(it->second - it->first);
+    while(s->second != it->first)
+      ++s;
+    m_free_ranges_by_size.erase(s);
+    m_free_ranges.erase(it);
+    m_nb_free_ranges.store(m_free_ranges.size(), std::memory_order_release);
+  }
+
+  // Allocates in the smallest free range that is large enough, if any.
+  T* allocate_in_free_range(std::size_t n)
+  {
+    std::size_t first;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      typename Free_ranges_by_size::iterator s = m_free_ranges_by_size.lower_bound(n);
+      if(s == m_free_ranges_by_size.end())
+        return nullptr;
+      first = s->second;
+      const std::size_t last = first + s->first;
+      erase_free_range(m_free_ranges.find(first));
+      if(first + n != last)
+        insert_free_range(first + n, last);
+    }
+#if defined(_WIN32)
+    // the released ranges are decommitted
+    commit(first, first + n);
+#endif
+    return s_base + first;
+  }
+
+  void reserve()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(capacity() != 0)
+      return;
+
+    std::size_t bytes = max_size() * sizeof(T);
+#if !defined(_WIN32)
+    rlimit limit;
+    if(getrlimit(RLIMIT_AS, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+      bytes = (std::min)(bytes, std::size_t(limit.rlim_cur / 8));
+#endif
+
+    // If the range cannot be reserved, try a smaller one.
+    void* p = nullptr;
+    for(; bytes >= commit_granularity; bytes /= 2)
+    {
+#if defined(_WIN32)
+      p = VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+      // Only the address range is reserved, the memory is committed with mprotect().
+      p = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      if(p == MAP_FAILED)
+        p = nullptr;
+#endif
+      if(p != nullptr)
+        break;
+    }
+    if(p == nullptr)
+      throw std::bad_alloc();
+
+    s_base = static_cast<T*>(p);
+    m_capacity.store(bytes / sizeof(T), std::memory_order_release);
+  }
+
+  // Commits the memory of the range up to the object `last` excluded.
+  void commit_up_to(std::size_t last)
+  {
+    if(last <= m_committed.load(std::memory_order_acquire))
+      return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::size_t committed = m_committed.load(std::memory_order_relaxed);
+    if(last <= committed)
+      return;
+    const std::size_t chunk = commit_granularity / sizeof(T);
+    const std::size_t new_committed = (std::min)(capacity(), (last + chunk - 1) / chunk * chunk);
+    commit(committed, new_committed);
+    m_committed.store(new_committed, std::memory_order_release);
+  }
+
+  // On Windows, the released ranges are decommitted, and must be committed
+  // again when they are reused. On the other systems, the pages of the
+  // released ranges are given back but stay readable and writable.
+  static void commit(std::size_t first, std::size_t last)
+  {
+    if(first == last)
+      return;
+#if defined(_WIN32)
+    if(VirtualAlloc(s_base + first, (last - first) * sizeof(T), MEM_COMMIT, PAGE_READWRITE) == nullptr)
+      throw std::bad_alloc();
+#else
+    // the first page may be already committed
+    std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(s_base + first);
+    std::uintptr_t end = reinterpret_cast<std::uintptr_t>(s_base + last);
+    begin = (std::max)(begin & ~std::uintptr_t(release_granularity - 1),
+                       reinterpret_cast<std::uintptr_t>(s_base));
+    if(mprotect(reinterpret_cast<void*>(begin), end - begin, PROT_READ | PROT_WRITE) != 0)
+      throw std::bad_alloc();
+#endif
+  }
+
+  static void decommit(std::size_t first_index, std::size_t last_index)
+  {
+    std::uintptr_t first = reinterpret_cast<std::uintptr_t>(s_base + first_index);
+    std::uintptr_t last = reinterpret_cast<std::uintptr_t>(s_base + last_index);
+    first = (first + release_granularity - 1) & ~std::uintptr_t(release_granularity - 1);
+    last &= ~std::uintptr_t(release_granularity - 1);
+    if(first >= last)
+      return;
+#if defined(_WIN32)
+    VirtualFree(reinterpret_cast<void*>(first), last - first, MEM_DECOMMIT);
+#else
+    madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED);
+#endif
+  }
+
+  static inline T* s_base = nullptr;
+
+  std::atomic<std::size_t> m_capacity = {};
+  std::atomic<std::size_t> m_top = {};
+  std::atomic<std::size_t> m_committed = {};
+
+  // Protects the reservation, the commit of new chunks, and the free ranges.
+  std::mutex          m_mutex;
+  Free_ranges         m_free_ranges;
+  Free_ranges_by_size m_free_ranges_by_size;
+  std::atomic<std::size_t> m_nb_free_ranges = {};
+};
+
+// A stateless allocator that allocates in `Index_arena<T>`.
+template < class T >
+class Index_arena_allocator
+{
+public:
+  typedef T value_type;
+
+  Index_arena_allocator() noexcept {}
+
+  template < class U >
+  Index_arena_allocator(const Index_arena_allocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n)
+  {
+    return Index_arena<T>::instance().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    Index_arena<T>::instance().deallocate(p, n);
+  }
+
+  std::size_t max_size() const
+  {
+    return Index_arena<T>::max_size();
+  }
+
+  template < class U >
+  bool operator==(const Index_arena_allocator<U>&) const { return true; }
+
+  template < class U >
+  bool operator!=(const Index_arena_allocator<U>&) const { return false; }
+};
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_STL_EXTENSION_INTERNAL_INDEX_ARENA_H
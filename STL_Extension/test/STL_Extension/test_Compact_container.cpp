@@ -1,5 +1,6 @@
 // test program for Compact_container.
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <list>
@@ -73,6 +74,26 @@ public:
   void for_compact_container(void *p)       { p_cc = p; }
 };
 
+// A node storing a handle to another node of the same container.
+struct Ring_node
+: public CGAL::Compact_container_base
+{
+  typedef CGAL::Tag_true Has_timestamp;
+
+  Ring_node(int v = 0) : value(v) {}
+
+  std::size_t time_stamp() const {
+    return time_stamp_;
+  }
+  void set_time_stamp(const std::size_t& ts) {
+    time_stamp_ = ts;
+  }
+
+  int value;
+  CGAL::Compact_container<Ring_node>::iterator next;
+  std::size_t time_stamp_;
+};
+
 template < class Cont >
 inline bool check_empty(const Cont &c)
 {
@@ -294,6 +315,91 @@ void test_time_stamps() {
   }
 }
 
+template < class Cont >
+void test_emplace_n_and_defragment()
+{
+  typedef typename Cont::iterator iterator;
+
+  Cont c;
+  for (int i = 0 ; i < 1000 ; ++i)
+    c.emplace(-1);
+  // make some holes
+  std::vector<iterator> holes;
+  int k = 0;
+  for (iterator it = c.begin(); it != c.end(); ++it, ++k)
+    if (k % 3 == 0)
+      holes.push_back(it);
+  for (iterator h : holes)
+    c.erase(h);
+  std::size_t old_size = c.size(), old_capacity = c.capacity();
+  assert(c.emplace_n(0, 1) == c.end());
+
+  // the new elements are consecutive, after the old ones
+  iterator first = c.emplace_n(5000, 1);
+  assert(c.size() == old_size + 5000);
+  assert(std::distance(first, c.end()) == 5000);
+  for (iterator it = c.begin(); it != first; ++it)
+    assert(it->value == -1);
+  std::size_t ts = first->time_stamp();
+  for (iterator it = first; it != c.end(); ++it, ++ts) {
+    assert(it->value == 1);
+    assert(it->time_stamp() == ts);
+  }
+  assert(c.index(first) == old_capacity);
+  // the remaining free slots are used by the next insertions
+  std::size_t capacity = c.capacity();
+  for (std::size_t i = c.size() ; i < capacity ; ++i)
+    c.emplace(2);
+  assert(c.capacity() == capacity);
+
+  // link each element to the next one in the iteration order
+  std::vector<iterator> elements;
+  for (iterator it = c.begin(); it != c.end(); ++it) {
+    it->value = static_cast<int>(elements.size());
+    elements.push_back(it);
+  }
+  const int n = static_cast<int>(elements.size());
+  for (int i = 0 ; i < n ; ++i)
+    elements[i]->next = elements[(i + 1) % n];
+
+  // reverse the order
+  std::reverse(elements.begin(), elements.end());
+  bool updated = false;
+  c.defragment(elements.begin(), elements.end(),
+               [&](const auto& forward)
+               {
+                 for (Ring_node& node : c)
+                   node.next = forward(node.next);
+                 assert(forward(typename Cont::const_iterator()) == iterator());
+                 updated = true;
+               });
+  assert(updated);
+  assert(c.size() == std::size_t(n));
+  int i = 0;
+  for (iterator it = c.begin(); it != c.end(); ++it, ++i) {
+    assert(it->value == n - 1 - i);
+    assert(it->time_stamp() == std::size_t(i));
+    assert(it->next->value == (it->value + 1) % n);
+    assert(&c[i] == &*it);
+  }
+  assert(i == n);
+
+  // the order is kept, and the container is usable afterwards
+  c.defragment([&](const auto& forward)
+               {
+                 for (Ring_node& node : c)
+                   node.next = forward(node.next);
+               });
+  i = 0;
+  for (iterator it = c.begin(); it != c.end(); ++it, ++i) {
+    assert(it->value == n - 1 - i);
+    assert(it->next->value == (it->value + 1) % n);
+  }
+  c.erase(c.begin());
+  c.emplace(n);
+  assert(c.size() == std::size_t(n));
+}
+
 struct Incomplete_struct;
 
 int main()
@@ -352,6 +458,8 @@ int main()
 
   test_index(C5);
   test_index(C6);
+
+  test_emplace_n_and_defragment<CGAL::Compact_container<Ring_node> >();
   return 0;
 }
 // EOF //
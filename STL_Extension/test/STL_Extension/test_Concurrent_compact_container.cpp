@@ -14,6 +14,7 @@ int main()
 
 #else
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <list>
@@ -25,6 +26,7 @@ int main()
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
 # include <tbb/global_control.h>
 # include <tbb/parallel_for.h>
+# include <tbb/task_arena.h>
 # include <atomic>
 
 #include <CGAL/disable_warnings.h>
@@ -70,6 +72,26 @@ public:
   void for_compact_container(void *p) { p_cc = p; }
 };
 
+// A node storing a handle to another node of the same container.
+struct Ring_node
+: public CGAL::Compact_container_base
+{
+  typedef CGAL::Tag_true Has_timestamp;
+
+  Ring_node(int v = 0) : value(v) {}
+
+  std::size_t time_stamp() const {
+    return time_stamp_;
+  }
+  void set_time_stamp(const std::size_t& ts) {
+    time_stamp_ = ts;
+  }
+
+  int value;
+  CGAL::Concurrent_compact_container<Ring_node>::iterator next;
+  std::size_t time_stamp_;
+};
+
 template < class Cont >
 inline bool check_empty(const Cont &c)
 {
@@ -396,6 +418,94 @@ void test_time_stamps() {
   }
 }
 
+template < class Cont >
+void test_emplace_n_and_defragment()
+{
+  typedef typename Cont::iterator iterator;
+
+  Cont c;
+  c.reserve(1000);
+  assert(c.capacity() >= 1000);
+  const std::size_t capacity = c.capacity();
+  for (int i = 0 ; i < 1000 ; ++i)
+    c.emplace(-1);
+  assert(c.capacity() == capacity);
+  assert(c.emplace_n(0, 1) == c.end());
+
+  // concurrent bulk insertions: each range is contiguous in memory
+  const int nb_ranges = 100, range_size = 64;
+  tbb::parallel_for(
+    tbb::blocked_range<int>(0, nb_ranges),
+    [&](const tbb::blocked_range<int>& r)
+    {
+      for (int i = r.begin() ; i != r.end() ; ++i)
+      {
+        iterator first = c.emplace_n(range_size, i);
+        iterator it = first;
+        for (int j = 0 ; j < range_size ; ++j, ++it) {
+          assert(it->value == i);
+          assert(&*it == &*first + j);
+        }
+        // the blocks being added by the other threads are ignored
+        assert(c.owns(first));
+        assert(c.index(first) != std::size_t(-1));
+      }
+    });
+  const int n = 1000 + nb_ranges * range_size;
+  assert(c.size() == std::size_t(n));
+  assert(std::distance(c.begin(), c.end()) == n);
+
+  // the indices follow the iteration order
+  std::size_t index = 0;
+  for (iterator it = c.begin(); it != c.end(); ++it, ++index)
+    assert(c.index(it) == index);
+
+  // make some holes
+  std::vector<iterator> holes;
+  int k = 0;
+  for (iterator it = c.begin(); it != c.end(); ++it, ++k)
+    if (k % 3 == 0)
+      holes.push_back(it);
+  for (iterator h : holes)
+    c.erase(h);
+
+  // link each element to the next one in the iteration order
+  std::vector<iterator> elements;
+  for (iterator it = c.begin(); it != c.end(); ++it) {
+    it->value = static_cast<int>(elements.size());
+    elements.push_back(it);
+  }
+  const int m = static_cast<int>(elements.size());
+  for (int i = 0 ; i < m ; ++i)
+    elements[i]->next = elements[(i + 1) % m];
+
+  // reverse the order: the elements are moved to a single block
+  std::reverse(elements.begin(), elements.end());
+  c.defragment(elements.begin(), elements.end(),
+               [&](const auto& forward)
+               {
+                 for (Ring_node& node : c)
+                   node.next = forward(node.next);
+               });
+  assert(c.size() == std::size_t(m));
+  assert(c.capacity() == std::size_t(m));
+  int i = 0;
+  for (iterator it = c.begin(); it != c.end(); ++it, ++i) {
+    assert(it->value == m - 1 - i);
+    assert(it->time_stamp() == std::size_t(i));
+    assert(it->next->value == (it->value + 1) % m);
+    assert(&*it == &*c.begin() + i);
+    assert(c.index(it) == std::size_t(i));
+  }
+  assert(i == m);
+
+  // the container is usable afterwards
+  c.erase(c.begin());
+  iterator last = c.emplace(m);
+  assert(last->value == m);
+  assert(c.size() == std::size_t(m));
+}
+
 int main()
 {
   CGAL::Concurrent_compact_container<Node_1> C1;
@@ -451,6 +561,10 @@ int main()
     std::cout << "cc2: " << it->rnd << " / " << std::endl;
   }*/
 
+  // run the concurrent insertions on several threads, whatever the number of cores
+  tbb::task_arena arena(4);
+  arena.execute([]{ test_emplace_n_and_defragment<CGAL::Concurrent_compact_container<Ring_node> >(); });
+
   tbb::global_control c(tbb::global_control::max_allowed_parallelism, 1);
   test_time_stamps<CGAL::Concurrent_compact_container<Node_1> >();
   return 0;
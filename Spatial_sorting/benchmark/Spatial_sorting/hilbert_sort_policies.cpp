@@ -0,0 +1,59 @@
+// Times the Hilbert sort and the spatial sort of random points in a cube
+// with the median, middle and key policies, sequential and parallel.
+//
+// Usage: hilbert_sort_policies [number of points]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel  K;
+typedef K::Point_3                                           Point_3;
+
+template <class ConcurrencyTag, class Policy>
+void bench(const std::string& name, const std::vector<Point_3>& points, Policy policy)
+{
+  std::vector<Point_3> v(points);
+  CGAL::Real_timer timer;
+  timer.start();
+  CGAL::hilbert_sort<ConcurrencyTag>(v.begin(), v.end(), policy);
+  double hilbert = timer.time();
+
+  v = points;
+  timer.reset();
+  CGAL::spatial_sort<ConcurrencyTag>(v.begin(), v.end(), policy);
+  timer.stop();
+
+  std::cout << name << " hilbert_sort: " << hilbert << " sec., "
+            << "spatial_sort: " << timer.time() << " sec." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t n = (argc > 1) ? std::atol(argv[1]) : 10000000;
+
+  std::vector<Point_3> points;
+  points.reserve(n);
+  CGAL::Random_points_in_cube_3<Point_3> gen(1.0);
+  std::copy_n(gen, n, std::back_inserter(points));
+  std::cout << n << " points" << std::endl;
+
+  bench<CGAL::Sequential_tag>("median, sequential", points, CGAL::Hilbert_sort_median_policy());
+  bench<CGAL::Sequential_tag>("middle, sequential", points, CGAL::Hilbert_sort_middle_policy());
+  bench<CGAL::Sequential_tag>("key,    sequential", points, CGAL::Hilbert_sort_key_policy());
+#ifdef CGAL_LINKED_WITH_TBB
+  bench<CGAL::Parallel_tag>("median, parallel  ", points, CGAL::Hilbert_sort_median_policy());
+  bench<CGAL::Parallel_tag>("key,    parallel  ", points, CGAL::Hilbert_sort_key_policy());
+#endif
+
+  return EXIT_SUCCESS;
+}
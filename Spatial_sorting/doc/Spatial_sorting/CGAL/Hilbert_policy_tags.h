@@ -12,9 +12,11 @@ as parameter to `hilbert_sort()` to choose the sorting policy.
 \cgalModels{DefaultConstructible,CopyConstructible}
 
 \sa `Middle`
+\sa `Key`
 \sa `Hilbert_policy`
 \sa `Hilbert_sort_median_policy`
 \sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_key_policy`
 */
 struct Median { };
 
@@ -29,28 +31,51 @@ as parameter to `hilbert_sort()` to choose the sorting policy.
 \cgalModels{DefaultConstructible,CopyConstructible}
 
 \sa `Median`
+\sa `Key`
 \sa `Hilbert_policy`
 \sa `Hilbert_sort_median_policy`
 \sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_key_policy`
 */
 struct Middle { };
 
 /*!
 \ingroup PkgSpatialSortingUtils
 
+`Key` is a tag class. It can be used to parameterize a strategy policy
+in order to specify the strategy for spatial sorting.
+`Hilbert_policy<Key>` can be passed to
+as parameter to `hilbert_sort()` to choose the sorting policy.
+
+\cgalModels{DefaultConstructible,CopyConstructible}
+
+\sa `Median`
+\sa `Middle`
+\sa `Hilbert_policy`
+\sa `Hilbert_sort_median_policy`
+\sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_key_policy`
+*/
+struct Key { };
+
+/*!
+\ingroup PkgSpatialSortingUtils
+
 `Hilbert_policy` is a policy class which can be used to parameterize a strategy policy
 in order to specify the strategy for spatial sorting.
-`Hilbert_policy<Median>` or `Hilbert_policy<Middle>`
+`Hilbert_policy<Median>`, `Hilbert_policy<Middle>`, or `Hilbert_policy<Key>`
 can be passed  as parameter to `hilbert_sort()` to choose the sorting policy.
 
-\tparam Tag must be either `Median` or `Middle`.
+\tparam Tag must be `Median`, `Middle`, or `Key`.
 
 \cgalModels{DefaultConstructible,CopyConstructible}
 
 \sa `Median`
 \sa `Middle`
+\sa `Key`
 \sa `Hilbert_sort_median_policy`
 \sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_key_policy`
 */
 template< typename Tag >
 struct Hilbert_policy { };
@@ -69,4 +94,11 @@ A typedef to `Hilbert_policy<Middle>`.
 */
 typedef Hilbert_policy<Middle>  Hilbert_sort_middle_policy;
 
+/*!
+\ingroup PkgSpatialSortingUtils
+
+A typedef to `Hilbert_policy<Key>`.
+*/
+typedef Hilbert_policy<Key>  Hilbert_sort_key_policy;
+
 } /* end namespace CGAL */
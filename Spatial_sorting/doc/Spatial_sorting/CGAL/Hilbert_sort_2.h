@@ -12,12 +12,13 @@ for more information on the policies).
 
 \tparam PolicyTag is used to specify the strategy policy.
 Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_policy` \endlink
-(the default policy) or \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink.
+(the default policy), \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink,
+or \link CGAL::Hilbert_sort_key_policy `Hilbert_sort_key_policy` \endlink.
 
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 With parallelism enabled, sorting will be performed using up to four threads.
-Parallel sorting is available only when the median strategy policy (the default policy) is used.
+Parallel sorting is available only with the median strategy policy (the default policy) and the key strategy policy.
 */
   template< typename Traits, typename PolicyTag, typename ConcurrencyTag = Sequential_tag >
 class Hilbert_sort_2 {
@@ -11,10 +11,14 @@ or the middle depending on the `PolicyTag`.
 
 \tparam PolicyTag is used to specify the strategy policy.
 Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_policy` \endlink
-(the default policy) or \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink.
+(the default policy), \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink,
+or \link CGAL::Hilbert_sort_key_policy `Hilbert_sort_key_policy` \endlink.
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+Parallel sorting is available only when the key strategy policy is used.
 */
-template< typename Traits, typename PolicyTag >
+template< typename Traits, typename PolicyTag, typename ConcurrencyTag = Sequential_tag >
 class Hilbert_sort_d {
 public:
 
@@ -12,7 +12,7 @@ It sorts the range `[begin, end)` in place.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 With parallelism enabled, sorting will be performed using up to four threads in 2D,
 and up to eight threads in 3D.
-Parallel sorting is available only when the median strategy policy (the default policy) is used.
+Parallel sorting is available only with the median strategy policy (the default policy) and the key strategy policy.
 
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
 `std::iterator_traits<InputPointIterator>::%value_type` must be convertible to
@@ -25,7 +25,8 @@ The default traits class `Default_traits` is the kernel in which the type
 
 \tparam PolicyTag is used to specify the strategy policy.
 Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_policy` \endlink
-(the default policy) or \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink.
+(the default policy), \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink,
+or \link CGAL::Hilbert_sort_key_policy `Hilbert_sort_key_policy` \endlink.
 
 \cgalHeading{Implementation}
 
@@ -17,6 +17,7 @@ namespace CGAL {
 
 struct Middle {};
 struct Median {};
+struct Key {};
 
 
 // A policy to select the sorting strategy.
@@ -26,6 +27,7 @@ struct Hilbert_policy {};
 
 typedef Hilbert_policy<Middle>      Hilbert_sort_middle_policy;
 typedef Hilbert_policy<Median>      Hilbert_sort_median_policy;
+typedef Hilbert_policy<Key>         Hilbert_sort_key_policy;
 
 } // namespace CGAL
 
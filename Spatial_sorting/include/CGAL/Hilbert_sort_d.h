@@ -15,14 +15,15 @@
 #include <CGAL/Hilbert_policy_tags.h>
 #include <CGAL/Hilbert_sort_median_d.h>
 #include <CGAL/Hilbert_sort_middle_d.h>
+#include <CGAL/Hilbert_sort_key_d.h>
 
 namespace CGAL {
 
-template <class K,  class Hilbert_policy >
+template <class K,  class Hilbert_policy, class ConcurrencyTag = Sequential_tag >
 class Hilbert_sort_d;
 
-template <class K>
-class Hilbert_sort_d<K, Hilbert_sort_median_policy >
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_d<K, Hilbert_sort_median_policy, ConcurrencyTag >
     : public Hilbert_sort_median_d<K>
 {
 public:
@@ -31,8 +32,8 @@ public:
   {}
 };
 
-template <class K>
-class Hilbert_sort_d<K, Hilbert_sort_middle_policy >
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_d<K, Hilbert_sort_middle_policy, ConcurrencyTag >
     : public Hilbert_sort_middle_d<K>
 {
 public:
@@ -41,6 +42,16 @@ public:
   {}
 };
 
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_d<K, Hilbert_sort_key_policy, ConcurrencyTag >
+    : public Hilbert_sort_key_d<K, ConcurrencyTag>
+{
+public:
+  Hilbert_sort_d (const K &k=K() , std::ptrdiff_t limit=1 )
+    : Hilbert_sort_key_d<K, ConcurrencyTag> (k,limit)
+  {}
+};
+
 } // namespace CGAL
 
 #endif//CGAL_HILBERT_SORT_d_H
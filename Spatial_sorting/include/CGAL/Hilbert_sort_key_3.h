@@ -0,0 +1,64 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_HILBERT_SORT_KEY_3_H
+#define CGAL_HILBERT_SORT_KEY_3_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/Hilbert_sort_key_base.h>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace CGAL {
+
+template <class K, class ConcurrencyTag = Sequential_tag>
+class Hilbert_sort_key_3
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+public:
+  typedef K Kernel;
+  typedef typename Kernel::Point_3 Point;
+
+private:
+  Kernel _k;
+  std::ptrdiff_t _limit;
+
+public:
+  Hilbert_sort_key_3 (const Kernel &k = Kernel(), std::ptrdiff_t limit = 1)
+    : _k(k), _limit (limit)
+  {}
+
+  template <class RandomAccessIterator>
+  void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+    if (end - begin <= _limit) return;
+
+    const Kernel& k = _k;
+    internal::hilbert_sort_by_keys<ConcurrencyTag>(begin, end, 3,
+      [&k](const Point& p, double* c)
+      {
+        c[0] = to_double(k.compute_x_3_object()(p));
+        c[1] = to_double(k.compute_y_3_object()(p));
+        c[2] = to_double(k.compute_z_3_object()(p));
+      });
+  }
+};
+
+} // namespace CGAL
+
+#endif//CGAL_HILBERT_SORT_KEY_3_H
@@ -0,0 +1,372 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_HILBERT_SORT_KEY_BASE_H
+#define CGAL_HILBERT_SORT_KEY_BASE_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/assertions.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+// Position of a point along the Hilbert curve and position of the point in the input range.
+struct Hilbert_key_and_index
+{
+  std::uint64_t key;
+  std::size_t index;
+
+  bool operator<(const Hilbert_key_and_index& other) const
+  {
+    return key < other.key || (key == other.key && index < other.index);
+  }
+};
+
+// Computes the position along the Hilbert curve of the cell of integer coordinates `x`
+// in a grid of `2^bits` cells per axis, with `dim * bits <= 64`. `x` is modified.
+// This is the "transpose" algorithm of J. Skilling, Programming the Hilbert curve,
+// AIP Conference Proceedings 707, 2004, followed by the interleaving of the bits.
+inline std::uint64_t hilbert_key(std::uint32_t* x, int dim, int bits)
+{
+  const std::uint32_t m = std::uint32_t(1) << (bits - 1);
+
+  // inverse undo
+  for(std::uint32_t q = m; q > 1; q >>= 1)
+  {
+    const std::uint32_t p = q - 1;
+    for(int i = 0; i < dim; ++i)
+    {
+      // invert if the bit is set, exchange otherwise, without branches
+      const std::uint32_t invert = 0u - std::uint32_t((x[i] & q) != 0);
+      x[0] ^= p & invert;
+      const std::uint32_t t = (x[0] ^ x[i]) & p & ~invert;
+      x[0] ^= t;
+      x[i] ^= t;
+    }
+  }
+
+  // Gray encode
+  for(int i = 1; i < dim; ++i)
+    x[i] ^= x[i-1];
+  std::uint32_t t = 0;
+  for(std::uint32_t q = m; q > 1; q >>= 1)
+    if(x[dim-1] & q)
+      t ^= q - 1;
+  for(int i = 0; i < dim; ++i)
+    x[i] ^= t;
+
+  std::uint64_t key = 0;
+  for(int b = bits - 1; b >= 0; --b)
+    for(int i = 0; i < dim; ++i)
+      key = (key << 1) | ((x[i] >> b) & 1);
+  return key;
+}
+
+// The algorithm of `hilbert_key()` as a finite state machine processing the levels of
+// the grid from the coarsest one, to compute the keys of small dimensions faster.
+// A state is the transformation of the bits of the coordinates at the current level
+// by the exchanges and inversions made at the previous levels.
+template <int D>
+class Hilbert_key_table
+{
+  static constexpr int nb_digits = 1 << D;
+
+  // the bit of coordinate `i` at the current level is `bit[perm[i]] ^ flip[i]`
+  struct State
+  {
+    std::array<int, D> perm;
+    std::array<int, D> flip;
+
+    bool operator==(const State& other) const
+    {
+      return perm == other.perm && flip == other.flip;
+    }
+  };
+
+  std::vector<std::uint8_t> m_digit;
+  std::vector<std::uint8_t> m_next;
+
+  Hilbert_key_table()
+  {
+    std::vector<State> states(1);
+    for(int i = 0; i < D; ++i)
+    {
+      states[0].perm[i] = i;
+      states[0].flip[i] = 0;
+    }
+
+    // the bits of the digits are the bits of the coordinates, the first coordinate being the most significant
+    for(std::size_t s = 0; s < states.size(); ++s)
+    {
+      for(int raw = 0; raw < nb_digits; ++raw)
+      {
+        const State& state = states[s];
+        int y[D];
+        for(int i = 0; i < D; ++i)
+          y[i] = ((raw >> (D - 1 - state.perm[i])) & 1) ^ state.flip[i];
+
+        State next = state;
+        for(int i = 0; i < D; ++i)
+        {
+          if(y[i])
+          {
+            next.flip[0] ^= 1;
+          }
+          else
+          {
+            std::swap(next.perm[0], next.perm[i]);
+            std::swap(next.flip[0], next.flip[i]);
+          }
+        }
+
+        int gray = 0, g = 0;
+        for(int i = 0; i < D; ++i)
+        {
+          g ^= y[i];
+          gray = (gray << 1) | g;
+        }
+
+        std::size_t n = std::find(states.begin(), states.end(), next) - states.begin();
+        if(n == states.size())
+          states.push_back(next);
+
+        m_digit.push_back(std::uint8_t(gray));
+        m_next.push_back(std::uint8_t(n));
+      }
+    }
+  }
+
+public:
+  static const Hilbert_key_table& instance()
+  {
+    static const Hilbert_key_table table;
+    return table;
+  }
+
+  // Same as `hilbert_key(x, D, bits)`, without modifying `x`.
+  std::uint64_t key(const std::uint32_t* x, int bits) const
+  {
+    const std::uint64_t all_ones = nb_digits - 1;
+    std::uint64_t key = 0, parity = 0;
+    std::size_t state = 0;
+    for(int b = bits - 1; b >= 0; --b)
+    {
+      std::size_t raw = 0;
+      for(int i = 0; i < D; ++i)
+        raw = (raw << 1) | ((x[i] >> b) & 1);
+      const std::size_t index = state * nb_digits + raw;
+      const std::uint64_t digit = m_digit[index];
+      state = m_next[index];
+
+      // the last step of the Gray encoding inverts the lower levels for each set bit of the last coordinate
+      key = (key << D) | (digit ^ (all_ones & (0 - parity)));
+      parity ^= digit & 1;
+    }
+    return key;
+  }
+};
+
+// Calls `f(block, first, last)` for the blocks `[first, last)` of size `block_size` of `[0, n)`,
+// concurrently with `Parallel_tag`.
+template <class ConcurrencyTag, class F>
+void for_each_block(std::size_t n, std::size_t block_size, const F& f)
+{
+  const std::size_t nb_blocks = (n + block_size - 1) / block_size;
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_blocks, 1),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for(std::size_t b = r.begin(); b != r.end(); ++b)
+                          f(b, b * block_size, (std::min)(n, (b + 1) * block_size));
+                      });
+    return;
+  }
+#endif
+  for(std::size_t b = 0; b < nb_blocks; ++b)
+    f(b, b * block_size, (std::min)(n, (b + 1) * block_size));
+}
+
+// Sorts `keys` by key, then by index, with a least significant digit radix sort.
+template <class ConcurrencyTag>
+void radix_sort_hilbert_keys(std::vector<Hilbert_key_and_index>& keys)
+{
+  const std::size_t n = keys.size();
+  if(n < 4096)
+  {
+    std::sort(keys.begin(), keys.end());
+    return;
+  }
+
+  // digits of 11 bits, so that the keys are sorted in 6 passes
+  constexpr int digit_bits = 11;
+  constexpr std::size_t nb_digits = std::size_t(1) << digit_bits;
+  constexpr std::uint64_t digit_mask = nb_digits - 1;
+  const std::size_t block_size = 1 << 16;
+  const std::size_t nb_blocks = (n + block_size - 1) / block_size;
+  std::vector<std::array<std::size_t, nb_digits> > counts(nb_blocks);
+  std::vector<Hilbert_key_and_index> buffer(n);
+
+  for(int shift = 0; shift < 64; shift += digit_bits)
+  {
+    for_each_block<ConcurrencyTag>(n, block_size,
+      [&](std::size_t b, std::size_t first, std::size_t last)
+      {
+        counts[b].fill(0);
+        for(std::size_t i = first; i < last; ++i)
+          ++counts[b][(keys[i].key >> shift) & digit_mask];
+      });
+
+    // the pass is skipped if all the keys have the same digit
+    bool is_constant = false;
+    for(std::size_t d = 0; d < nb_digits && !is_constant; ++d)
+    {
+      std::size_t total = 0;
+      for(std::size_t b = 0; b < nb_blocks; ++b)
+        total += counts[b][d];
+      is_constant = (total == n);
+    }
+    if(is_constant)
+      continue;
+
+    // the keys of a block with a given digit follow the ones of the previous blocks, so the sort is stable
+    std::size_t offset = 0;
+    for(std::size_t d = 0; d < nb_digits; ++d)
+    {
+      for(std::size_t b = 0; b < nb_blocks; ++b)
+      {
+        const std::size_t c = counts[b][d];
+        counts[b][d] = offset;
+        offset += c;
+      }
+    }
+
+    for_each_block<ConcurrencyTag>(n, block_size,
+      [&](std::size_t b, std::size_t first, std::size_t last)
+      {
+        for(std::size_t i = first; i < last; ++i)
+          buffer[counts[b][(keys[i].key >> shift) & digit_mask]++] = keys[i];
+      });
+    keys.swap(buffer);
+  }
+}
+
+// Sorts the range `[begin, end)` along a Hilbert curve, in the bounding box of the range,
+// by computing the position of each point along the curve.
+// `coordinates(p, c)` writes the `dim` coordinates of `p` in `c`.
+// Equal positions keep the input order.
+template <class ConcurrencyTag, class RandomAccessIterator, class Coordinates>
+void hilbert_sort_by_keys(RandomAccessIterator begin, RandomAccessIterator end,
+                          int dim, const Coordinates& coordinates)
+{
+  typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+  const std::size_t n = end - begin;
+  if(n < 2)
+    return;
+  CGAL_precondition(0 < dim && dim <= 64);
+
+  const std::size_t block_size = 1 << 14;
+  const std::size_t nb_blocks = (n + block_size - 1) / block_size;
+
+  // the bounding box
+  std::vector<std::vector<double> > block_min(nb_blocks), block_max(nb_blocks);
+  for_each_block<ConcurrencyTag>(n, block_size,
+    [&](std::size_t b, std::size_t first, std::size_t last)
+    {
+      std::vector<double> c(dim);
+      block_min[b].assign(dim, (std::numeric_limits<double>::max)());
+      block_max[b].assign(dim, std::numeric_limits<double>::lowest());
+      for(std::size_t i = first; i < last; ++i)
+      {
+        coordinates(begin[i], c.data());
+        for(int j = 0; j < dim; ++j)
+        {
+          block_min[b][j] = (std::min)(block_min[b][j], c[j]);
+          block_max[b][j] = (std::max)(block_max[b][j], c[j]);
+        }
+      }
+    });
+
+  std::vector<double> mini(block_min[0]), maxi(block_max[0]);
+  for(std::size_t b = 1; b < nb_blocks; ++b)
+  {
+    for(int j = 0; j < dim; ++j)
+    {
+      mini[j] = (std::min)(mini[j], block_min[b][j]);
+      maxi[j] = (std::max)(maxi[j], block_max[b][j]);
+    }
+  }
+
+  // the cells of the grid have 2^bits cells per axis, and the keys fit in 64 bits
+  const int bits = (std::min)(32, 64 / dim);
+  const double nb_cells = double((std::uint64_t(1) << bits) - 1);
+  std::vector<double> scale(dim);
+  for(int j = 0; j < dim; ++j)
+    scale[j] = (maxi[j] > mini[j]) ? nb_cells / (maxi[j] - mini[j]) : 0.;
+
+  // the keys
+  const Hilbert_key_table<2>* table_2 = (dim == 2) ? &Hilbert_key_table<2>::instance() : nullptr;
+  const Hilbert_key_table<3>* table_3 = (dim == 3) ? &Hilbert_key_table<3>::instance() : nullptr;
+  std::vector<Hilbert_key_and_index> keys(n);
+  for_each_block<ConcurrencyTag>(n, block_size,
+    [&](std::size_t, std::size_t first, std::size_t last)
+    {
+      std::vector<double> c(dim);
+      std::vector<std::uint32_t> x(dim);
+      for(std::size_t i = first; i < last; ++i)
+      {
+        coordinates(begin[i], c.data());
+        for(int j = 0; j < dim; ++j)
+        {
+          const double v = (c[j] - mini[j]) * scale[j];
+          x[j] = (v <= 0.) ? 0 : (v >= nb_cells) ? std::uint32_t(nb_cells) : std::uint32_t(v);
+        }
+        keys[i].key = table_2 ? table_2->key(x.data(), bits)
+                    : table_3 ? table_3->key(x.data(), bits)
+                    : hilbert_key(x.data(), dim, bits);
+        keys[i].index = i;
+      }
+    });
+
+  radix_sort_hilbert_keys<ConcurrencyTag>(keys);
+
+  // the permutation of the range
+  std::vector<value_type> sorted;
+  sorted.reserve(n);
+  for(const Hilbert_key_and_index& k : keys)
+    sorted.push_back(std::move(begin[k.index]));
+  std::move(sorted.begin(), sorted.end(), begin);
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_HILBERT_SORT_KEY_BASE_H
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_HILBERT_SORT_KEY_d_H
+#define CGAL_HILBERT_SORT_KEY_d_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/Hilbert_sort_key_base.h>
+#include <CGAL/Hilbert_sort_median_d.h>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace CGAL {
+
+template <class K, class ConcurrencyTag = Sequential_tag>
+class Hilbert_sort_key_d
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+public:
+  typedef K Kernel;
+  typedef typename Kernel::Point_d Point;
+
+  // Beyond this dimension, the keys have less than 4 bits per axis
+  // and the points are sorted with `Hilbert_sort_median_d`.
+  static constexpr int maximal_dimension = 16;
+
+private:
+  Kernel _k;
+  std::ptrdiff_t _limit;
+
+public:
+  Hilbert_sort_key_d (const Kernel &k = Kernel(), std::ptrdiff_t limit = 1)
+    : _k(k), _limit (limit)
+  {}
+
+  template <class RandomAccessIterator>
+  void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+    if (end - begin <= _limit) return;
+
+    const int dimension = _k.point_dimension_d_object()(*begin);
+    if (dimension > maximal_dimension)
+    {
+      (Hilbert_sort_median_d<Kernel> (_k, _limit))(begin, end);
+      return;
+    }
+
+    const Kernel& k = _k;
+    internal::hilbert_sort_by_keys<ConcurrencyTag>(begin, end, dimension,
+      [&k, dimension](const Point& p, double* c)
+      {
+        for (int i = 0; i < dimension; ++i)
+          c[i] = to_double(k.compute_coordinate_d_object()(p, i));
+      });
+  }
+};
+
+} // namespace CGAL
+
+#endif//CGAL_HILBERT_SORT_KEY_d_H
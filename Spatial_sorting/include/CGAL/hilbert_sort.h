@@ -72,7 +72,7 @@ void hilbert_sort (RandomAccessIterator begin,
   boost::rand48 random;
   boost::random_number_generator<boost::rand48, Diff_t> rng(random);
   CGAL::cpp98::random_shuffle(begin,end, rng);
-  (Hilbert_sort_d<Kernel, Policy> (k))(begin, end);
+  (Hilbert_sort_d<Kernel, Policy, ConcurrencyTag> (k))(begin, end);
 }
 
 } // namespace internal
@@ -128,6 +128,19 @@ void hilbert_sort (RandomAccessIterator begin, RandomAccessIterator end,
                                          static_cast<value_type *> (0));
 }
 
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+void hilbert_sort (RandomAccessIterator begin, RandomAccessIterator end,
+                   Hilbert_sort_key_policy policy)
+{
+  typedef std::iterator_traits<RandomAccessIterator> ITraits;
+  typedef typename ITraits::value_type               value_type;
+  typedef CGAL::Kernel_traits<value_type>            KTraits;
+  typedef typename KTraits::Kernel                   Kernel;
+
+  internal::hilbert_sort<ConcurrencyTag>(begin, end, Kernel(), policy,
+                                         static_cast<value_type *> (0));
+}
+
 template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel, class Policy>
 void hilbert_sort (RandomAccessIterator begin, RandomAccessIterator end,
                    const Kernel &k, Policy policy)
@@ -0,0 +1,173 @@
+#include <cassert>
+
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/spatial_sort.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Cartesian_d.h>
+
+#include <CGAL/Random.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/point_generators_d.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point_2;
+typedef K::Point_3                                          Point_3;
+
+typedef CGAL::Cartesian_d<double>                           Kd;
+typedef Kd::Point_d                                         Point_d;
+typedef CGAL::Creator_uniform_d<std::vector<double>::iterator, Point_d> Creator_d;
+
+struct Less_d
+{
+  bool operator()(const Point_d& p, const Point_d& q) const
+  {
+    return std::lexicographical_compare(p.cartesian_begin(), p.cartesian_end(),
+                                        q.cartesian_begin(), q.cartesian_end());
+  }
+};
+
+template <class Point, class Less>
+bool is_permutation(std::vector<Point> v, std::vector<Point> w, Less less)
+{
+  std::sort(v.begin(), v.end(), less);
+  std::sort(w.begin(), w.end(), less);
+  return v == w;
+}
+
+double squared_distance_d(const Point_d& p, const Point_d& q)
+{
+  double d = 0;
+  for(int i = 0; i < p.dimension(); ++i)
+    d += CGAL::square(p.cartesian(i) - q.cartesian(i));
+  return d;
+}
+
+// Along a Hilbert curve, consecutive points of a regular grid of 2^x points per axis are neighbors.
+void test_grids()
+{
+  CGAL::Random random(42);
+
+  {
+    std::cout << "Testing 2D grid... " << std::flush;
+    std::vector<Point_2> v;
+    for(int i = 0; i < 128; ++i)
+      for(int j = 0; j < 128; ++j)
+        v.push_back(Point_2(i, j));
+    CGAL::cpp98::random_shuffle(v.begin(), v.end(), random);
+
+    CGAL::hilbert_sort(v.begin(), v.end(), CGAL::Hilbert_sort_key_policy());
+    for(std::size_t i = 1; i < v.size(); ++i)
+      assert(CGAL::squared_distance(v[i-1], v[i]) == 1);
+    std::cout << "Ok" << std::endl;
+  }
+
+  {
+    std::cout << "Testing 3D grid... " << std::flush;
+    std::vector<Point_3> v;
+    for(int i = 0; i < 32; ++i)
+      for(int j = 0; j < 32; ++j)
+        for(int k = 0; k < 32; ++k)
+          v.push_back(Point_3(i, j, k));
+    CGAL::cpp98::random_shuffle(v.begin(), v.end(), random);
+
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v.begin(), v.end(), CGAL::Hilbert_sort_key_policy());
+    for(std::size_t i = 1; i < v.size(); ++i)
+      assert(CGAL::squared_distance(v[i-1], v[i]) == 1);
+    std::cout << "Ok" << std::endl;
+  }
+
+  {
+    std::cout << "Testing 4D grid... " << std::flush;
+    std::vector<Point_d> v;
+    for(int i = 0; i < 4096; ++i)
+    {
+      double c[4] = { double(i % 8), double((i / 8) % 8), double((i / 64) % 8), double(i / 512) };
+      v.push_back(Point_d(4, c, c + 4));
+    }
+    CGAL::cpp98::random_shuffle(v.begin(), v.end(), random);
+
+    CGAL::hilbert_sort(v.begin(), v.end(), Kd(), CGAL::Hilbert_sort_key_policy());
+    for(std::size_t i = 1; i < v.size(); ++i)
+      assert(squared_distance_d(v[i-1], v[i]) == 1);
+    std::cout << "Ok" << std::endl;
+  }
+}
+
+// The key sort does not depend on the number of threads.
+void test_random_points()
+{
+  CGAL::Random random(42);
+
+  {
+    std::cout << "Testing 2D random points... " << std::flush;
+    std::vector<Point_2> v;
+    CGAL::Random_points_in_square_2<Point_2> gen(1.0, random);
+    std::copy_n(gen, 99999, std::back_inserter(v));
+    v.push_back(v[0]); // insert twice the same point
+
+    std::vector<Point_2> v1(v), v2(v);
+    CGAL::hilbert_sort(v1.begin(), v1.end(), CGAL::Hilbert_sort_key_policy());
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v2.begin(), v2.end(), CGAL::Hilbert_sort_key_policy());
+    assert(v1 == v2);
+    assert(is_permutation(v, v1, K::Less_xy_2()));
+    std::cout << "Ok" << std::endl;
+  }
+
+  {
+    std::cout << "Testing 3D spatial sort... " << std::flush;
+    std::vector<Point_3> v;
+    CGAL::Random_points_in_cube_3<Point_3> gen(1.0, random);
+    std::copy_n(gen, 100000, std::back_inserter(v));
+
+    std::vector<Point_3> v1(v), v2(v);
+    CGAL::spatial_sort(v1.begin(), v1.end(), CGAL::Hilbert_sort_key_policy());
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag>(v2.begin(), v2.end(), CGAL::Hilbert_sort_key_policy());
+    assert(v1 == v2);
+    assert(is_permutation(v, v1, K::Less_xyz_3()));
+    std::cout << "Ok" << std::endl;
+  }
+
+  for(int dim : { 5, 20 })
+  {
+    // in dimension 20, the points are sorted with the median policy
+    std::cout << "Testing " << dim << "D spatial sort... " << std::flush;
+    std::vector<Point_d> v;
+    CGAL::Random_points_in_cube_d<Point_d> gen(dim, 1.0, random);
+    std::copy_n(gen, 10000, std::back_inserter(v));
+
+    std::vector<Point_d> v1(v), v2(v);
+    CGAL::spatial_sort(v1.begin(), v1.end(), Kd(), CGAL::Hilbert_sort_key_policy());
+    CGAL::spatial_sort<CGAL::Parallel_if_available_tag>(v2.begin(), v2.end(), Kd(), CGAL::Hilbert_sort_key_policy());
+    assert(v1 == v2);
+    assert(is_permutation(v, v1, Less_d()));
+    std::cout << "Ok" << std::endl;
+  }
+}
+
+int main()
+{
+  std::cout << "Testing Hilbert sort with keys." << std::endl;
+
+  test_grids();
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // run the parallel loops on several threads, whatever the number of cores
+  tbb::task_arena arena(4);
+  arena.execute([]{ test_random_points(); });
+#else
+  test_random_points();
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
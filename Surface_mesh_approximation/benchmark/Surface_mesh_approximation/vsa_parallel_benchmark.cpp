@@ -0,0 +1,72 @@
+// Times the seeding and the iterations of the sequential and the parallel
+// versions of `Variational_shape_approximation`, and compares their errors.
+//
+// Usage: vsa_parallel_benchmark [input mesh] [number of proxies] [number of iterations]
+
+#include <iostream>
+#include <fstream>
+#include <string>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Variational_shape_approximation.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef CGAL::Surface_mesh<Kernel::Point_3> Mesh;
+typedef boost::property_map<Mesh, boost::vertex_point_t>::type Vertex_point_map;
+
+template <class ConcurrencyTag>
+double bench(const std::string &name, const Mesh &mesh,
+  const std::size_t nb_proxies, const std::size_t nb_iterations)
+{
+  typedef CGAL::Variational_shape_approximation<Mesh, Vertex_point_map,
+    CGAL::Default, CGAL::Default, ConcurrencyTag> L21_approx;
+  typedef typename L21_approx::Error_metric L21_metric;
+
+  Vertex_point_map vpmap = get(boost::vertex_point, const_cast<Mesh &>(mesh));
+  L21_metric error_metric(mesh, vpmap);
+  L21_approx approx(mesh, vpmap, error_metric);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  approx.initialize_seeds(
+    CGAL::parameters::seeding_method(CGAL::Surface_mesh_approximation::HIERARCHICAL)
+    .max_number_of_proxies(nb_proxies));
+  const double seeding = timer.time();
+  approx.run(nb_iterations);
+  timer.stop();
+
+  const double error = CGAL::to_double(approx.compute_total_error());
+  std::cout << name << " seeding: " << seeding << " sec., "
+            << "iterations: " << timer.time() - seeding << " sec., "
+            << "total: " << timer.time() << " sec. (error " << error << ")" << std::endl;
+  return error;
+}
+
+int main(int argc, char *argv[])
+{
+  Mesh mesh;
+  std::ifstream input((argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off"));
+  if (!input || !(input >> mesh) || !CGAL::is_triangle_mesh(mesh)) {
+    std::cerr << "Invalid input file." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::size_t nb_proxies = (argc > 2) ? std::atoi(argv[2]) : 200;
+  const std::size_t nb_iterations = (argc > 3) ? std::atoi(argv[3]) : 20;
+  std::cout << num_faces(mesh) << " faces, " << nb_proxies << " proxies, "
+            << nb_iterations << " iterations" << std::endl;
+
+  const double seq = bench<CGAL::Sequential_tag>("sequential", mesh, nb_proxies, nb_iterations);
+#ifdef CGAL_LINKED_WITH_TBB
+  // the parallel partition integrates the faces by rounds, the errors are close but not identical
+  const double par = bench<CGAL::Parallel_tag>("parallel  ", mesh, nb_proxies, nb_iterations);
+  std::cout << "error ratio: " << par / seq << std::endl;
+#else
+  CGAL_USE(seq);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -42,11 +42,15 @@
 #include <stack>
 #include <queue>
 #include <iterator>
+#include <algorithm>
+#include <array>
+#include <type_traits>
 #include <cmath>
 #include <cstdlib>
 
 #ifdef CGAL_LINKED_WITH_TBB
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 #include <tbb/blocked_range.h>
 #endif // CGAL_LINKED_WITH_TBB
 
@@ -79,13 +83,25 @@ enum Seeding_method {
 /// @tparam VertexPointMap a `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor` as key and `GeomTraits::Point_3` as value type
 /// @tparam ErrorMetricProxy a model of `ErrorMetricProxy`
 /// @tparam GeomTraits a model of Kernel
-/// @tparam Concurrency_tag concurrency tag.
+/// @tparam Concurrency_tag enables sequential versus parallel approximation.
+/// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+/// With `Parallel_tag`, the proxies are fitted in parallel, and the partition floods the mesh
+/// by rounds: the best candidate faces of the front are integrated together,
+/// each face to the proxy with the smallest fitting error, and the fitting errors of the
+/// new candidate faces are computed in parallel. The simulated merges of `find_best_merge()` are also
+/// performed in parallel. The parallel partition does not depend on the number of threads,
+/// but it may differ from the sequential one, which integrates the faces one by one.
 template <typename TriangleMesh,
   typename VertexPointMap,
   typename ErrorMetricProxy = CGAL::Default,
   typename GeomTraits = CGAL::Default,
   typename Concurrency_tag = CGAL::Sequential_tag>
 class Variational_shape_approximation {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 // public typedefs
 public:
 
@@ -188,6 +204,26 @@ private:
     FT err; // fitting error
   };
 
+  // The face candidate of the parallel partition, with the index of the face.
+  struct Indexed_face_to_integrate {
+    Indexed_face_to_integrate() {}
+    Indexed_face_to_integrate(const std::size_t f_, const std::size_t &px_, const FT &err_)
+      : f(f_), px(px_), err(err_) {}
+
+    // in ascending order of error, ties are broken by indices for determinism
+    bool operator<(const Indexed_face_to_integrate &rhs) const {
+      if (err != rhs.err)
+        return err < rhs.err;
+      if (px != rhs.px)
+        return px < rhs.px;
+      return f < rhs.f;
+    }
+
+    std::size_t f; // face index
+    std::size_t px; // proxy index
+    FT err; // fitting error
+  };
+
   // Proxy error with its index.
   struct Proxy_error {
     Proxy_error(const std::size_t &px_, const FT &err_)
@@ -258,6 +294,15 @@ private:
   // The attached anchor index of a vertex.
   Vertex_anchor_map m_vanchor_map;
 
+  // The indexed faces, their indices and their adjacent faces, used by the parallel partition.
+  // The face index map is only created by `index_faces()`.
+  std::vector<face_descriptor> m_faces;
+  Face_proxy_map m_findex_map;
+  std::vector<std::array<std::size_t, 3> > m_face_neighbors;
+
+  // The parallel partition integrates at least this number of candidate faces per round.
+  static constexpr std::size_t parallel_partition_min_batch_size = 64;
+
 //member functions
 public:
   /// \name Construction
@@ -380,7 +425,7 @@ public:
       for(face_descriptor f : faces(*m_ptm))
         put(m_fproxy_map, f, CGAL_VSA_INVALID_TAG);
 
-      partition(m_proxies.begin(), m_proxies.end());
+      partition(m_proxies.begin(), m_proxies.end(), Concurrency_tag());
       fit(m_proxies.begin(), m_proxies.end(), Concurrency_tag());
     }
 
@@ -677,6 +722,47 @@ public:
     Pair_set merged_set;
     FT min_error_change = FT(0.0);
     bool first_merge = true;
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value) {
+      // collect the pairs of adjacent proxies in the order of the sequential traversal
+      std::vector<Proxy_pair> pairs;
+      for(edge_descriptor e : edges(*m_ptm)) {
+        if (CGAL::is_border(e, *m_ptm))
+          continue;
+        std::size_t pxi = get(m_fproxy_map, face(halfedge(e, *m_ptm), *m_ptm));
+        std::size_t pxj = get(m_fproxy_map, face(opposite(halfedge(e, *m_ptm), *m_ptm), *m_ptm));
+        if (pxi == pxj)
+          continue;
+        if (pxi > pxj)
+          std::swap(pxi, pxj);
+        if (merged_set.insert(Proxy_pair(pxi, pxj)).second)
+          pairs.push_back(Proxy_pair(pxi, pxj));
+      }
+
+      // simulated merges
+      std::vector<FT> error_changes(pairs.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, pairs.size()),
+        [&](const tbb::blocked_range<std::size_t> &r) {
+          for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            const std::size_t pxi = pairs[i].first, pxj = pairs[i].second;
+            std::vector<face_descriptor> merged_patch(px_faces[pxi].begin(), px_faces[pxi].end());
+            merged_patch.insert(merged_patch.end(), px_faces[pxj].begin(), px_faces[pxj].end());
+            const Proxy_wrapper pxw_tmp = fit_proxy_from_patch(merged_patch, CGAL_VSA_INVALID_TAG);
+            error_changes[i] = pxw_tmp.err - (m_proxies[pxi].err + m_proxies[pxj].err);
+          }
+        });
+
+      for (std::size_t i = 0; i < pairs.size(); ++i) {
+        if (first_merge || error_changes[i] < min_error_change) {
+          first_merge = false;
+          min_error_change = error_changes[i];
+          px0 = pairs[i].first;
+          px1 = pairs[i].second;
+        }
+      }
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
     for(edge_descriptor e : edges(*m_ptm)) {
       if (CGAL::is_border(e, *m_ptm))
         continue;
@@ -768,7 +854,7 @@ public:
       for(face_descriptor f : confined_area)
         put(m_fproxy_map, f, CGAL_VSA_INVALID_TAG);
 
-      partition(confined_proxies.begin(), confined_proxies.end());
+      partition(confined_proxies.begin(), confined_proxies.end(), Concurrency_tag());
       fit(confined_proxies.begin(), confined_proxies.end(), Concurrency_tag());
     }
 
@@ -1179,13 +1265,15 @@ private:
 
   /*!
    * @brief partitions the area tagged with CGAL_VSA_INVALID_TAG with proxies, global face proxy map is updated.
-   * Propagates the proxy seed faces and floods the tagged area to minimize the fitting error.
+   * Propagates the proxy seed faces and floods the tagged area to minimize the fitting error, sequential.
    * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
    * @param beg iterator point to the first element
    * @param end iterator point to the one past the last element
+   * @param t concurrency tag
    */
   template<typename ProxyWrapperIterator>
-  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end) {
+  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Sequential_tag & t) {
+    CGAL_USE(t);
     std::priority_queue<Face_to_integrate> face_pqueue;
     for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr) {
       face_descriptor f = pxw_itr->seed;
@@ -1216,6 +1304,126 @@ private:
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  /*!
+   * @brief partitions the area tagged with CGAL_VSA_INVALID_TAG with proxies, global face proxy map is updated, parallel.
+   * Propagates the proxy seed faces and floods the tagged area by rounds.
+   * At each round, the best candidates of the front are integrated together,
+   * each face to the proxy with the smallest fitting error among its candidates,
+   * and the fitting errors of the new candidates are computed in parallel.
+   * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
+   * @param beg iterator point to the first element
+   * @param end iterator point to the one past the last element
+   * @param t concurrency tag
+   */
+  template<typename ProxyWrapperIterator>
+  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Parallel_tag & t) {
+    CGAL_USE(t);
+    if (m_faces.empty())
+      index_faces();
+
+    const std::size_t nb_faces = m_faces.size();
+    std::vector<std::size_t> fproxy(nb_faces);
+    for (std::size_t i = 0; i < nb_faces; ++i)
+      fproxy[i] = get(m_fproxy_map, m_faces[i]);
+    const std::vector<std::size_t> initial_fproxy(fproxy);
+
+    // the front of the faces adjacent to the integrated ones, with their fitting errors
+    // to either the seed proxies or the global proxies like the sequential version
+    std::vector<Indexed_face_to_integrate> front;
+    std::vector<Indexed_face_to_integrate> round;
+    std::vector<std::size_t> integrated;
+    std::vector<Indexed_face_to_integrate> candidates;
+    auto add_candidates = [&](const std::vector<Proxy> &pxs) {
+      candidates.assign(3 * integrated.size(), Indexed_face_to_integrate(CGAL_VSA_INVALID_TAG, 0, FT(0.0)));
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, integrated.size()),
+        [&](const tbb::blocked_range<std::size_t> &r) {
+          for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            const std::size_t f = integrated[i];
+            const std::size_t px = fproxy[f];
+            for (std::size_t j = 0; j < 3; ++j) {
+              const std::size_t fadj = m_face_neighbors[f][j];
+              if (fadj != CGAL_VSA_INVALID_TAG && fproxy[fadj] == CGAL_VSA_INVALID_TAG)
+                candidates[3 * i + j] = Indexed_face_to_integrate(
+                  fadj, px, m_metric->compute_error(m_faces[fadj], *m_ptm, pxs[i]));
+            }
+          }
+        });
+      for (const Indexed_face_to_integrate &c : candidates)
+        if (c.f != CGAL_VSA_INVALID_TAG)
+          front.push_back(c);
+    };
+
+    // seeds
+    std::vector<Proxy> seed_pxs;
+    for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr) {
+      const std::size_t f = get(m_findex_map, pxw_itr->seed);
+      fproxy[f] = pxw_itr->idx;
+      integrated.push_back(f);
+      seed_pxs.push_back(pxw_itr->px);
+    }
+    add_candidates(seed_pxs);
+
+    // about one candidate face per proxy and per round,
+    // larger rounds integrate faces too early and degrade the partition
+    const std::size_t nb_candidates = (std::max)(parallel_partition_min_batch_size, seed_pxs.size());
+    std::vector<Proxy> pxs;
+    while (!front.empty()) {
+      // extract the best candidates of the front
+      if (nb_candidates < front.size()) {
+        std::nth_element(front.begin(), front.begin() + nb_candidates, front.end());
+        round.assign(front.begin(), front.begin() + nb_candidates);
+        front.erase(front.begin(), front.begin() + nb_candidates);
+      }
+      else {
+        round.swap(front);
+        front.clear();
+      }
+
+      // integrate each face to its best candidate proxy
+      tbb::parallel_sort(round.begin(), round.end(),
+        [](const Indexed_face_to_integrate &a, const Indexed_face_to_integrate &b) {
+          return a.f < b.f || (a.f == b.f && a < b);
+        });
+      integrated.clear();
+      pxs.clear();
+      for (std::size_t i = 0; i < round.size(); ++i) {
+        const Indexed_face_to_integrate &c = round[i];
+        if (fproxy[c.f] == CGAL_VSA_INVALID_TAG) {
+          fproxy[c.f] = c.px;
+          integrated.push_back(c.f);
+          pxs.push_back(m_proxies[c.px].px);
+        }
+      }
+      add_candidates(pxs);
+    }
+
+    for (std::size_t i = 0; i < nb_faces; ++i)
+      if (fproxy[i] != initial_fproxy[i])
+        put(m_fproxy_map, m_faces[i], fproxy[i]);
+  }
+
+  /*!
+   * @brief indexes the faces and their adjacent faces, used by the parallel partition.
+   */
+  void index_faces() {
+    m_findex_map = get(Face_proxy_tag(), *(const_cast<TriangleMesh *>(m_ptm)));
+    m_faces.assign(faces(*m_ptm).first, faces(*m_ptm).second);
+    for (std::size_t i = 0; i < m_faces.size(); ++i)
+      put(m_findex_map, m_faces[i], i);
+
+    m_face_neighbors.resize(m_faces.size());
+    for (std::size_t i = 0; i < m_faces.size(); ++i) {
+      std::size_t j = 0;
+      for(face_descriptor fadj : faces_around_face(halfedge(m_faces[i], *m_ptm), *m_ptm)) {
+        CGAL_assertion(j < 3);
+        m_face_neighbors[i][j++] = (fadj == boost::graph_traits<TriangleMesh>::null_face()) ?
+          CGAL_VSA_INVALID_TAG : get(m_findex_map, fadj);
+      }
+    }
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
   /*!
    * @brief refits and updates input range of proxies, sequential.
    * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
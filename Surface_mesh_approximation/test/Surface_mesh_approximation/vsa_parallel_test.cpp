@@ -0,0 +1,107 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <optional>
+#include <utility>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Variational_shape_approximation.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+
+typedef CGAL::Surface_mesh<Kernel::Point_3> Mesh;
+typedef boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+typedef boost::property_map<Mesh, boost::vertex_point_t>::type Vertex_point_map;
+typedef Mesh::Property_map<face_descriptor, std::size_t> Face_proxy_map;
+
+typedef CGAL::Variational_shape_approximation<Mesh, Vertex_point_map> L21_approx;
+typedef CGAL::Variational_shape_approximation<Mesh, Vertex_point_map,
+  CGAL::Default, CGAL::Default, CGAL::Parallel_if_available_tag> Parallel_L21_approx;
+typedef L21_approx::Error_metric L21_metric;
+
+/**
+ * Approximates the mesh with the hierarchical seeding, relaxes, merges, splits and teleports,
+ * returns the total error and fills the face proxy map.
+ */
+template <typename Approx>
+FT approximate(const Mesh &mesh, Face_proxy_map fpxmap)
+{
+  Vertex_point_map vpmap = get(boost::vertex_point, const_cast<Mesh &>(mesh));
+  L21_metric error_metric(mesh, vpmap);
+  Approx approx(mesh, vpmap, error_metric);
+
+  approx.initialize_seeds(CGAL::parameters::seeding_method(CGAL::Surface_mesh_approximation::HIERARCHICAL)
+    .max_number_of_proxies(60));
+  approx.run(10);
+  const std::optional<std::pair<std::size_t, std::size_t> > best_merge = approx.find_best_merge(false);
+  if (best_merge)
+    approx.merge(best_merge->first, best_merge->second);
+  approx.split(2, 3, 5);
+  approx.teleport_proxies(2, 5);
+  approx.run(10);
+  if (approx.number_of_proxies() != 61)
+    std::cerr << "Unexpected number of proxies: " << approx.number_of_proxies() << std::endl;
+
+  approx.proxy_map(fpxmap);
+  return approx.compute_total_error();
+}
+
+bool same_partitions(const Mesh &mesh, Face_proxy_map fpxmap0, Face_proxy_map fpxmap1)
+{
+  for (face_descriptor f : faces(mesh)) {
+    if (get(fpxmap0, f) != get(fpxmap1, f)) {
+      std::cerr << "The partitions are different." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * This file tests that the parallel approximation does not depend on the number of threads,
+ * and that its error is close to the error of the sequential approximation.
+ */
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/elephant.off"));
+  if (!input || !(input >> mesh) || !CGAL::is_triangle_mesh(mesh)) {
+    std::cerr << "Invalid input file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Face_proxy_map seq_fpxmap = mesh.add_property_map<face_descriptor, std::size_t>("f:seq_proxy_id", 0).first;
+  const FT seq_error = approximate<L21_approx>(mesh, seq_fpxmap);
+  std::cout << "Sequential error: " << seq_error << std::endl;
+
+  Face_proxy_map fpxmap = mesh.add_property_map<face_descriptor, std::size_t>("f:proxy_id", 0).first;
+  const FT error = approximate<Parallel_L21_approx>(mesh, fpxmap);
+  std::cout << "Parallel error: " << error << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // run the parallel loops on several threads, whatever the number of cores
+  Face_proxy_map fpxmap4 = mesh.add_property_map<face_descriptor, std::size_t>("f:proxy_id4", 0).first;
+  tbb::task_arena arena(4);
+  FT error4 = FT(0.0);
+  arena.execute([&]{ error4 = approximate<Parallel_L21_approx>(mesh, fpxmap4); });
+  if (error4 != error || !same_partitions(mesh, fpxmap, fpxmap4))
+    return EXIT_FAILURE;
+#endif
+
+  // the parallel partition integrates the faces by rounds, not one by one
+  if (error > seq_error * FT(1.1)) {
+    std::cerr << "The parallel error is too large." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
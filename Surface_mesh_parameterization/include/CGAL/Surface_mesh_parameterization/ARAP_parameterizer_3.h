@@ -19,6 +19,7 @@
 #include <CGAL/Surface_mesh_parameterization/internal/Bool_property_map.h>
 #include <CGAL/Surface_mesh_parameterization/internal/Containers_filler.h>
 #include <CGAL/Surface_mesh_parameterization/internal/kernel_traits.h>
+#include <CGAL/Surface_mesh_parameterization/internal/linear_solver.h>
 #include <CGAL/Surface_mesh_parameterization/internal/validity.h>
 #include <CGAL/Surface_mesh_parameterization/IO/File_off.h>
 
@@ -43,6 +44,7 @@
 #include <CGAL/circulator.h>
 #include <CGAL/Default.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
 
 // Below are two macros that can be used to improve the accuracy of optimal Lt
 // matrices.
@@ -84,6 +86,12 @@
 #include <boost/iterator/function_output_iterator.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <array>
 #include <unordered_set>
 #include <iostream>
 #include <fstream>
@@ -99,7 +107,6 @@
 // @todo Handle the case cot = 0 with a local parameterization aligned with the axes
 //       (this produces C2=0 which is problematic to compute a & b)
 // @todo Add distortion measures
-// @todo Parallelize the local phase?
 
 namespace CGAL {
 
@@ -161,14 +168,28 @@ namespace Surface_mesh_parameterization {
 ///           Eigen::UmfPackLU<Eigen_sparse_matrix<double>::EigenType> >
 /// \endcode
 ///
+///         If `SolverTraits_` is a model of `SparseLinearAlgebraWithFactorTraits_d`, which is the case
+///         of the default, the constant matrix of the global step is factorized only once.
+///
+/// \tparam ConcurrencyTag_ enables sequential versus parallel local steps (computation of
+///         the optimal transformation of each triangle) and energy computations.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.<br>
+///         <b>%Default:</b> `Sequential_tag`
+///
 /// \sa `CGAL::Surface_mesh_parameterization::Fixed_border_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 /// \sa `CGAL::Surface_mesh_parameterization::Iterative_authalic_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 ///
 template < class TriangleMesh_,
            class BorderParameterizer_ = Default,
-           class SolverTraits_ = Default>
+           class SolverTraits_ = Default,
+           class ConcurrencyTag_ = Sequential_tag>
 class ARAP_parameterizer_3
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag_, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 public:
 #ifndef DOXYGEN_RUNNING
   typedef typename Default::Get<
@@ -259,6 +280,22 @@ private:
   typedef boost::associative_property_map<Lp_hm>                    Lp_map;
   typedef std::vector<Point_2>                                      Local_points;
 
+    // Terms of the energy of a face that are constant during the minimization:
+    // for each halfedge of the face, the cotangent weight, the edge vector in the
+    // local isometric parameterization, and the indices of the edge extremities.
+  struct Face_terms
+  {
+    std::array<NT, 3> cot;
+    std::array<NT, 3> p_diff_x, p_diff_y;
+    std::array<int, 3> source_index, target_index;
+  };
+  typedef std::vector<Face_terms>                                   Face_terms_vector;
+  typedef std::vector<Lt_matrix>                                    Lt_vector;
+
+  // Number of faces whose energy is summed by a single task, so that the sum
+  // does not depend on the number of threads
+  static const std::size_t energy_block_size = 4096;
+
 // Private fields
 private:
   // %Object that maps (at least two) border vertices onto a 2D space
@@ -705,13 +742,8 @@ private:
 #endif // !defined(CGAL_SMP_SOLVE_CUBIC_EQUATION) && defined(CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP)
 
   // Compute the root that gives the lowest face energy.
-  template <typename VertexUVMap>
-  std::size_t compute_root_with_lowest_energy(const Triangle_mesh& mesh,
-                                              face_descriptor fd,
-                                              const Cot_map ctmap,
-                                              const Local_points& lp,
-                                              const Lp_map lpmap,
-                                              const VertexUVMap uvmap,
+  std::size_t compute_root_with_lowest_energy(const Face_terms& ft,
+                                              const std::vector<Point_2>& uvs,
                                               const NT C2_denom, const NT C3,
                                               const std::vector<NT>& roots) const
   {
@@ -722,7 +754,7 @@ private:
     {
       const NT a = roots[i];
       const NT b = C3 * C2_denom * a;
-      NT Ef = compute_current_face_energy(mesh, fd, ctmap, lp, lpmap, uvmap, a, b);
+      NT Ef = compute_current_face_energy(ft, uvs, a, b);
       if(Ef < E_min) {
         E_min = Ef;
         index_arg = i;
@@ -732,13 +764,8 @@ private:
   }
 
   // Compute the root that gives the lowest face energy.
-  template <typename VertexUVMap>
-  std::size_t compute_root_with_lowest_energy(const Triangle_mesh& mesh,
-                                              face_descriptor fd,
-                                              const Cot_map ctmap,
-                                              const Local_points& lp,
-                                              const Lp_map lpmap,
-                                              const VertexUVMap uvmap,
+  std::size_t compute_root_with_lowest_energy(const Face_terms& ft,
+                                              const std::vector<Point_2>& uvs,
                                               const std::vector<NT>& a_roots,
                                               const std::vector<NT>& b_roots) const
   {
@@ -747,8 +774,7 @@ private:
     std::size_t index_arg = -1;
     for(std::size_t i=0; i<a_roots.size(); ++i)
     {
-      NT Ef = compute_current_face_energy(mesh, fd, ctmap, lp, lpmap, uvmap,
-                                          a_roots[i], b_roots[i]);
+      NT Ef = compute_current_face_energy(ft, uvs, a_roots[i], b_roots[i]);
       if(Ef < E_min) {
         E_min = Ef;
         index_arg = i;
@@ -757,101 +783,110 @@ private:
     return index_arg;
   }
 
-  // Compute the optimal values of the linear transformation matrices Lt.
-  template <typename VertexUVMap>
-  Error_code compute_optimal_Lt_matrices(const Triangle_mesh& mesh,
-                                         const Faces_vector& faces,
-                                         const Cot_map ctmap,
-                                         const Local_points& lp,
-                                         const Lp_map lpmap,
-                                         const VertexUVMap uvmap,
-                                         Lt_map ltmap) const
+  // Compute the optimal values of the linear transformation matrix Lt of a face.
+  Lt_matrix compute_optimal_Lt_matrix(const Face_terms& ft,
+                                      const std::vector<Point_2>& uvs) const
   {
-    Error_code status = OK;
-
-    for(face_descriptor fd : faces) {
-      // Compute the coefficients C1, C2, C3
-      NT C1 = 0., C2 = 0., C3 = 0.;
-
-      halfedge_around_face_circulator hc(halfedge(fd, mesh), mesh), end(hc);
-      CGAL_For_all(hc, end) {
-        halfedge_descriptor hd = *hc;
-        NT c = get(ctmap, hd);
-
-        // UV positions
-        const Point_2& uvpi = get(uvmap, source(hd, mesh));
-        const Point_2& uvpj = get(uvmap, target(hd, mesh));
-        NT diff_x = uvpi.x() - uvpj.x();
-        NT diff_y = uvpi.y() - uvpj.y();
-//        CGAL_warning(diff_x == 0. && diff_y == 0.);
+    // Compute the coefficients C1, C2, C3
+    NT C1 = 0., C2 = 0., C3 = 0.;
 
-        // local positions (in the isometric 2D param)
-        const Local_indices& li = get(lpmap, hd);
-        const Point_2& ppi = lp[ li.first ];
-        const Point_2& ppj = lp[ li.second ];
-        NT p_diff_x = ppi.x() - ppj.x();
-        NT p_diff_y = ppi.y() - ppj.y();
-        CGAL_precondition(p_diff_x != 0. || p_diff_y != 0.);
+    for(int k=0; k<3; ++k) {
+      NT c = ft.cot[k];
 
-        C1 += c * ( p_diff_x*p_diff_x + p_diff_y*p_diff_y );
-        C2 += c * ( diff_x*p_diff_x + diff_y*p_diff_y );
-        C3 += c * ( diff_x*p_diff_y - diff_y*p_diff_x );
-      }
+      // UV positions
+      const Point_2& uvpi = uvs[ft.source_index[k]];
+      const Point_2& uvpj = uvs[ft.target_index[k]];
+      NT diff_x = uvpi.x() - uvpj.x();
+      NT diff_y = uvpi.y() - uvpj.y();
+//      CGAL_warning(diff_x == 0. && diff_y == 0.);
+
+      // local positions (in the isometric 2D param)
+      NT p_diff_x = ft.p_diff_x[k];
+      NT p_diff_y = ft.p_diff_y[k];
+      CGAL_precondition(p_diff_x != 0. || p_diff_y != 0.);
+
+      C1 += c * ( p_diff_x*p_diff_x + p_diff_y*p_diff_y );
+      C2 += c * ( diff_x*p_diff_x + diff_y*p_diff_y );
+      C3 += c * ( diff_x*p_diff_y - diff_y*p_diff_x );
+    }
 
-      // Compute a and b
-      NT a = 0., b = 0.;
+    // Compute a and b
+    NT a = 0., b = 0.;
 
-      if(m_lambda == 0.) { // ASAP
-        CGAL_precondition(C1 != 0.);
-        a = C2 / C1;
-        b = C3 / C1;
-      }
-      else if( std::abs(C1) < m_lambda_tolerance * m_lambda &&
-               std::abs(C2) < m_lambda_tolerance * m_lambda ) { // ARAP
-        // If lambda is large compared to C1 and C2, the cubic equation that
-        // determines a and b can be simplified to a simple quadric equation
-
-        CGAL_precondition(C2*C2 + C3*C3 != 0.);
-        NT denom = 1. / CGAL::sqrt(C2*C2 + C3*C3);
-        a = C2 * denom;
-        b = C3 * denom;
-      }
-      else { // general case
+    if(m_lambda == 0.) { // ASAP
+      CGAL_precondition(C1 != 0.);
+      a = C2 / C1;
+      b = C3 / C1;
+    }
+    else if( std::abs(C1) < m_lambda_tolerance * m_lambda &&
+             std::abs(C2) < m_lambda_tolerance * m_lambda ) { // ARAP
+      // If lambda is large compared to C1 and C2, the cubic equation that
+      // determines a and b can be simplified to a simple quadric equation
+
+      CGAL_precondition(C2*C2 + C3*C3 != 0.);
+      NT denom = 1. / CGAL::sqrt(C2*C2 + C3*C3);
+      a = C2 * denom;
+      b = C3 * denom;
+    }
+    else { // general case
 #ifdef CGAL_SMP_SOLVE_CUBIC_EQUATION
-        CGAL_precondition(C2 != 0.);
-        NT C2_denom = 1. / C2;
-        NT a3_coeff = 2. * m_lambda * (C2 * C2 + C3 * C3) * C2_denom * C2_denom;
+      CGAL_precondition(C2 != 0.);
+      NT C2_denom = 1. / C2;
+      NT a3_coeff = 2. * m_lambda * (C2 * C2 + C3 * C3) * C2_denom * C2_denom;
 
-        std::vector<NT> roots;
+      std::vector<NT> roots;
 #ifdef CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP
-        solve_cubic_equation_with_AK(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
+      solve_cubic_equation_with_AK(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
 #else // !CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP
-        solve_cubic_equation(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
+      solve_cubic_equation(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
 #endif
-        std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
-                                                          ctmap, lp, lpmap, uvmap,
-                                                          C2_denom, C3, roots);
+      std::size_t ind = compute_root_with_lowest_energy(ft, uvs, C2_denom, C3, roots);
 
-        a = roots[ind];
-        b = C3 * C2_denom * a;
+      a = roots[ind];
+      b = C3 * C2_denom * a;
 #else // !CGAL_SMP_SOLVE_CUBIC_EQUATION, solve the bivariate system
-        std::vector<NT> a_roots;
-        std::vector<NT> b_roots;
-        solve_bivariate_system(C1, C2, C3, a_roots, b_roots);
-
-        std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
-                                                          ctmap, lp, lpmap, uvmap,
-                                                          a_roots, b_roots);
-        a = a_roots[ind];
-        b = b_roots[ind];
+      std::vector<NT> a_roots;
+      std::vector<NT> b_roots;
+      solve_bivariate_system(C1, C2, C3, a_roots, b_roots);
+
+      std::size_t ind = compute_root_with_lowest_energy(ft, uvs, a_roots, b_roots);
+      a = a_roots[ind];
+      b = b_roots[ind];
 #endif
-      }
+    }
 
-      // Update the map faces --> optimal Lt matrices
-      Lt_matrix ltm = std::make_pair(a, b);
-      put(ltmap, fd, ltm);
+    return std::make_pair(a, b);
+  }
+
+  // Compute the optimal values of the linear transformation matrices Lt.
+  Error_code compute_optimal_Lt_matrices(const Faces_vector& faces,
+                                         const Face_terms_vector& face_terms,
+                                         const std::vector<Point_2>& uvs,
+                                         Lt_vector& lts,
+                                         Lt_map ltmap) const
+  {
+    Error_code status = OK;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag_, Parallel_tag>::value) {
+      // The faces are independent
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, faces.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+        for(std::size_t i = r.begin(); i != r.end(); ++i)
+          lts[i] = compute_optimal_Lt_matrix(face_terms[i], uvs);
+      });
+    }
+    else
+#endif
+    {
+      for(std::size_t i = 0; i < faces.size(); ++i)
+        lts[i] = compute_optimal_Lt_matrix(face_terms[i], uvs);
     }
 
+    // Update the map faces --> optimal Lt matrices, used to compute the right hand side
+    for(std::size_t i = 0; i < faces.size(); ++i)
+      put(ltmap, faces[i], lts[i]);
+
     return status;
   }
 
@@ -947,6 +982,55 @@ private:
     return OK;
   }
 
+  // Gather the constant terms of the energy of each face.
+  //
+  // \pre Vertices must be indexed.
+  template <typename VertexIndexMap>
+  void compute_face_terms(const Triangle_mesh& mesh,
+                          const Faces_vector& faces,
+                          const Cot_map ctmap,
+                          const Local_points& lp,
+                          const Lp_map lpmap,
+                          const VertexIndexMap vimap,
+                          Face_terms_vector& face_terms) const
+  {
+    face_terms.resize(faces.size());
+
+    for(std::size_t i = 0; i < faces.size(); ++i) {
+      Face_terms& ft = face_terms[i];
+      int k = 0;
+
+      halfedge_around_face_circulator hc(halfedge(faces[i], mesh), mesh), end(hc);
+      CGAL_For_all(hc, end) {
+        halfedge_descriptor hd = *hc;
+        ft.cot[k] = get(ctmap, hd);
+
+        const Local_indices& li = get(lpmap, hd);
+        const Point_2& ppi = lp[ li.first ];
+        const Point_2& ppj = lp[ li.second ];
+        ft.p_diff_x[k] = ppi.x() - ppj.x();
+        ft.p_diff_y[k] = ppi.y() - ppj.y();
+
+        ft.source_index[k] = get(vimap, source(hd, mesh));
+        ft.target_index[k] = get(vimap, target(hd, mesh));
+        ++k;
+      }
+    }
+  }
+
+  // Copy the current (u,v) coordinates of the vertices in a vector, using the vertex indices.
+  template <typename VertexUVMap,
+            typename VertexIndexMap>
+  void get_uvs(const Vertex_set& vertices,
+               const VertexUVMap uvmap,
+               const VertexIndexMap vimap,
+               std::vector<Point_2>& uvs) const
+  {
+    uvs.resize(vertices.size());
+    for(vertex_descriptor vd : vertices)
+      uvs[get(vimap, vd)] = get(uvmap, vd);
+  }
+
   // Compute the coefficient b_ij = (i,j) of the right hand side vector B,
   // for j neighbor vertex of i.
   void compute_b_ij(const Triangle_mesh& mesh,
@@ -1109,7 +1193,8 @@ private:
                              VertexUVMap uvmap,
                              VertexIndexMap vimap,
                              VertexParameterizedMap vpmap,
-                             const Matrix& A)
+                             const Matrix& A,
+                             bool& is_factorized)
   {
     Error_code status = OK;
 
@@ -1125,9 +1210,10 @@ private:
 
     // Solve "A*Xu = Bu". On success, the solution is (1/Du) * Xu.
     // Solve "A*Xv = Bv". On success, the solution is (1/Dv) * Xv.
-    double Du, Dv;
-    if(!get_linear_algebra_traits().linear_solver(A, Bu, Xu, Du) ||
-       !get_linear_algebra_traits().linear_solver(A, Bv, Xv, Dv)) {
+    // A is constant: if possible, it is only factorized at the first iteration.
+    NT Du, Dv;
+    if(!internal::solve_linear_systems(get_linear_algebra_traits(), A, Bu, Bv, Xu, Xv,
+                                       Du, Dv, is_factorized)) {
       std::cerr << "Could not solve linear system" << std::endl;
       status = ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
       return status;
@@ -1155,35 +1241,25 @@ private:
 
 
   // Compute the current energy of a face, given a linear transformation matrix.
-  template <typename VertexUVMap>
-  NT compute_current_face_energy(const Triangle_mesh& mesh,
-                                 face_descriptor fd,
-                                 const Cot_map ctmap,
-                                 const Local_points& lp,
-                                 const Lp_map lpmap,
-                                 const VertexUVMap uvmap,
+  NT compute_current_face_energy(const Face_terms& ft,
+                                 const std::vector<Point_2>& uvs,
                                  const NT a, const NT b) const
   {
     NT Ef = 0.;
 
-    halfedge_around_face_circulator hc(halfedge(fd, mesh), mesh), end(hc);
-    CGAL_For_all(hc, end) {
-      halfedge_descriptor hd = *hc;
-      NT cot = get(ctmap, hd);
+    for(int k=0; k<3; ++k) {
+      NT cot = ft.cot[k];
       NT nabla_x = 0., nabla_y = 0.;
 
       // UV positions
-      const Point_2& pi = get(uvmap, source(hd, mesh));
-      const Point_2& pj = get(uvmap, target(hd, mesh));
+      const Point_2& pi = uvs[ft.source_index[k]];
+      const Point_2& pj = uvs[ft.target_index[k]];
       NT diff_x = pi.x() - pj.x();
       NT diff_y = pi.y() - pj.y();
 
       // local positions (in the 2D param)
-      const Local_indices& li = get(lpmap, hd);
-      const Point_2& ppi = lp[ li.first ];
-      const Point_2& ppj = lp[ li.second ];
-      NT p_diff_x = ppi.x() - ppj.x();
-      NT p_diff_y = ppi.y() - ppj.y();
+      NT p_diff_x = ft.p_diff_x[k];
+      NT p_diff_y = ft.p_diff_y[k];
 
       nabla_x = diff_x - (  a * p_diff_x + b * p_diff_y );
       nabla_y = diff_y - ( -b * p_diff_x + a * p_diff_y );
@@ -1197,39 +1273,50 @@ private:
     return Ef;
   }
 
-  // Compute the current energy of a face.
-  template <typename VertexUVMap>
-  NT compute_current_face_energy(const Triangle_mesh& mesh,
-                                 face_descriptor fd,
-                                 const Cot_map ctmap,
-                                 const Local_points& lp,
-                                 const Lp_map lpmap,
-                                 const Lt_map ltmap,
-                                 const VertexUVMap uvmap) const
+  // Compute the current energy of the faces [begin, end).
+  NT compute_current_energy(const Face_terms_vector& face_terms,
+                            const std::vector<Point_2>& uvs,
+                            const Lt_vector& lts,
+                            std::size_t begin, std::size_t end) const
   {
-    const Lt_matrix& ltm = get(ltmap, fd); // the (current) optimal linear transformation
-    NT a = ltm.first;
-    NT b = ltm.second;
+    NT E = 0.;
+
+    for(std::size_t i = begin; i < end; ++i) {
+      // the (current) optimal linear transformation
+      NT Ef = compute_current_face_energy(face_terms[i], uvs,
+                                          lts[i].first, lts[i].second);
+      E += Ef;
+    }
 
-    return compute_current_face_energy(mesh, fd, ctmap, lp, lpmap, uvmap, a, b);
+    return E;
   }
 
   // Compute the current energy of the parameterization.
-  template <typename VertexUVMap>
-  NT compute_current_energy(const Triangle_mesh& mesh,
-                            const Faces_vector& faces,
-                            const Cot_map ctmap,
-                            const Local_points& lp,
-                            const Lp_map lpmap,
-                            const Lt_map ltmap,
-                            const VertexUVMap uvmap) const
+  NT compute_current_energy(const Face_terms_vector& face_terms,
+                            const std::vector<Point_2>& uvs,
+                            const Lt_vector& lts) const
   {
     NT E = 0.;
 
-    for(face_descriptor fd : faces) {
-      NT Ef = compute_current_face_energy(mesh, fd, ctmap, lp, lpmap,
-                                          ltmap, uvmap);
-      E += Ef;
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag_, Parallel_tag>::value) {
+      // Partial sums over fixed blocks of faces, added in order
+      const std::size_t nb_blocks = (face_terms.size() + energy_block_size - 1) / energy_block_size;
+      std::vector<NT> block_energies(nb_blocks);
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_blocks, 1),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+        for(std::size_t b = r.begin(); b != r.end(); ++b)
+          block_energies[b] = compute_current_energy(face_terms, uvs, lts, b * energy_block_size,
+                                                     (std::min)((b + 1) * energy_block_size, face_terms.size()));
+      });
+
+      for(const NT& Eb : block_energies)
+        E += Eb;
+    }
+    else
+#endif
+    {
+      E = compute_current_energy(face_terms, uvs, lts, 0, face_terms.size());
     }
 
     E *= 0.5;
@@ -1354,15 +1441,23 @@ public:
     if(status != OK)
       return status;
 
-    // The matrix A is constant and can be initialized outside of the loop
+    // Gather the constant terms of the local steps and of the energy
+    Face_terms_vector face_terms;
+    compute_face_terms(mesh, faces, ctmap, lp, lpmap, vimap, face_terms);
+
+    // The matrix A is constant and can be initialized (and factorized) outside of the loop
     int nbVertices = static_cast<int>(vertices.size());
     Matrix A(nbVertices, nbVertices); // the constant matrix using in the linear system A*X = B
     status = initialize_matrix_A(mesh, vertices, ctmap, vimap, vpmap, A);
     if(status != OK)
       return status;
+    bool is_factorized = false;
 
-    NT energy_this = compute_current_energy(mesh, faces, ctmap, lp, lpmap,
-                                            ltmap, uvmap);
+    std::vector<Point_2> uvs;
+    get_uvs(vertices, uvmap, vimap, uvs);
+
+    Lt_vector lts(faces.size(), Lt_matrix(0., 0.));
+    NT energy_this = compute_current_energy(face_terms, uvs, lts);
     NT energy_last;
 
 #ifdef CGAL_PARAMETERIZATION_ARAP_VERBOSE
@@ -1374,9 +1469,9 @@ public:
     unsigned int ite = 1;
     for(;;)
     {
-      compute_optimal_Lt_matrices(mesh, faces, ctmap, lp, lpmap, uvmap, ltmap);
+      compute_optimal_Lt_matrices(faces, face_terms, uvs, lts, ltmap);
       status = update_solution(mesh, vertices, ctmap, lp, lpmap, ltmap,
-                                               uvmap, vimap, vpmap, A);
+                                               uvmap, vimap, vpmap, A, is_factorized);
 
       // Output the current parameterization
 #ifdef CGAL_SMP_ARAP_DEBUG
@@ -1386,10 +1481,12 @@ public:
       if(status != OK)
         return status;
 
+      get_uvs(vertices, uvmap, vimap, uvs);
+
       // energy based termination
       if(m_tolerance > 0. && ite <= m_iterations) { // if tolerance <= 0, don't compute energy
         energy_last = energy_this;
-        energy_this = compute_current_energy(mesh, faces, ctmap, lp, lpmap, ltmap, uvmap);
+        energy_this = compute_current_energy(face_terms, uvs, lts);
 
 #ifdef CGAL_PARAMETERIZATION_ARAP_VERBOSE
         std::cout << "Energy at iteration " << ite << " : " << energy_this << std::endl;
@@ -0,0 +1,110 @@
+// Copyright (c) 2025  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+#ifndef CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_LINEAR_SOLVER_H
+#define CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_LINEAR_SOLVER_H
+
+#include <CGAL/license/Surface_mesh_parameterization.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace CGAL {
+
+namespace Surface_mesh_parameterization {
+
+namespace internal {
+
+// Whether the solver traits are a model of `SparseLinearAlgebraWithFactorTraits_d`
+template <typename SolverTraits, typename = void>
+struct Has_factor
+  : public std::false_type
+{ };
+
+template <typename SolverTraits>
+struct Has_factor<SolverTraits,
+                  std::void_t<decltype(std::declval<SolverTraits&>().factor(
+                                         std::declval<const typename SolverTraits::Matrix&>(),
+                                         std::declval<typename SolverTraits::NT&>())),
+                              decltype(std::declval<SolverTraits&>().linear_solver(
+                                         std::declval<const typename SolverTraits::Vector&>(),
+                                         std::declval<typename SolverTraits::Vector&>()))> >
+  : public std::true_type
+{ };
+
+// Solves the systems "A*Xu = Bu" and "A*Xv = Bv", which share the same matrix.
+//
+// If the solver traits can factorize, `A` is factorized only once for both systems,
+// and not at all if `is_factorized` is `true`, that is if `A` is unchanged since a previous call
+// with the same solver traits. `is_factorized` is set to `true` once `A` is factorized.
+// Otherwise, both systems are solved from scratch.
+template <typename SolverTraits, typename Matrix, typename Vector, typename NT>
+bool solve_linear_systems(SolverTraits& solver,
+                          const Matrix& A,
+                          const Vector& Bu, const Vector& Bv,
+                          Vector& Xu, Vector& Xv,
+                          NT& Du, NT& Dv,
+                          bool& is_factorized,
+                          std::true_type /*has factor*/)
+{
+  if(!is_factorized) {
+    if(!solver.factor(A, Du))
+      return false;
+    is_factorized = true;
+  }
+
+  // the factorization does not use homogeneous coordinates
+  Du = Dv = 1;
+  return solver.linear_solver(Bu, Xu) && solver.linear_solver(Bv, Xv);
+}
+
+template <typename SolverTraits, typename Matrix, typename Vector, typename NT>
+bool solve_linear_systems(SolverTraits& solver,
+                          const Matrix& A,
+                          const Vector& Bu, const Vector& Bv,
+                          Vector& Xu, Vector& Xv,
+                          NT& Du, NT& Dv,
+                          bool& /*is_factorized*/,
+                          std::false_type /*has factor*/)
+{
+  return solver.linear_solver(A, Bu, Xu, Du) && solver.linear_solver(A, Bv, Xv, Dv);
+}
+
+template <typename SolverTraits, typename Matrix, typename Vector, typename NT>
+bool solve_linear_systems(SolverTraits& solver,
+                          const Matrix& A,
+                          const Vector& Bu, const Vector& Bv,
+                          Vector& Xu, Vector& Xv,
+                          NT& Du, NT& Dv,
+                          bool& is_factorized)
+{
+  return solve_linear_systems(solver, A, Bu, Bv, Xu, Xv, Du, Dv, is_factorized,
+                              Has_factor<SolverTraits>());
+}
+
+template <typename SolverTraits, typename Matrix, typename Vector, typename NT>
+bool solve_linear_systems(SolverTraits& solver,
+                          const Matrix& A,
+                          const Vector& Bu, const Vector& Bv,
+                          Vector& Xu, Vector& Xv,
+                          NT& Du, NT& Dv)
+{
+  bool is_factorized = false;
+  return solve_linear_systems(solver, A, Bu, Bv, Xu, Xv, Du, Dv, is_factorized);
+}
+
+} // namespace internal
+
+} // namespace Surface_mesh_parameterization
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_LINEAR_SOLVER_H
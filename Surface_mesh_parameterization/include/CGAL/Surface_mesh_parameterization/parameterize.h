@@ -18,8 +18,21 @@
 #include <CGAL/Surface_mesh_parameterization/Error_code.h>
 #include <CGAL/Surface_mesh_parameterization/Mean_value_coordinates_parameterizer_3.h>
 
+#include <CGAL/Polygon_mesh_processing/connected_components.h>
+#include <CGAL/tags.h>
+
 #include <boost/property_map/property_map.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
 /// \file parameterize.h
 
 namespace CGAL {
@@ -109,6 +122,126 @@ Error_code parameterize(TriangleMesh& mesh,
   return parameterize(mesh, parameterizer, bhd, uvmap);
 }
 
+namespace internal {
+
+// Same as `parameterize()`, but the vertex index and "parameterized" maps only contain
+// the vertices of the connected component of `bhd`, and do not modify `mesh`.
+template <class TriangleMesh, class Parameterizer, class HD, class VertexUVmap>
+Error_code parameterize_chart(TriangleMesh& mesh,
+                              Parameterizer parameterizer,
+                              HD bhd,
+                              VertexUVmap uvmap)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+
+  CGAL_precondition(bhd != boost::graph_traits<TriangleMesh>::null_halfedge() && is_border(bhd, mesh));
+
+  typedef typename boost::graph_traits<TriangleMesh>::vertex_descriptor       vertex_descriptor;
+  typedef typename boost::graph_traits<TriangleMesh>::face_descriptor         face_descriptor;
+
+  std::vector<face_descriptor> cc_faces;
+  PMP::connected_component(face(opposite(bhd, mesh), mesh), mesh, std::back_inserter(cc_faces));
+
+  std::unordered_map<vertex_descriptor, int> vimap_storage;
+  for(face_descriptor f : cc_faces) {
+    for(vertex_descriptor v : vertices_around_face(halfedge(f, mesh), mesh))
+      vimap_storage.emplace(v, static_cast<int>(vimap_storage.size()));
+  }
+  boost::associative_property_map<std::unordered_map<vertex_descriptor, int> > vimap(vimap_storage);
+
+  std::unordered_map<vertex_descriptor, bool> vpmap_storage;
+  for(const auto& vi : vimap_storage)
+    vpmap_storage.emplace(vi.first, false);
+  boost::associative_property_map<std::unordered_map<vertex_descriptor, bool> > vpmap(vpmap_storage);
+
+  return parameterizer.parameterize(mesh, bhd, uvmap, vimap, vpmap);
+}
+
+} // namespace internal
+
+/// \ingroup  PkgSurfaceMeshParameterizationMainFunction
+///
+/// computes a mapping from a 3D triangle surface `mesh` to 2D domains, chart by chart,
+/// a chart being the connected component of `mesh` incident to a border halfedge.
+/// Each chart is parameterized by a new parameterizer, as with `parameterize()`.
+///
+/// This is typically used to parameterize the charts of a texture atlas, the seams
+/// between the charts being defined by a `Seam_mesh`.
+///
+/// \tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag`,
+///         `Parallel_tag`, and `Parallel_if_available_tag`. With `Parallel_tag`, the charts are
+///         parameterized concurrently.
+/// \tparam TriangleMesh must be a model of `FaceGraph`.
+/// \tparam ParameterizerFactory a function object without argument, whose result type is a model of
+///         `Parameterizer_3`. It is called once for each chart, so that the charts do not share
+///         the state of a parameterizer, such as a linear solver.
+/// \tparam HalfedgeRange a model of `ConstRange` with `boost::graph_traits<TriangleMesh>::%halfedge_descriptor`
+///         as value type.
+/// \tparam VertexUVmap must be a model of `ReadWritePropertyMap` with
+///         `boost::graph_traits<TriangleMesh>::%vertex_descriptor` as key type and
+///         %Point_2 (type deduced from `TriangleMesh` using `Kernel_traits`)
+///         as value type.
+///
+/// \param mesh a triangulated surface.
+/// \param make_parameterizer the function object creating the parameterizer of each chart.
+/// \param border_halfedges one halfedge on the boundary of each chart.
+/// \param uvmap an instantiation of the class `VertexUVmap`.
+///
+/// \returns `OK` if all the charts are parameterized, and otherwise the error code of the first chart,
+///          in the order of `border_halfedges`, which could not be parameterized.
+///
+/// \pre `mesh` must be a triangular mesh.
+/// \pre The halfedges of `border_halfedges` must be incident to different connected components.
+/// \pre With `Parallel_tag`, the parameterizers must not modify `mesh` (which is the case of all
+///   the parameterizers of this package, except `Iterative_authalic_parameterizer_3` that adds property maps
+///   to `mesh`), the property maps of `mesh` must support concurrent reads,
+///   and `uvmap` must support concurrent writes of different keys, which is the case
+///   of the property maps of `Surface_mesh`.
+///
+template <class ConcurrencyTag = Sequential_tag,
+          class TriangleMesh, class ParameterizerFactory, class HalfedgeRange, class VertexUVmap>
+Error_code parameterize_charts(TriangleMesh& mesh,
+                               const ParameterizerFactory& make_parameterizer,
+                               const HalfedgeRange& border_halfedges,
+                               VertexUVmap uvmap)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  CGAL_precondition(is_valid_polygon_mesh(mesh));
+
+  typedef typename boost::graph_traits<TriangleMesh>::halfedge_descriptor     halfedge_descriptor;
+
+  const std::vector<halfedge_descriptor> bhds(std::begin(border_halfedges), std::end(border_halfedges));
+  std::vector<Error_code> status(bhds.size(), OK);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    // one chart per task, as the sizes of the charts usually vary a lot
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, bhds.size(), 1),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+        status[i] = internal::parameterize_chart(mesh, make_parameterizer(), bhds[i], uvmap);
+    });
+  }
+  else
+#endif
+  {
+    for(std::size_t i = 0; i < bhds.size(); ++i)
+      status[i] = internal::parameterize_chart(mesh, make_parameterizer(), bhds[i], uvmap);
+  }
+
+  for(Error_code s : status) {
+    if(s != OK)
+      return s;
+  }
+  return OK;
+}
+
 } // namespace Surface_mesh_parameterization
 
 } // namespace CGAL
@@ -0,0 +1,161 @@
+#include <CGAL/Simple_cartesian.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/boost/graph/copy_face_graph.h>
+
+#include <CGAL/Surface_mesh_parameterization/Error_code.h>
+#include <CGAL/surface_mesh_parameterization.h>
+
+#include <CGAL/Polygon_mesh_processing/border.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace SMP = CGAL::Surface_mesh_parameterization;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+typedef CGAL::Simple_cartesian<double>                            Kernel;
+typedef Kernel::Point_2                                           Point_2;
+typedef Kernel::Point_3                                           Point_3;
+
+typedef CGAL::Surface_mesh<Point_3>                               SMesh;
+
+typedef boost::graph_traits<SMesh>::vertex_descriptor             vertex_descriptor;
+typedef boost::graph_traits<SMesh>::halfedge_descriptor           halfedge_descriptor;
+
+typedef SMesh::Property_map<vertex_descriptor, Point_2>           UV_pmap;
+
+bool same_uvs(const SMesh& sm, UV_pmap uvm1, UV_pmap uvm2)
+{
+  for(vertex_descriptor v : vertices(sm)) {
+    const Point_2& uv1 = get(uvm1, v);
+    const Point_2& uv2 = get(uvm2, v);
+    if(std::abs(uv1.x() - uv2.x()) > 1e-8 || std::abs(uv1.y() - uv2.y()) > 1e-8) {
+      std::cerr << "Different uvs: " << uv1 << " vs " << uv2 << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// compares the ARAP parameterization computed with parallel local steps with the sequential one
+bool test_parallel_ARAP(SMesh& sm)
+{
+  const halfedge_descriptor bhd = PMP::longest_border(sm).first;
+
+  UV_pmap uvm_seq = sm.add_property_map<vertex_descriptor, Point_2>("v:uv_seq").first;
+  SMP::ARAP_parameterizer_3<SMesh> seq_parameterizer;
+  if(SMP::parameterize(sm, seq_parameterizer, bhd, uvm_seq) != SMP::OK) {
+    std::cerr << "Error: sequential ARAP failed" << std::endl;
+    return false;
+  }
+
+  UV_pmap uvm_par = sm.add_property_map<vertex_descriptor, Point_2>("v:uv_par").first;
+  typedef SMP::ARAP_parameterizer_3<SMesh, CGAL::Default, CGAL::Default,
+                                    CGAL::Parallel_if_available_tag> Parallel_parameterizer;
+  Parallel_parameterizer par_parameterizer;
+  if(SMP::parameterize(sm, par_parameterizer, bhd, uvm_par) != SMP::OK) {
+    std::cerr << "Error: parallel ARAP failed" << std::endl;
+    return false;
+  }
+
+  const bool ok = same_uvs(sm, uvm_seq, uvm_par);
+  sm.remove_property_map(uvm_seq);
+  sm.remove_property_map(uvm_par);
+  return ok;
+}
+
+// compares the parameterization of several charts with the parameterization of each chart
+template <typename ConcurrencyTag, typename Parameterizer>
+bool test_charts(SMesh& sm, const std::vector<halfedge_descriptor>& bhds, const char* name)
+{
+  UV_pmap uvm_expected = sm.add_property_map<vertex_descriptor, Point_2>("v:uv_expected").first;
+  for(halfedge_descriptor bhd : bhds) {
+    if(SMP::parameterize(sm, Parameterizer(), bhd, uvm_expected) != SMP::OK) {
+      std::cerr << "Error: failed to parameterize a chart with " << name << std::endl;
+      return false;
+    }
+  }
+
+  UV_pmap uvm = sm.add_property_map<vertex_descriptor, Point_2>("v:uv").first;
+  if(SMP::parameterize_charts<ConcurrencyTag>(sm, []{ return Parameterizer(); }, bhds, uvm) != SMP::OK) {
+    std::cerr << "Error: failed to parameterize the charts with " << name << std::endl;
+    return false;
+  }
+
+  const bool ok = same_uvs(sm, uvm_expected, uvm);
+  sm.remove_property_map(uvm_expected);
+  sm.remove_property_map(uvm);
+  return ok;
+}
+
+template <typename ConcurrencyTag>
+bool test_all_charts(SMesh& sm, const std::vector<halfedge_descriptor>& bhds)
+{
+  return test_charts<ConcurrencyTag, SMP::ARAP_parameterizer_3<SMesh> >(sm, bhds, "ARAP") &&
+         test_charts<ConcurrencyTag, SMP::LSCM_parameterizer_3<SMesh> >(sm, bhds, "LSCM") &&
+         test_charts<ConcurrencyTag, SMP::Discrete_conformal_map_parameterizer_3<SMesh> >(sm, bhds, "DCM");
+}
+
+int main(int argc, char** argv)
+{
+  SMesh sm;
+  std::ifstream in((argc>1) ? argv[1] : CGAL::data_file_path("meshes/head.off"));
+  if(!in || !(in >> sm)) {
+    std::cerr << "Error: problem loading the input data" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // a single chart with parallel local steps
+#ifdef CGAL_LINKED_WITH_TBB
+  tbb::task_arena arena(4);
+  bool ok = true;
+  arena.execute([&]{ ok = test_parallel_ARAP(sm); });
+  if(!ok)
+    return EXIT_FAILURE;
+#else
+  if(!test_parallel_ARAP(sm))
+    return EXIT_FAILURE;
+#endif
+
+  // several charts: translated copies of a disk
+  SMesh chart, charts;
+  std::ifstream chart_in((argc>2) ? argv[2] : CGAL::data_file_path("meshes/nefertiti.off"));
+  if(!chart_in || !(chart_in >> chart)) {
+    std::cerr << "Error: problem loading the input data" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<halfedge_descriptor> bhds;
+  for(int i=0; i<6; ++i) {
+    PMP::transform(Kernel::Aff_transformation_3(CGAL::TRANSLATION, Kernel::Vector_3(1000, 0, 0)), chart);
+    CGAL::copy_face_graph(chart, charts);
+  }
+  PMP::extract_boundary_cycles(charts, std::back_inserter(bhds));
+  if(bhds.size() != 6) {
+    std::cerr << "Error: expected 6 charts, got " << bhds.size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if(!test_all_charts<CGAL::Sequential_tag>(charts, bhds))
+    return EXIT_FAILURE;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // parameterize several charts concurrently, whatever the number of cores
+  arena.execute([&]{ ok = test_all_charts<CGAL::Parallel_tag>(charts, bhds); });
+  if(!ok)
+    return EXIT_FAILURE;
+#endif
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
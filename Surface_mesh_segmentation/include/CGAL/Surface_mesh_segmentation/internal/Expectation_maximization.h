@@ -20,10 +20,12 @@
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <type_traits>
 
 #include <CGAL/Surface_mesh_segmentation/internal/K_means_clustering.h>
 #include <CGAL/assertions.h>
 #include <CGAL/Random.h>
+#include <CGAL/tags.h>
 
 #define CGAL_DEFAULT_MAXIMUM_ITERATION 10u
 #define CGAL_DEFAULT_NUMBER_OF_RUN 15u
@@ -134,6 +136,22 @@ public:
                            std::size_t number_of_runs = CGAL_DEFAULT_NUMBER_OF_RUN,
                            double threshold = CGAL_DEFAULT_THRESHOLD,
                            std::size_t maximum_iteration = CGAL_DEFAULT_MAXIMUM_ITERATION )
+    : Expectation_maximization(Sequential_tag(), number_of_centers, data, init_type,
+                               number_of_runs, threshold, maximum_iteration) {
+  }
+
+  /**
+   * Same as above, the E and M steps (and k-means initialization) being computed in parallel with `Parallel_tag`.
+   * The runs are still sequential, so that the centers found only differ from the sequential ones by rounding errors.
+   */
+  template<class ConcurrencyTag>
+  Expectation_maximization(ConcurrencyTag,
+                           std::size_t number_of_centers,
+                           const std::vector<double>& data,
+                           Initialization_types init_type = PLUS_INITIALIZATION,
+                           std::size_t number_of_runs = CGAL_DEFAULT_NUMBER_OF_RUN,
+                           double threshold = CGAL_DEFAULT_THRESHOLD,
+                           std::size_t maximum_iteration = CGAL_DEFAULT_MAXIMUM_ITERATION )
     :
     final_likelihood(-(std::numeric_limits<double>::max)()), points(data),
     responsibility_matrix(std::vector<std::vector<double> >(number_of_centers,
@@ -142,23 +160,27 @@ public:
     maximum_iteration(maximum_iteration),
     init_type(init_type),
     random(CGAL_DEFAULT_SEED) {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
     CGAL_assertion(data.size() >= number_of_centers
                    && "Number of centers can not be more than number of data.");
 
     // For initialization with k-means, with one run
     if(init_type == K_MEANS_INITIALIZATION) {
-      K_means_clustering k_means(number_of_centers, data,
+      K_means_clustering k_means(ConcurrencyTag(), number_of_centers, data,
                                  K_means_clustering::PLUS_INITIALIZATION,
                                  number_of_runs, maximum_iteration);
 
       k_means.fill_with_centers(centers);
-      calculate_initial_mixing_and_deviation();
+      calculate_initial_mixing_and_deviation<ConcurrencyTag>();
 
-      calculate_clustering();
+      calculate_clustering<ConcurrencyTag>();
     }
     // For initialization with random center selection, with multiple run
     else {
-      calculate_clustering_with_multiple_run(number_of_centers, number_of_runs);
+      calculate_clustering_with_multiple_run<ConcurrencyTag>(number_of_centers, number_of_runs);
     }
     sort(centers.begin(), centers.end());
   }
@@ -167,23 +189,24 @@ public:
    * Fills data_center by the id of the center which has maximum responsibility.
    * @param[out] data_centers
    */
-  void fill_with_center_ids(std::vector<std::size_t>& data_centers) {
+  template<class ConcurrencyTag = Sequential_tag>
+  void fill_with_center_ids(std::vector<std::size_t>& data_centers) const {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      data_centers.resize(points.size());
+      Segmentation::internal::parallel_for_each_block(points.size(),
+                                                      [&](std::size_t, std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i) {
+          data_centers[i] = center_with_maximum_likelihood(points[i]);
+        }
+      });
+      return;
+    }
+#endif
     data_centers.reserve(points.size());
-    for(std::vector<double>::iterator point_it = points.begin();
+    for(std::vector<double>::const_iterator point_it = points.begin();
         point_it != points.end(); ++point_it) {
-      double max_likelihood = 0.0;
-      std::size_t max_center = (std::numeric_limits<std::size_t>::max)(),
-                  center_counter = 0;
-      for(std::vector<Gaussian_center>::iterator center_it = centers.begin();
-          center_it != centers.end(); ++center_it, ++center_counter) {
-        double likelihood = center_it->probability_with_coef(*point_it);
-        if(max_likelihood < likelihood) {
-          max_likelihood = likelihood;
-          max_center = center_counter;
-        }
-      }
-      CGAL_assertion( max_center!=(std::numeric_limits<std::size_t>::max)() );
-      data_centers.push_back(max_center);
+      data_centers.push_back(center_with_maximum_likelihood(*point_it));
     }
   }
 
@@ -191,27 +214,92 @@ public:
    * Fills probabilities[center][point] by responsibility of the center on the point.
    * @param[out] probabilities
    */
-  void fill_with_probabilities(std::vector<std::vector<double> >& probabilities) {
+  template<class ConcurrencyTag = Sequential_tag>
+  void fill_with_probabilities(std::vector<std::vector<double> >& probabilities) const {
     probabilities = std::vector<std::vector<double> >
                     (centers.size(), std::vector<double>(points.size()));
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      Segmentation::internal::parallel_for_each_block(points.size(),
+                                                      [&](std::size_t, std::size_t begin, std::size_t end) {
+        for(std::size_t point_i = begin; point_i < end; ++point_i) {
+          fill_with_probabilities(point_i, probabilities);
+        }
+      });
+      return;
+    }
+#endif
     for(std::size_t point_i = 0; point_i < points.size(); ++point_i) {
-      double total_probability = 0.0;
-      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
-        double probability = centers[center_i].probability_with_coef(points[point_i]);
-        total_probability += probability;
-        probabilities[center_i][point_i] = probability;
+      fill_with_probabilities(point_i, probabilities);
+    }
+  }
+
+private:
+  /**
+   * Finds the center which has maximum responsibility on a point.
+   * @param x data
+   * @return index of the center
+   */
+  std::size_t center_with_maximum_likelihood(double x) const {
+    double max_likelihood = 0.0;
+    std::size_t max_center = (std::numeric_limits<std::size_t>::max)(),
+                center_counter = 0;
+    for(std::vector<Gaussian_center>::const_iterator center_it = centers.begin();
+        center_it != centers.end(); ++center_it, ++center_counter) {
+      double likelihood = center_it->probability_with_coef(x);
+      if(max_likelihood < likelihood) {
+        max_likelihood = likelihood;
+        max_center = center_counter;
       }
-      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
-        probabilities[center_i][point_i] /= total_probability;
+    }
+    CGAL_assertion( max_center!=(std::numeric_limits<std::size_t>::max)() );
+    return max_center;
+  }
+
+  /**
+   * Fills probabilities[center][point_i] by responsibility of the center on the point.
+   * @param point_i index of the point
+   * @param[out] probabilities
+   * @return sum of the probabilities of the point before normalization
+   */
+  double fill_with_probabilities(std::size_t point_i,
+                                 std::vector<std::vector<double> >& probabilities) const {
+    double total_probability = 0.0;
+    for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+      double probability = centers[center_i].probability_with_coef(points[point_i]);
+      total_probability += probability;
+      probabilities[center_i][point_i] = probability;
+    }
+    for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+      probabilities[center_i][point_i] /= total_probability;
+    }
+    return total_probability;
+  }
+
+  /**
+   * Finds the closest center to a point.
+   * @param x data
+   * @param[out] min_distance distance to the closest center
+   * @return index of the closest center
+   */
+  std::size_t closest_center(double x, double& min_distance) const {
+    std::size_t closest_center = 0;
+    min_distance = std::abs(centers[0].mean - x);
+    for(std::size_t i = 1; i < centers.size(); ++i) {
+      double distance = std::abs(centers[i].mean - x);
+      if(distance < min_distance) {
+        min_distance = distance;
+        closest_center = i;
       }
     }
+    return closest_center;
   }
 
-private:
   /**
    * Calculates deviation for each center.
    * Initial deviation of a center is equal to deviation of the points whose closest center is the current center.
    */
+  template<class ConcurrencyTag>
   void calculate_initial_mixing_and_deviation() {
     // assign same mixing coef for each cluster
     for(std::vector<Gaussian_center>::iterator it = centers.begin();
@@ -221,19 +309,34 @@ private:
 
     // calculate deviation
     std::vector<std::size_t> member_count(centers.size(), 0);
-    for(std::vector<double>::iterator it = points.begin(); it!= points.end();
-        ++it) {
-      std::size_t closest_center = 0;
-      double min_distance = std::abs(centers[0].mean - *it);
-      for(std::size_t i = 1; i < centers.size(); ++i) {
-        double distance = std::abs(centers[i].mean - *it);
-        if(distance < min_distance) {
-          min_distance = distance;
-          closest_center = i;
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      const std::size_t number_of_blocks = Segmentation::internal::number_of_parallel_blocks(points.size());
+      std::vector<double> deviations(number_of_blocks * centers.size(), 0.0);
+      std::vector<std::size_t> counts(number_of_blocks * centers.size(), 0);
+      Segmentation::internal::parallel_for_each_block(points.size(),
+                                                      [&](std::size_t block, std::size_t begin, std::size_t end) {
+        for(std::size_t point_i = begin; point_i < end; ++point_i) {
+          double min_distance;
+          std::size_t center_i = closest_center(points[point_i], min_distance);
+          ++counts[block * centers.size() + center_i];
+          deviations[block * centers.size() + center_i] += min_distance * min_distance;
+        }
+      });
+      for(std::size_t block = 0; block < number_of_blocks; ++block) {
+        for(std::size_t i = 0; i < centers.size(); ++i) {
+          member_count[i] += counts[block * centers.size() + i];
+          centers[i].deviation += deviations[block * centers.size() + i];
         }
       }
-      member_count[closest_center]++;
-      centers[closest_center].deviation += min_distance * min_distance;
+    } else
+#endif
+    for(std::vector<double>::iterator it = points.begin(); it!= points.end();
+        ++it) {
+      double min_distance;
+      std::size_t center_i = closest_center(*it, min_distance);
+      member_count[center_i]++;
+      centers[center_i].deviation += min_distance * min_distance;
     }
     for(std::size_t i = 0; i < centers.size(); ++i) {
       if(member_count[i] == 0) {
@@ -249,11 +352,12 @@ private:
    * Initializes centers by choosing random points from data.
    * @param number_of_centers
    */
+  template<class ConcurrencyTag>
   void initiate_centers_randomly(std::size_t number_of_centers) {
     centers.clear();
     Selector().forgy_initialization(number_of_centers, points, centers, random);
 
-    calculate_initial_mixing_and_deviation();
+    calculate_initial_mixing_and_deviation<ConcurrencyTag>();
   }
 
   /**
@@ -261,11 +365,12 @@ private:
    * Probability of a point to become a center is proportional to its squared distance to the closest center.
    * @param number_of_centers
    */
+  template<class ConcurrencyTag>
   void initiate_centers_plus_plus(std::size_t number_of_centers) {
     centers.clear();
     Selector().plus_plus_initialization(number_of_centers, points, centers, random);
 
-    calculate_initial_mixing_and_deviation();
+    calculate_initial_mixing_and_deviation<ConcurrencyTag>();
   }
 
   //Main steps of EM algorithm
@@ -274,7 +379,14 @@ private:
    * Corresponds to M step.
    * Recalculates parameters of the centers using current responsibility matrix.
    */
+  template<class ConcurrencyTag>
   void calculate_parameters() {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      parallel_calculate_parameters();
+      return;
+    }
+#endif
     for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
       // Calculate new mean
       double new_mean = 0.0, total_membership = 0.0;
@@ -300,27 +412,87 @@ private:
     }
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  void parallel_calculate_parameters() {
+    const std::size_t number_of_blocks = Segmentation::internal::number_of_parallel_blocks(points.size());
+    std::vector<double> sums(number_of_blocks * centers.size(), 0.0);
+    std::vector<double> memberships(number_of_blocks * centers.size(), 0.0);
+
+    // Calculate new means
+    Segmentation::internal::parallel_for_each_block(points.size(),
+                                                    [&](std::size_t block, std::size_t begin, std::size_t end) {
+      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+        for(std::size_t point_i = begin; point_i < end; ++point_i) {
+          double membership = responsibility_matrix[center_i][point_i];
+          sums[block * centers.size() + center_i] += membership * points[point_i];
+          memberships[block * centers.size() + center_i] += membership;
+        }
+      }
+    });
+    std::vector<double> new_means(centers.size(), 0.0), total_memberships(centers.size(), 0.0);
+    for(std::size_t block = 0; block < number_of_blocks; ++block) {
+      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+        new_means[center_i] += sums[block * centers.size() + center_i];
+        total_memberships[center_i] += memberships[block * centers.size() + center_i];
+      }
+    }
+    for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+      new_means[center_i] /= total_memberships[center_i];
+    }
+
+    // Calculate new deviations
+    std::fill(sums.begin(), sums.end(), 0.0);
+    Segmentation::internal::parallel_for_each_block(points.size(),
+                                                    [&](std::size_t block, std::size_t begin, std::size_t end) {
+      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+        for(std::size_t point_i = begin; point_i < end; ++point_i) {
+          double membership = responsibility_matrix[center_i][point_i];
+          sums[block * centers.size() + center_i] += membership * CGAL::square(points[point_i] - new_means[center_i]);
+        }
+      }
+    });
+
+    // Assign new parameters
+    for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
+      double new_deviation = 0.0;
+      for(std::size_t block = 0; block < number_of_blocks; ++block) {
+        new_deviation += sums[block * centers.size() + center_i];
+      }
+      centers[center_i].mixing_coefficient = total_memberships[center_i] / points.size();
+      centers[center_i].deviation = std::sqrt(new_deviation / total_memberships[center_i]);
+      centers[center_i].mean = new_means[center_i];
+    }
+  }
+#endif
+
   /**
    * Corresponds to both E step and likelihood step.
    * Calculates log-likelihood, and responsibility matrix using current center parameters.
    * @return log-likelihood
    */
+  template<class ConcurrencyTag>
   double calculate_likelihood() {
     // The trick (merely a trick) is while calculating log-likelihood, we also refresh responsibility matrix,
     // so that in next iteration we do not have to calculate matrix again.
 
     double likelihood = 0.0;
-    for(std::size_t point_i = 0; point_i < points.size(); ++point_i) {
-      double total_membership = 0.0;
-      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
-        double membership = centers[center_i].probability_with_coef(points[point_i]);
-        total_membership += membership;
-        responsibility_matrix[center_i][point_i] = membership;
-      }
-      for(std::size_t center_i = 0; center_i < centers.size(); ++center_i) {
-        responsibility_matrix[center_i][point_i] /= total_membership;
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      std::vector<double> likelihoods(Segmentation::internal::number_of_parallel_blocks(points.size()), 0.0);
+      Segmentation::internal::parallel_for_each_block(points.size(),
+                                                      [&](std::size_t block, std::size_t begin, std::size_t end) {
+        for(std::size_t point_i = begin; point_i < end; ++point_i) {
+          likelihoods[block] += log(fill_with_probabilities(point_i, responsibility_matrix));
+        }
+      });
+      for(std::size_t block = 0; block < likelihoods.size(); ++block) {
+        likelihood += likelihoods[block];
       }
-      likelihood += log(total_membership);
+      return likelihood;
+    }
+#endif
+    for(std::size_t point_i = 0; point_i < points.size(); ++point_i) {
+      likelihood += log(fill_with_probabilities(point_i, responsibility_matrix));
     }
     return likelihood;
   }
@@ -331,19 +503,20 @@ private:
    * @return log-likelihood
    * @see calculate_likelihood() for E-step and likelihood calculation, calculate_parameters() for M-step
    */
+  template<class ConcurrencyTag>
   double iterate(bool first_iteration) {
     // E-step
     // we call calculate_likelihood for E-step in first iteration because
     // at first iteration, E-step is not done since calculate_likelihood() is not called yet.
     if(first_iteration) {
-      calculate_likelihood();
+      calculate_likelihood<ConcurrencyTag>();
     }
 
     // M-step
-    calculate_parameters();
+    calculate_parameters<ConcurrencyTag>();
 
     // Likelihood step and also E-step for next iteration
-    return calculate_likelihood(); // calculates likelihood and -also- refreshes responsibility matrix,
+    return calculate_likelihood<ConcurrencyTag>(); // calculates likelihood and -also- refreshes responsibility matrix,
     // so that we do not have to calculate it in next iteration.
   }
 
@@ -353,13 +526,14 @@ private:
    * or maximum iteration limit is reached.
    * @see iterate()
    */
+  template<class ConcurrencyTag>
   double calculate_clustering() {
     double likelihood = -(std::numeric_limits<double>::max)(), prev_likelihood;
     std::size_t iteration_count = 0;
     double is_converged = false;
     while(!is_converged && iteration_count++ < maximum_iteration) {
       prev_likelihood = likelihood;
-      likelihood = iterate(iteration_count == 1);
+      likelihood = iterate<ConcurrencyTag>(iteration_count == 1);
       double progress = likelihood - prev_likelihood;
       is_converged = progress < threshold * std::abs(likelihood);
     }
@@ -376,16 +550,17 @@ private:
    * @param number_of_run
    * @see calculate_clustering()
    */
+  template<class ConcurrencyTag>
   void calculate_clustering_with_multiple_run(std::size_t number_of_centers,
       std::size_t number_of_run) {
     std::vector<Gaussian_center> max_centers;
 
     while(number_of_run-- > 0) {
-      init_type == RANDOM_INITIALIZATION ? initiate_centers_randomly(
+      init_type == RANDOM_INITIALIZATION ? initiate_centers_randomly<ConcurrencyTag>(
         number_of_centers)
-      : initiate_centers_plus_plus(number_of_centers);
+      : initiate_centers_plus_plus<ConcurrencyTag>(number_of_centers);
 
-      double likelihood = calculate_clustering();
+      double likelihood = calculate_clustering<ConcurrencyTag>();
       if(likelihood == final_likelihood) {
         max_centers = centers;
       }
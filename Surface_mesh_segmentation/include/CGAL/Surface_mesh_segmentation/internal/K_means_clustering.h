@@ -21,9 +21,16 @@
 #include <cmath>
 #include <limits>
 #include <algorithm>
+#include <type_traits>
 
 #include <CGAL/assertions.h>
 #include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #define CGAL_DEFAULT_MAXIMUM_ITERATION 10u
 #define CGAL_DEFAULT_NUMBER_OF_RUN 15u
@@ -32,6 +39,40 @@
 namespace CGAL
 {
 /// @cond CGAL_DOCUMENT_INTERNAL
+#ifdef CGAL_LINKED_WITH_TBB
+namespace Segmentation
+{
+namespace internal
+{
+
+const std::size_t parallel_block_size = 4096;
+
+/** Number of blocks used by `parallel_for_each_block()` for @a size elements. */
+inline std::size_t number_of_parallel_blocks(std::size_t size)
+{
+  return (size + parallel_block_size - 1) / parallel_block_size;
+}
+
+/**
+ * Splits [0, size) in consecutive blocks of fixed size and calls `f(block, begin, end)` on them in parallel.
+ * As the blocks do not depend on the number of threads, values accumulated per block
+ * and combined in block order are the same from one run to another.
+ */
+template<class Function>
+void parallel_for_each_block(std::size_t size, const Function& f)
+{
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, number_of_parallel_blocks(size), 1),
+                    [&](const tbb::blocked_range<std::size_t>& r) {
+    for(std::size_t block = r.begin(); block != r.end(); ++block) {
+      f(block, block * parallel_block_size, (std::min)(size, (block + 1) * parallel_block_size));
+    }
+  });
+}
+
+}//namespace internal
+}//namespace Segmentation
+#endif
+
 namespace internal
 {
 
@@ -173,6 +214,12 @@ public:
   }
 
   bool calculate_new_center(std::vector<K_means_center>& centers);
+
+  /**
+   * Finds closest center without adding the point to it.
+   * @return true if #center_id is changed
+   */
+  bool update_closest_center(const std::vector<K_means_center>& centers);
 };
 
 /**
@@ -210,6 +257,15 @@ public:
     ++new_number_of_points;
     new_mean += data;
   }
+  /**
+    * Adds several points at once.
+    * @param sum sum of the locations of the points
+    * @param number_of_points
+    */
+  void add_points(double sum, std::size_t number_of_points) {
+    new_number_of_points += number_of_points;
+    new_mean += sum;
+  }
   /**
     * Called after every point is registered to its closest center
     * @see add_point()
@@ -244,6 +300,14 @@ public:
 */
 inline bool K_means_point::calculate_new_center(std::vector<K_means_center>&
     centers)
+{
+  bool is_center_changed = update_closest_center(centers);
+  centers[center_id].add_point(data);
+  return is_center_changed;
+}
+
+inline bool K_means_point::update_closest_center(const std::vector<K_means_center>&
+    centers)
 {
   std::size_t new_center_id = 0;
   double min_distance = std::abs(centers[0].mean - data);
@@ -256,8 +320,6 @@ inline bool K_means_point::calculate_new_center(std::vector<K_means_center>&
   }
   bool is_center_changed = (new_center_id != center_id);
   center_id = new_center_id;
-
-  centers[center_id].add_point(data);
   return is_center_changed;
 }
 
@@ -303,15 +365,35 @@ public:
                      Initialization_types init_type = PLUS_INITIALIZATION,
                      std::size_t number_of_run = CGAL_DEFAULT_NUMBER_OF_RUN,
                      std::size_t maximum_iteration = CGAL_DEFAULT_MAXIMUM_ITERATION)
+    : K_means_clustering(Sequential_tag(), number_of_centers, data, init_type,
+                         number_of_run, maximum_iteration) {
+  }
+
+  /**
+   * Same as above, the points being assigned to their closest centers in parallel with `Parallel_tag`.
+   * The runs and the initializations are still sequential, so that the centers found
+   * only differ from the sequential ones by rounding errors.
+   */
+  template<class ConcurrencyTag>
+  K_means_clustering(ConcurrencyTag,
+                     std::size_t number_of_centers,
+                     const std::vector<double>& data,
+                     Initialization_types init_type = PLUS_INITIALIZATION,
+                     std::size_t number_of_run = CGAL_DEFAULT_NUMBER_OF_RUN,
+                     std::size_t maximum_iteration = CGAL_DEFAULT_MAXIMUM_ITERATION)
     :
     points(data.begin(), data.end()),
     maximum_iteration(maximum_iteration),
     init_type(init_type),
     random(CGAL_DEFAULT_SEED) {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
     CGAL_precondition(data.size() >= number_of_centers
                       && "Number of centers can not be more than number of data.");
 
-    calculate_clustering_with_multiple_run(number_of_centers, number_of_run);
+    calculate_clustering_with_multiple_run<ConcurrencyTag>(number_of_centers, number_of_run);
     sort(centers.begin(), centers.end());
   }
 
@@ -319,7 +401,21 @@ public:
    * Fills data_center by the id of the closest center for each point.
    * @param[out] data_centers
    */
+  template<class ConcurrencyTag = Sequential_tag>
   void fill_with_center_ids(std::vector<std::size_t>& data_centers) {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      data_centers.resize(points.size());
+      Segmentation::internal::parallel_for_each_block(points.size(),
+                                                      [&](std::size_t, std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i) {
+          points[i].update_closest_center(centers);
+          data_centers[i] = points[i].center_id;
+        }
+      });
+      return;
+    }
+#endif
     data_centers.reserve(points.size());
     for(std::vector<K_means_point>::iterator point_it = points.begin();
         point_it != points.end(); ++point_it) {
@@ -360,7 +456,13 @@ private:
    * One iteration of k-means algorithm.
    * @return true if any closest center to a point is changed
    */
+  template<class ConcurrencyTag>
   bool iterate() {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      return parallel_iterate();
+    }
+#endif
     bool any_center_changed = false;
     // For each point, calculate its new center
     for(std::vector<K_means_point>::iterator point_it = points.begin();
@@ -376,15 +478,48 @@ private:
     return any_center_changed;
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  bool parallel_iterate() {
+    // sums and numbers of points of each center, per block
+    const std::size_t number_of_blocks = Segmentation::internal::number_of_parallel_blocks(points.size());
+    std::vector<double> sums(number_of_blocks * centers.size(), 0.0);
+    std::vector<std::size_t> counts(number_of_blocks * centers.size(), 0);
+    std::vector<char> changed(number_of_blocks, false);
+
+    Segmentation::internal::parallel_for_each_block(points.size(),
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+      for(std::size_t i = begin; i < end; ++i) {
+        changed[block] |= points[i].update_closest_center(centers);
+        sums[block * centers.size() + points[i].center_id] += points[i].data;
+        ++counts[block * centers.size() + points[i].center_id];
+      }
+    });
+
+    bool any_center_changed = false;
+    for(std::size_t block = 0; block < number_of_blocks; ++block) {
+      any_center_changed |= bool(changed[block]);
+      for(std::size_t i = 0; i < centers.size(); ++i) {
+        centers[i].add_points(sums[block * centers.size() + i], counts[block * centers.size() + i]);
+      }
+    }
+    for(std::vector<K_means_center>::iterator center_it = centers.begin();
+        center_it != centers.end(); ++center_it) {
+      center_it->calculate_mean();
+    }
+    return any_center_changed;
+  }
+#endif
+
   /**
    * Main entry point for k-means algorithm.
    * Iterates until convergence occurs (i.e. no point changes its center) or maximum iteration limit is reached.
    */
+  template<class ConcurrencyTag>
   void calculate_clustering() {
     std::size_t iteration_count = 0;
     bool any_center_changed = true;
     while(any_center_changed && iteration_count++ < maximum_iteration) {
-      any_center_changed = iterate();
+      any_center_changed = iterate<ConcurrencyTag>();
     }
   }
 
@@ -395,6 +530,7 @@ private:
    * @param number_of_run
    * @see calculate_clustering(), within_cluster_sum_of_squares()
    */
+  template<class ConcurrencyTag>
   void calculate_clustering_with_multiple_run(std::size_t number_of_centers,
       std::size_t number_of_run) {
     std::vector<K_means_center> min_centers;
@@ -403,8 +539,8 @@ private:
       init_type == RANDOM_INITIALIZATION ? initiate_centers_randomly(
         number_of_centers)
       : initiate_centers_plus_plus(number_of_centers);
-      calculate_clustering();
-      double new_error = within_cluster_sum_of_squares();
+      calculate_clustering<ConcurrencyTag>();
+      double new_error = within_cluster_sum_of_squares<ConcurrencyTag>();
       if(error > new_error) {
         error = new_error;
         min_centers = centers;
@@ -418,7 +554,25 @@ private:
   /**
    * Sum of squared distances between each point and the closest center to it.
    */
+  template<class ConcurrencyTag>
   double within_cluster_sum_of_squares() const {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      const std::size_t number_of_blocks = Segmentation::internal::number_of_parallel_blocks(points.size());
+      std::vector<double> sums(number_of_blocks, 0.0);
+      Segmentation::internal::parallel_for_each_block(points.size(),
+          [&](std::size_t block, std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i) {
+          sums[block] += CGAL::square(centers[points[i].center_id].mean - points[i].data);
+        }
+      });
+      double sum = 0.0;
+      for(std::size_t block = 0; block < number_of_blocks; ++block) {
+        sum += sums[block];
+      }
+      return sum;
+    }
+#endif
     double sum = 0.0;
     for(std::vector<K_means_point>::const_iterator point_it = points.begin();
         point_it != points.end(); ++point_it) {
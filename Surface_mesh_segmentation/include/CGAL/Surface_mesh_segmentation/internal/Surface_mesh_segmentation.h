@@ -245,7 +245,7 @@ public:
   }
 
 // Use these two functions together
-  template <class SDFPropertyMap>
+  template <class ConcurrencyTag = Sequential_tag, class SDFPropertyMap>
   std::pair<double, double>
   calculate_sdf_values(double cone_angle, std::size_t number_of_rays,
                        SDFPropertyMap sdf_pmap, bool postprocess_req) {
@@ -254,8 +254,8 @@ public:
                                          false, /* build_kd_ree */
                                          true, /* use_diagonal --> set to false to use `AABB_tree::first_intersection()` */
                                          traits);
-    sdf_calculator.calculate_sdf_values(faces(mesh).first, faces(mesh).second,
-                                        cone_angle, number_of_rays, sdf_pmap);
+    sdf_calculator.template calculate_sdf_values<ConcurrencyTag>(faces(mesh).first, faces(mesh).second,
+                                                                 cone_angle, number_of_rays, sdf_pmap);
 
     Postprocess_sdf_values<Polyhedron> p;
     return postprocess_req ? p.template postprocess<Filter>(mesh,
@@ -263,7 +263,7 @@ public:
            p.min_max_value(mesh, sdf_pmap);
   }
 
-  template <class FacetSegmentMap, class SDFPropertyMap>
+  template <class ConcurrencyTag = Sequential_tag, class FacetSegmentMap, class SDFPropertyMap>
   std::size_t partition(std::size_t number_of_centers, double smoothing_lambda,
                         SDFPropertyMap sdf_pmap, FacetSegmentMap segment_pmap,
                         bool clusters_to_segments) {
@@ -276,14 +276,14 @@ public:
     log_normalize_sdf_values(sdf_pmap, sdf_values);
 
     // soft clustering using GMM-fitting initialized with k-means
-    Expectation_maximization fitter(number_of_centers, sdf_values,
+    Expectation_maximization fitter(ConcurrencyTag(), number_of_centers, sdf_values,
                                     Expectation_maximization::K_MEANS_INITIALIZATION, 1);
 
     std::vector<std::size_t> labels;
-    fitter.fill_with_center_ids(labels);
+    fitter.fill_with_center_ids<ConcurrencyTag>(labels);
 
     std::vector<std::vector<double> > probability_matrix;
-    fitter.fill_with_probabilities(probability_matrix);
+    fitter.fill_with_probabilities<ConcurrencyTag>(probability_matrix);
     log_normalize_probability_matrix(probability_matrix);
 
     // calculating edge weights
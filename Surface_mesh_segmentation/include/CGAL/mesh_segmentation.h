@@ -24,13 +24,16 @@
 #include <CGAL/boost/graph/helpers.h>
 #include <boost/config.hpp>
 #include <CGAL/Kernel/global_functions_3.h>
+#include <CGAL/tags.h>
+
+#include <map>
 
 namespace CGAL
 {
 
 
 /// @cond SKIP_IN_MANUAL
-template <bool Fast_sdf_calculation_mode, class TriangleMesh,
+template <bool Fast_sdf_calculation_mode, class ConcurrencyTag = Sequential_tag, class TriangleMesh,
          class SDFPropertyMap,
          class PointPropertyMap
 #ifdef DOXYGEN_RUNNING
@@ -53,8 +56,8 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef PointPropertyMap VPMap;
   internal::Surface_mesh_segmentation<TriangleMesh, GeomTraits, VPMap, Fast_sdf_calculation_mode>
     algorithm(triangle_mesh, traits, ppmap);
-  return algorithm.calculate_sdf_values(cone_angle, number_of_rays,
-                                        sdf_values_map, postprocess);
+  return algorithm.template calculate_sdf_values<ConcurrencyTag>(cone_angle, number_of_rays,
+                                                                 sdf_values_map, postprocess);
 }
 /// @endcond
 
@@ -66,8 +69,12 @@ sdf_values( const TriangleMesh& triangle_mesh,
  * It is possible to compute raw SDF values (without post-processing). In such a case,
  * -1 is used to indicate when no SDF value could be computed for a facet.
  *
+ * With `Parallel_tag`, the cones of rays of the facets are cast concurrently, and the raw SDF values
+ * are the same as the sequential ones.
+ *
  * @pre `is_triangle_mesh(triangle_mesh)`
  *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag` (default), `Parallel_tag`, and `Parallel_if_available_tag`.
  * @tparam TriangleMesh a model of `FaceListGraph`
  * @tparam SDFPropertyMap  a `ReadWritePropertyMap` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as key and `double` as value type
  * @tparam GeomTraits a model of `SegmentationGeomTraits`
@@ -83,7 +90,7 @@ sdf_values( const TriangleMesh& triangle_mesh,
  *
  * @return minimum and maximum raw SDF values if  `postprocess` is `true`, otherwise minimum and maximum SDF values (before linear normalization)
  */
-template <class TriangleMesh, class SDFPropertyMap, class PointPropertyMap
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap
 #ifdef DOXYGEN_RUNNING
          = typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type
 #endif
@@ -101,7 +108,7 @@ sdf_values( const TriangleMesh& triangle_mesh,
             PointPropertyMap ppmap = PointPropertyMap(),
             GeomTraits traits = GeomTraits())
 {
-  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<true, ConcurrencyTag, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
@@ -157,9 +164,14 @@ sdf_values_postprocessing(const TriangleMesh& triangle_mesh,
  * \note There is no direct relation between the parameter `number_of_clusters`
  * and the final number of segments after segmentation. However, setting a large number of clusters will result in a detailed segmentation of the mesh with a large number of segments.
  *
+ * With `Parallel_tag`, the k-means and expectation-maximization steps of the soft clustering process
+ * the SDF values concurrently, and the clusters may only differ from the sequential ones because of
+ * rounding errors in the sums.
+ *
  * @pre `is_triangle_mesh(triangle_mesh)`
  * @pre `number_of_clusters > 0`
  *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag` (default), `Parallel_tag`, and `Parallel_if_available_tag`.
  * @tparam TriangleMesh a model of `FaceListGraph`
  * @tparam SDFPropertyMap  a `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as key and `double` as value type
  * @tparam SegmentPropertyMap a `ReadWritePropertyMap` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as key and `std::size_t` as value type
@@ -177,7 +189,7 @@ sdf_values_postprocessing(const TriangleMesh& triangle_mesh,
  *
  * @return number of segments if `output_cluster_ids` is set to `false` and `number_of_clusters` otherwise
  */
-template <class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap,
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap,
           class PointPropertyMap
 #ifdef DOXYGEN_RUNNING
          = typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type
@@ -198,12 +210,12 @@ segmentation_from_sdf_values( const TriangleMesh& triangle_mesh,
                               GeomTraits traits=GeomTraits())
 {
   internal::Surface_mesh_segmentation<TriangleMesh, GeomTraits, PointPropertyMap> algorithm(triangle_mesh, traits, ppmap);
-  return algorithm.partition(number_of_clusters, smoothing_lambda, sdf_values_map,
-                             segment_ids, !output_cluster_ids);
+  return algorithm.template partition<ConcurrencyTag>(number_of_clusters, smoothing_lambda, sdf_values_map,
+                                                      segment_ids, !output_cluster_ids);
 }
 
 ///\cond SKIP_IN_MANUAL
-template < bool Fast_sdf_calculation_mode, class TriangleMesh,
+template <bool Fast_sdf_calculation_mode, class ConcurrencyTag = Sequential_tag, class TriangleMesh,
          class SegmentPropertyMap, class PointPropertyMap
 #ifdef DOXYGEN_RUNNING
          = typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type
@@ -231,9 +243,9 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
   boost::associative_property_map<Facet_double_map> sdf_property_map(
     internal_sdf_map);
 
-  sdf_values<Fast_sdf_calculation_mode, TriangleMesh, boost::associative_property_map<Facet_double_map>, PointPropertyMap, GeomTraits>
+  sdf_values<Fast_sdf_calculation_mode, ConcurrencyTag, TriangleMesh, boost::associative_property_map<Facet_double_map>, PointPropertyMap, GeomTraits>
   (triangle_mesh, sdf_property_map, cone_angle, number_of_rays, true, ppmap, traits);
-  return segmentation_from_sdf_values<TriangleMesh, boost::associative_property_map<Facet_double_map>, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_from_sdf_values<ConcurrencyTag, TriangleMesh, boost::associative_property_map<Facet_double_map>, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_property_map, segment_ids, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
@@ -256,6 +268,7 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
  * @pre `is_triangle_mesh(triangle_mesh)`
  * @pre `number_of_clusters > 0`
  *
+ * @tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag` (default), `Parallel_tag`, and `Parallel_if_available_tag`.
  * @tparam TriangleMesh a model of `FaceListGraph`
  * @tparam SegmentPropertyMap a `ReadWritePropertyMap` with `boost::graph_traits<TriangleMesh>::%face_descriptor` as key and `std::size_t` as value type
  * @tparam GeomTraits a model of `SegmentationGeomTraits`
@@ -273,7 +286,7 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
  *
  * @return number of segments if `output_cluster_ids` is set to `false` and `number_of_clusters` otherwise
  */
-template < class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap
 #ifdef DOXYGEN_RUNNING
          = typename boost::property_map<TriangleMesh, boost::vertex_point_t>::type
 #endif
@@ -293,7 +306,7 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
                             PointPropertyMap ppmap=PointPropertyMap(),
                             GeomTraits traits=GeomTraits())
 {
-  return segmentation_via_sdf_values<true, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_via_sdf_values<true, ConcurrencyTag, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, segment_ids, cone_angle, number_of_rays, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
@@ -302,7 +315,7 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
 // we need these overloads for the default of the point property map
 
 /// sdf_values ///
-template < bool Fast_sdf_calculation_mode, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
+template <bool Fast_sdf_calculation_mode, class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
             SDFPropertyMap sdf_values_map,
@@ -314,11 +327,11 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return sdf_values<Fast_sdf_calculation_mode, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<Fast_sdf_calculation_mode, ConcurrencyTag, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
-template < bool Fast_sdf_calculation_mode, class TriangleMesh, class SDFPropertyMap>
+template <bool Fast_sdf_calculation_mode, class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap>
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
             SDFPropertyMap sdf_values_map,
@@ -331,11 +344,11 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return sdf_values<Fast_sdf_calculation_mode, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<Fast_sdf_calculation_mode, ConcurrencyTag, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
-template < class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap, class PointPropertyMap>
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
             SDFPropertyMap sdf_values_map,
@@ -347,11 +360,11 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<true, ConcurrencyTag, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
-template < class TriangleMesh, class SDFPropertyMap>
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap>
 std::pair<double, double>
 sdf_values( const TriangleMesh& triangle_mesh,
             SDFPropertyMap sdf_values_map,
@@ -364,12 +377,12 @@ sdf_values( const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return sdf_values<true, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
+  return sdf_values<true, ConcurrencyTag, TriangleMesh, SDFPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, cone_angle, number_of_rays, postprocess, ppmap, traits);
 }
 
 /// segmentation_from_sdf_values ///
-template <class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap, class PointPropertyMap>
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap, class PointPropertyMap>
 std::size_t
 segmentation_from_sdf_values(const TriangleMesh& triangle_mesh,
                              SDFPropertyMap sdf_values_map,
@@ -382,12 +395,12 @@ segmentation_from_sdf_values(const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return segmentation_from_sdf_values<TriangleMesh, SDFPropertyMap, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_from_sdf_values<ConcurrencyTag, TriangleMesh, SDFPropertyMap, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, segment_ids, number_of_clusters, smoothing_lambda,
           output_cluster_ids, ppmap, traits);
 }
 
-template <class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap>
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SDFPropertyMap, class SegmentPropertyMap>
 std::size_t
 segmentation_from_sdf_values(const TriangleMesh& triangle_mesh,
                              SDFPropertyMap sdf_values_map,
@@ -401,13 +414,13 @@ segmentation_from_sdf_values(const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return segmentation_from_sdf_values<TriangleMesh, SDFPropertyMap, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_from_sdf_values<ConcurrencyTag, TriangleMesh, SDFPropertyMap, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, sdf_values_map, segment_ids, number_of_clusters, smoothing_lambda,
           output_cluster_ids, ppmap, traits);
 }
 
 /// segmentation_via_sdf_values ///
-template <bool Fast_sdf_calculation_mode, class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap>
+template <bool Fast_sdf_calculation_mode, class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap>
 std::size_t
 segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
                             SegmentPropertyMap segment_ids,
@@ -421,12 +434,12 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return segmentation_via_sdf_values<Fast_sdf_calculation_mode, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_via_sdf_values<Fast_sdf_calculation_mode, ConcurrencyTag, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, segment_ids, cone_angle, number_of_rays, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
 
-template <bool Fast_sdf_calculation_mode, class TriangleMesh, class SegmentPropertyMap>
+template <bool Fast_sdf_calculation_mode, class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SegmentPropertyMap>
 std::size_t
 segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
                             SegmentPropertyMap segment_ids,
@@ -441,12 +454,12 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return segmentation_via_sdf_values<Fast_sdf_calculation_mode, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_via_sdf_values<Fast_sdf_calculation_mode, ConcurrencyTag, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, segment_ids, cone_angle, number_of_rays, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
 
-template <class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap>
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SegmentPropertyMap, class PointPropertyMap>
 std::size_t
 segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
                             SegmentPropertyMap segment_ids,
@@ -460,12 +473,12 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return segmentation_via_sdf_values<true, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_via_sdf_values<true, ConcurrencyTag, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, segment_ids, cone_angle, number_of_rays, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
 
-template <class TriangleMesh, class SegmentPropertyMap>
+template <class ConcurrencyTag = Sequential_tag, class TriangleMesh, class SegmentPropertyMap>
 std::size_t
 segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
                             SegmentPropertyMap segment_ids,
@@ -480,7 +493,7 @@ segmentation_via_sdf_values(const TriangleMesh& triangle_mesh,
   typedef typename boost::property_traits<PointPropertyMap>::value_type Point_3;
   typedef typename Kernel_traits<Point_3>::Kernel GeomTraits;
   GeomTraits traits;
-  return segmentation_via_sdf_values<true, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
+  return segmentation_via_sdf_values<true, ConcurrencyTag, TriangleMesh, SegmentPropertyMap, PointPropertyMap, GeomTraits>
          (triangle_mesh, segment_ids, cone_angle, number_of_rays, number_of_clusters,
           smoothing_lambda, output_cluster_ids, ppmap, traits);
 }
@@ -0,0 +1,104 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/mesh_segmentation.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef CGAL::Surface_mesh<Kernel::Point_3> Mesh;
+typedef boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+
+typedef Mesh::Property_map<face_descriptor, double> Facet_double_map;
+typedef Mesh::Property_map<face_descriptor, std::size_t> Facet_int_map;
+
+/**
+ * Compares the SDF values and the segmentation computed with `ConcurrencyTag`
+ * with the ones computed by the sequential functions.
+ */
+template <class ConcurrencyTag>
+bool test_segmentation(Mesh& mesh)
+{
+  Facet_double_map expected_sdf = mesh.add_property_map<face_descriptor, double>("f:expected_sdf").first;
+  Facet_double_map sdf = mesh.add_property_map<face_descriptor, double>("f:sdf").first;
+  Facet_int_map expected_segments = mesh.add_property_map<face_descriptor, std::size_t>("f:expected_segments").first;
+  Facet_int_map segments = mesh.add_property_map<face_descriptor, std::size_t>("f:segments").first;
+  bool ok = true;
+
+  // the cones of the facets are independent, raw values must be identical
+  CGAL::sdf_values(mesh, expected_sdf, 2.0 / 3.0 * CGAL_PI, 25, false);
+  CGAL::sdf_values<ConcurrencyTag>(mesh, sdf, 2.0 / 3.0 * CGAL_PI, 25, false);
+  for(face_descriptor f : faces(mesh)) {
+    if(get(sdf, f) != get(expected_sdf, f)) {
+      std::cerr << "Raw SDF values are different." << std::endl;
+      ok = false;
+      break;
+    }
+  }
+
+  std::pair<double, double> expected_min_max = CGAL::sdf_values(mesh, expected_sdf);
+  std::pair<double, double> min_max = CGAL::sdf_values<ConcurrencyTag>(mesh, sdf);
+  if(min_max != expected_min_max) {
+    std::cerr << "Post-processed SDF values are different." << std::endl;
+    ok = false;
+  }
+
+  // the sums of the clustering might only differ by rounding errors
+  std::size_t expected_nb_segments = CGAL::segmentation_from_sdf_values(mesh, expected_sdf, expected_segments);
+  std::size_t nb_segments = CGAL::segmentation_from_sdf_values<ConcurrencyTag>(mesh, sdf, segments);
+  if(nb_segments != expected_nb_segments || nb_segments != 3) {
+    std::cerr << "Number of segments should be 3 for cactus model, got "
+              << nb_segments << " and " << expected_nb_segments << std::endl;
+    ok = false;
+  }
+  for(face_descriptor f : faces(mesh)) {
+    if(get(segments, f) != get(expected_segments, f)) {
+      std::cerr << "Segment ids are different." << std::endl;
+      ok = false;
+      break;
+    }
+  }
+
+  nb_segments = CGAL::segmentation_via_sdf_values<ConcurrencyTag>(mesh, segments);
+  if(nb_segments != expected_nb_segments) {
+    std::cerr << "Number of segments of segmentation_via_sdf_values() is different." << std::endl;
+    ok = false;
+  }
+
+  mesh.remove_property_map(expected_sdf);
+  mesh.remove_property_map(sdf);
+  mesh.remove_property_map(expected_segments);
+  mesh.remove_property_map(segments);
+  return ok;
+}
+
+int main(void)
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/cactus.off"));
+  if(!input || !(input >> mesh)) {
+    std::cerr << "Problem occurred while reading off file" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if(!test_segmentation<CGAL::Sequential_tag>(mesh)) { return EXIT_FAILURE; }
+  if(!test_segmentation<CGAL::Parallel_if_available_tag>(mesh)) { return EXIT_FAILURE; }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // process the facets and the SDF values concurrently, whatever the number of cores
+  tbb::task_arena arena(4);
+  bool ok = true;
+  arena.execute([&]{ ok = test_segmentation<CGAL::Parallel_tag>(mesh); });
+  if(!ok) { return EXIT_FAILURE; }
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
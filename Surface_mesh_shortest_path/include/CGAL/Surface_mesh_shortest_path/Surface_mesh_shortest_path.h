@@ -22,9 +22,17 @@
 #include <CGAL/AABB_tree.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/boost/graph/iterator.h>
+#include <CGAL/Compact_container.h>
 #include <CGAL/Default.h>
 #include <CGAL/enum.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
 
 #include <boost/lexical_cast.hpp>
 #include <boost/variant/get.hpp>
@@ -284,9 +292,7 @@ private:
   typedef Surface_mesh_shortest_paths_3::internal::Cone_tree_node<Traits> Cone_tree_node;
   typedef Surface_mesh_shortest_paths_3::internal::Cone_expansion_event<Traits> Cone_expansion_event;
 
-  typedef std::priority_queue<Cone_expansion_event*,
-                              std::vector<Cone_expansion_event*>,
-                              Surface_mesh_shortest_paths_3::internal::Cone_expansion_event_min_priority_queue_comparator<Traits> > Expansion_priqueue;
+  typedef Surface_mesh_shortest_paths_3::internal::Cone_expansion_event_priority_queue<Traits> Expansion_priqueue;
   typedef std::pair<Cone_tree_node*, FT> Node_distance_pair;
 
 private:
@@ -343,7 +349,13 @@ private:
 
   std::vector<std::vector<Cone_tree_node*> > m_faceOccupiers;
 
+  // The nodes and the events are allocated in blocks, which are reused from one
+  // build of the sequence tree to the next and released all at once
+  Compact_container<Cone_tree_node> m_nodes;
+  Compact_container<Cone_expansion_event> m_events;
+
   Expansion_priqueue m_expansionPriqueue;
+  std::size_t m_prunedQueueSize;
 
 #if !defined(NDEBUG)
   std::size_t m_currentNodeCount;
@@ -421,6 +433,23 @@ public:
 
 private:
 
+  template <class... Args>
+  Cone_tree_node* new_node(const Args&... args)
+  {
+    return &*m_nodes.emplace(args...);
+  }
+
+  template <class... Args>
+  Cone_expansion_event* new_event(const Args&... args)
+  {
+    return &*m_events.emplace(args...);
+  }
+
+  void release_event(Cone_expansion_event* event)
+  {
+    m_events.erase(m_events.iterator_to(*event));
+  }
+
   void node_created()
   {
 #if !defined(NDEBUG)
@@ -435,6 +464,14 @@ private:
 
   void queue_pushed()
   {
+    // Cancelled events stay in the queue until they reach its top: remove them
+    // each time the queue doubles in size, so that it only grows with live events
+    if (m_expansionPriqueue.size() >= 2 * m_prunedQueueSize)
+    {
+      m_expansionPriqueue.remove_cancelled_events([this](Cone_expansion_event* event) { release_event(event); });
+      m_prunedQueueSize = (std::max)(m_expansionPriqueue.size(), std::size_t(512));
+    }
+
 #if !defined(NDEBUG)
     if (m_expansionPriqueue.size() > m_peakQueueSize)
     {
@@ -655,7 +692,7 @@ private:
     {
       Triangle_3 adjacentFace = triangle_from_halfedge(cone->left_child_edge());
       Triangle_2 layoutFace = ft3as2(adjacentFace, 0, cone->left_child_base_segment());
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph, cone->left_child_edge(), layoutFace,
+      Cone_tree_node* child = new_node(m_traits, m_graph, cone->left_child_edge(), layoutFace,
                                                  cone->source_image(), cone->distance_from_source_to_root(),
                                                  cv2(windowSegment, 0), cv2(windowSegment, 1),
                                                  Cone_tree_node::INTERVAL);
@@ -690,7 +727,7 @@ private:
     {
       Triangle_3 adjacentFace = triangle_from_halfedge(cone->right_child_edge());
       Triangle_2 layoutFace = ft3as2(adjacentFace, 0, cone->right_child_base_segment());
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph, cone->right_child_edge(), layoutFace,
+      Cone_tree_node* child = new_node(m_traits, m_graph, cone->right_child_edge(), layoutFace,
                                                  cone->source_image(), cone->distance_from_source_to_root(),
                                                  cv2(windowSegment, 0), cv2(windowSegment, 1),
                                                  Cone_tree_node::INTERVAL);
@@ -763,7 +800,7 @@ private:
     const halfedge_descriptor start = halfedge(f, m_graph);
     halfedge_descriptor current = start;
 
-    Cone_tree_node* faceRoot = new Cone_tree_node(m_traits, m_graph, m_rootNodes.size());
+    Cone_tree_node* faceRoot = new_node(m_traits, m_graph, m_rootNodes.size());
     node_created();
     m_rootNodes.emplace_back(faceRoot, sourcePointIt);
 
@@ -784,7 +821,7 @@ private:
       const Barycentric_coordinates rotatedFaceLocation(shifted_coordinates(faceLocation, currentVertex));
       const Point_2 sourcePoint(construct_barycenter_in_triangle_2(layoutFace, rotatedFaceLocation));
 
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph,
+      Cone_tree_node* child = new_node(m_traits, m_graph,
                                                  current /*entryEdge*/,
                                                  layoutFace, sourcePoint,
                                                  FT(0) /*pseudoSourceDistance*/,
@@ -830,7 +867,7 @@ private:
       std::cout << "\t\tBoundary: " << is_border_edge(baseEdge, m_graph) << std::endl;
     }
 
-    Cone_tree_node* edgeRoot = new Cone_tree_node(m_traits, m_graph, m_rootNodes.size());
+    Cone_tree_node* edgeRoot = new_node(m_traits, m_graph, m_rootNodes.size());
     node_created();
     m_rootNodes.emplace_back(edgeRoot, sourcePointIt);
 
@@ -892,7 +929,7 @@ private:
         std::cout << "\t\tLocation = " << sourcePoint << std::endl;
       }
 
-      Cone_tree_node* v2_Child = new Cone_tree_node(m_traits, m_graph,
+      Cone_tree_node* v2_Child = new_node(m_traits, m_graph,
                                                     baseEdges[side] /*entryEdge*/,
                                                     layoutFace,
                                                     sourcePoint /*sourceImage*/,
@@ -925,7 +962,7 @@ private:
         std::cout << "\t\tLocation = " << sourcePoint << std::endl;
       }
 
-      Cone_tree_node* v1_Child = new Cone_tree_node(m_traits, m_graph,
+      Cone_tree_node* v1_Child = new_node(m_traits, m_graph,
                                                     prev(baseEdges[side], m_graph) /*entryEdge*/,
                                                     layoutFace,
                                                     sourcePoint /*sourceImage*/,
@@ -951,7 +988,7 @@ private:
       std::cout << "\tVertex Root Expansion: Vertex = " << get(m_vertexIndexMap, vertex) << std::endl;
     }
 
-    Cone_tree_node* vertexRoot = new Cone_tree_node(m_traits, m_graph, m_rootNodes.size(),
+    Cone_tree_node* vertexRoot = new_node(m_traits, m_graph, m_rootNodes.size(),
                                                     prev(halfedge(vertex, m_graph), m_graph));
 
     node_created();
@@ -1022,7 +1059,7 @@ private:
         }
       }
 
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph, currentEdge /*entryEdge*/,
+      Cone_tree_node* child = new_node(m_traits, m_graph, currentEdge /*entryEdge*/,
                                                  layoutFace, cv2(layoutFace, 1) /*sourceImage*/,
                                                  distanceFromTargetToRoot,
                                                  cv2(layoutFace, 0) /*windowLeft*/,
@@ -1536,7 +1573,7 @@ private:
                   << " , clipped = " << leftWindow << " , Estimate = " << distanceEstimate << std::endl;
       }
 
-      Cone_expansion_event* event = new Cone_expansion_event(parent, distanceEstimate,
+      Cone_expansion_event* event = new_event(parent, distanceEstimate,
                                                              Cone_expansion_event::LEFT_CHILD, leftWindow);
       parent->m_pendingLeftSubtree = event;
 
@@ -1581,7 +1618,7 @@ private:
                   << " , clipped = " << rightWindow << " , Estimate = " << distanceEstimate << std::endl;
       }
 
-      Cone_expansion_event* event = new Cone_expansion_event(parent, distanceEstimate,
+      Cone_expansion_event* event = new_event(parent, distanceEstimate,
                                                              Cone_expansion_event::RIGHT_CHILD, rightWindow);
       parent->m_pendingRightSubtree = event;
 
@@ -1597,15 +1634,14 @@ private:
       std::cout << ">>> Pushing Middle Child, Estimate = " << parent->distance_from_target_to_root() << std::endl;
     }
 
-    Cone_expansion_event* event = new Cone_expansion_event(parent, parent->distance_from_target_to_root(), Cone_expansion_event::PSEUDO_SOURCE);
+    Cone_expansion_event* event = new_event(parent, parent->distance_from_target_to_root(), Cone_expansion_event::PSEUDO_SOURCE);
     parent->m_pendingMiddleSubtree = event;
 
     m_expansionPriqueue.push(event);
     queue_pushed();
   }
 
-  void delete_node(Cone_tree_node* node,
-                   const bool destruction = false)
+  void delete_node(Cone_tree_node* node)
   {
     if (node != nullptr)
     {
@@ -1627,7 +1663,7 @@ private:
           std::cout << "\t"  << node << " Descending left." << std::endl;
         }
 
-        delete_node(node->remove_left_child(), destruction);
+        delete_node(node->remove_left_child());
       }
 
       if (node->m_pendingRightSubtree != nullptr)
@@ -1643,7 +1679,7 @@ private:
           std::cout << "\t"  << node << " Descending right." << std::endl;
         }
 
-        delete_node(node->remove_right_child(), destruction);
+        delete_node(node->remove_right_child());
       }
 
       if (node->m_pendingMiddleSubtree != nullptr)
@@ -1659,13 +1695,10 @@ private:
 
       while (node->has_middle_children())
       {
-        delete_node(node->pop_middle_child(), destruction);
+        delete_node(node->pop_middle_child());
       }
 
-      // At the point of destruction, the `Triangle_mesh` referenced may have gone out of scope,
-      // we wish to distinguish between deletion with an assumed reference
-      // to the original `Triangle_mesh`, and deletion without
-      if (!node->is_root_node() && !destruction)
+      if (!node->is_root_node())
       {
         std::size_t entryHalfEdgeIndex = get(m_halfedgeIndexMap, node->entry_edge());
 
@@ -1682,7 +1715,7 @@ private:
         }
       }
 
-      delete node;
+      m_nodes.erase(m_nodes.iterator_to(*node));
     }
 
     node_deleted();
@@ -1710,10 +1743,12 @@ private:
 
   void delete_all_nodes()
   {
-    for (std::size_t i = 0; i < m_rootNodes.size(); ++i)
-    {
-      delete_node(m_rootNodes[i].first, true);
-    }
+    // No need to walk the trees: the `Triangle_mesh` may have gone out of scope at destruction
+    m_nodes.clear();
+
+#if !defined(NDEBUG)
+    m_currentNodeCount = 0;
+#endif
   }
 
   void reset_algorithm(const bool clearFaceLocations = true)
@@ -1721,11 +1756,9 @@ private:
     m_closestToVertices.assign(num_vertices(m_graph), Node_distance_pair(nullptr, FT(-1)));
     m_vertexOccupiers.assign(num_halfedges(m_graph), Node_distance_pair(nullptr, FT(-1)));
 
-    while (!m_expansionPriqueue.empty())
-    {
-      delete m_expansionPriqueue.top();
-      m_expansionPriqueue.pop();
-    }
+    m_expansionPriqueue = Expansion_priqueue();
+    m_events.clear();
+    m_prunedQueueSize = 512;
 
     if (clearFaceLocations)
     {
@@ -2203,7 +2236,7 @@ private:
         std::cout << "Found cancelled event for node: " << event->m_parent << std::endl;
       }
 
-      delete event;
+      release_event(event);
     }
 
     m_faceOccupiers.clear();
@@ -2586,6 +2619,84 @@ public:
     }
   }
 
+  /*!
+  \brief Computes the shortest surface distance from each vertex to any source point
+
+  \details With `Parallel_tag`, the source points are split into as many groups as there
+  are threads, a sequence tree is built for each group in parallel, and the distance of
+  each vertex is the smallest distance over the groups. The internal sequence tree of
+  this object is then not built. Otherwise, this is equivalent to calling
+  `shortest_distance_to_source_points(v)` for each vertex `v`.
+
+  \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+                         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+  \tparam VertexDistanceMap a model of `WritablePropertyMap` with `vertex_descriptor` as key type and `FT` as value type.
+
+  \param vdm the property map receiving the distances. The distance of a vertex from which no
+    source point is reachable is a negative value.
+  */
+  template <class ConcurrencyTag = Sequential_tag, class VertexDistanceMap>
+  void shortest_distances_to_source_points(VertexDistanceMap vdm)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    const std::size_t nb_groups = (std::min)(m_faceLocations.size(),
+                                             std::size_t(tbb::this_task_arena::max_concurrency()));
+
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value && nb_groups > 1)
+    {
+      std::vector<Face_location> locations(m_faceLocations.begin(), m_faceLocations.end());
+      std::vector<std::vector<FT> > distances(nb_groups);
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_groups, 1),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for (std::size_t g = r.begin(); g != r.end(); ++g)
+        {
+          Surface_mesh_shortest_path group_shortest_path(m_graph, m_vertexIndexMap, m_halfedgeIndexMap,
+                                                         m_faceIndexMap, m_vertexPointMap, m_traits);
+          group_shortest_path.add_source_points(locations.begin() + (g * locations.size()) / nb_groups,
+                                                locations.begin() + ((g + 1) * locations.size()) / nb_groups);
+          group_shortest_path.build_sequence_tree();
+
+          distances[g].resize(num_vertices(m_graph));
+          for (vertex_descriptor v : vertices(m_graph))
+          {
+            const std::size_t vertexIndex = get(m_vertexIndexMap, v);
+            const Node_distance_pair& result = group_shortest_path.m_closestToVertices[vertexIndex];
+            distances[g][vertexIndex] = result.first != nullptr ? result.second : FT(-1);
+          }
+        }
+      });
+
+      for (vertex_descriptor v : vertices(m_graph))
+      {
+        FT distance(-1);
+        for (std::size_t g = 0; g < nb_groups; ++g)
+        {
+          const FT& group_distance = distances[g][get(m_vertexIndexMap, v)];
+          if (group_distance >= FT(0) && (distance < FT(0) || group_distance < distance))
+          {
+            distance = group_distance;
+          }
+        }
+        put(vdm, v, distance);
+      }
+      return;
+    }
+#endif
+
+    build_sequence_tree();
+
+    for (vertex_descriptor v : vertices(m_graph))
+    {
+      const Node_distance_pair& result = m_closestToVertices[get(m_vertexIndexMap, v)];
+      put(vdm, v, result.first != nullptr ? result.second : FT(-1));
+    }
+  }
+
   /// @}
 
   /// \name Shortest Path Sequence Queries
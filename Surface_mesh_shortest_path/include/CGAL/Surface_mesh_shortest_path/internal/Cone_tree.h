@@ -22,14 +22,17 @@
 #include <CGAL/Surface_mesh_shortest_path/internal/Cone_expansion_event.h>
 #include <CGAL/Surface_mesh_shortest_path/internal/misc_functions.h>
 
+#include <CGAL/Compact_container.h>
 #include <CGAL/number_utils.h>
 
 namespace CGAL {
 namespace Surface_mesh_shortest_paths_3 {
 namespace internal {
 
+// nodes are stored in a `Compact_container`, see `Surface_mesh_shortest_path`
 template<class Traits>
 class Cone_tree_node
+  : public Compact_container_base
 {
 public:
   enum Node_type
@@ -0,0 +1,88 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh_shortest_path.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+
+typedef CGAL::Surface_mesh<Kernel::Point_3> Triangle_mesh;
+typedef boost::graph_traits<Triangle_mesh>::vertex_descriptor vertex_descriptor;
+
+typedef CGAL::Surface_mesh_shortest_path_traits<Kernel, Triangle_mesh> Traits;
+typedef CGAL::Surface_mesh_shortest_path<Traits> Surface_mesh_shortest_path;
+
+typedef Triangle_mesh::Property_map<vertex_descriptor, double> Vertex_distance_map;
+
+// checks the distances to all the source points against the distances given vertex by vertex
+template <class ConcurrencyTag>
+void test_distances(Surface_mesh_shortest_path& shortest_paths,
+                    Triangle_mesh& mesh)
+{
+  Vertex_distance_map vdm = mesh.add_property_map<vertex_descriptor, double>("v:distance", -2.).first;
+  shortest_paths.shortest_distances_to_source_points<ConcurrencyTag>(vdm);
+
+  for (vertex_descriptor v : vertices(mesh))
+  {
+    const double expected = shortest_paths.shortest_distance_to_source_points(v).first;
+    assert(std::abs(get(vdm, v) - expected) <= 1e-9 * (1. + expected));
+    CGAL_USE(expected);
+  }
+
+  mesh.remove_property_map(vdm);
+}
+
+template <class ConcurrencyTag>
+void test_multiple_sources(Triangle_mesh& mesh)
+{
+  std::vector<vertex_descriptor> vds(vertices(mesh).begin(), vertices(mesh).end());
+
+  Surface_mesh_shortest_path shortest_paths(mesh);
+  test_distances<ConcurrencyTag>(shortest_paths, mesh);
+
+  shortest_paths.add_source_point(vds[0]);
+  test_distances<ConcurrencyTag>(shortest_paths, mesh);
+
+  for (std::size_t i = 1; i < 8; ++i)
+    shortest_paths.add_source_point(vds[(i * 71) % vds.size()]);
+  test_distances<ConcurrencyTag>(shortest_paths, mesh);
+
+  // the nodes of the previous tree are reused when building the tree again
+  shortest_paths.remove_source_point(shortest_paths.source_points_begin());
+  test_distances<ConcurrencyTag>(shortest_paths, mesh);
+
+  shortest_paths.clear();
+  shortest_paths.add_source_point(vds.back());
+  test_distances<ConcurrencyTag>(shortest_paths, mesh);
+}
+
+int main(int argc, char* argv[])
+{
+  Triangle_mesh mesh;
+  std::ifstream input((argc > 1) ? argv[1] : "data/heightmap_20x30.off");
+  input >> mesh;
+  input.close();
+
+  std::cout << "Input mesh: " << num_vertices(mesh) << " nv" << std::endl;
+
+  test_multiple_sources<CGAL::Sequential_tag>(mesh);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // split the source points between several threads, whatever the number of cores
+  tbb::task_arena arena(4);
+  arena.execute([&]{ test_multiple_sources<CGAL::Parallel_tag>(mesh); });
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
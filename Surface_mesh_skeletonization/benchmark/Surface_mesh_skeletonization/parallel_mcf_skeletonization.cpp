@@ -0,0 +1,73 @@
+// Times the extraction of the mean curvature flow skeleton of a mesh,
+// with the sequential and the parallel versions of `Mean_curvature_flow_skeletonization`.
+//
+// Usage: parallel_mcf_skeletonization [input mesh]
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Mean_curvature_flow_skeletonization.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+typedef CGAL::Simple_cartesian<double>                        Kernel;
+typedef Kernel::Point_3                                       Point;
+typedef CGAL::Surface_mesh<Point>                             Triangle_mesh;
+
+template <class ConcurrencyTag>
+std::size_t bench(const std::string& name, const Triangle_mesh& tmesh)
+{
+  typedef CGAL::Mean_curvature_flow_skeletonization<Triangle_mesh,
+                                                    CGAL::Default,
+                                                    CGAL::Default,
+                                                    CGAL::Default,
+                                                    ConcurrencyTag> Skeletonization;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Skeletonization mcs(tmesh);
+  typename Skeletonization::Skeleton skeleton;
+
+  // the first contraction also computes the Voronoi poles
+  mcs.contract();
+  double first_step = timer.time();
+  mcs.contract_until_convergence();
+  double contraction = timer.time();
+  mcs.convert_to_skeleton(skeleton);
+  timer.stop();
+
+  std::cout << name << " first contraction: " << first_step << " sec., "
+            << "convergence: " << contraction << " sec., "
+            << "total: " << timer.time() << " sec. ("
+            << num_vertices(skeleton) << " skeleton vertices)" << std::endl;
+  return num_vertices(skeleton);
+}
+
+int main(int argc, char* argv[])
+{
+  std::ifstream input((argc>1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off"));
+  Triangle_mesh tmesh;
+  if (!input || !(input >> tmesh) || tmesh.is_empty())
+  {
+    std::cerr << "Error: cannot read the input mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << num_faces(tmesh) << " faces" << std::endl;
+
+  std::size_t seq = bench<CGAL::Sequential_tag>("sequential", tmesh);
+#ifdef CGAL_LINKED_WITH_TBB
+  std::size_t par = bench<CGAL::Parallel_tag>("parallel  ", tmesh);
+  if (seq != par)
+  {
+    std::cerr << "Error: different results" << std::endl;
+    return EXIT_FAILURE;
+  }
+#else
+  CGAL_USE(seq);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,7 @@
 #include <CGAL/IO/trace.h>
 #include <CGAL/Timer.h>
 #include <CGAL/Default.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/HalfedgeDS_default.h>
 #include <CGAL/HalfedgeDS_vertex_max_base_with_id.h>
@@ -70,8 +71,15 @@
 // Compute bounding box
 #include <CGAL/Bbox_3.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <queue>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 // for default parameters
 #if defined(CGAL_EIGEN3_ENABLED)
@@ -157,6 +165,14 @@ struct Skel_polyhedron_items_3 {
 ///      >
 /// \endcode
 ///
+/// @tparam ConcurrencyTag_
+///         enables sequential versus parallel computation of the Voronoi poles, of the cotangent weights
+///         and of the constraints of the linear system, and of the local tests of the remeshing
+///         and of the degeneracy detection. The edge collapses and the face splits themselves are sequential,
+///         and the result does not depend on the concurrency tag.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.<br>
+///         <b>%Default:</b> `Sequential_tag`
+///
 /// @cond CGAL_DOCUMENT_INTERNAL
 /// @tparam Degeneracy_algorithm_tag
 ///         tag for selecting the degeneracy detection algorithm
@@ -164,9 +180,15 @@ struct Skel_polyhedron_items_3 {
 template <class TriangleMesh,
           class Traits_ = Default,
           class VertexPointMap_ = Default,
-          class SolverTraits_ = Default>
+          class SolverTraits_ = Default,
+          class ConcurrencyTag_ = Sequential_tag>
 class Mean_curvature_flow_skeletonization
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag_, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 // Public types
 public:
 
@@ -251,7 +273,9 @@ public:
   typedef CGAL::Triangulation_vertex_base_with_info_3
                                             <vertex_descriptor, Exact_kernel>  Vb;
   typedef CGAL::Delaunay_triangulation_cell_base_3<Exact_kernel>               Cb;
-  typedef CGAL::Triangulation_data_structure_3<Vb, Cb>                         Tds;
+  typedef std::conditional_t<std::is_convertible<ConcurrencyTag_, Parallel_tag>::value,
+                             Parallel_tag, Sequential_tag>                     Concurrency_tag;
+  typedef CGAL::Triangulation_data_structure_3<Vb, Cb, Concurrency_tag>        Tds;
   typedef CGAL::Delaunay_triangulation_3<Exact_kernel, Tds>                    Delaunay;
   typedef typename Delaunay::Point                                             Exact_point;
   typedef typename Delaunay::Cell_handle                                       Cell_handle;
@@ -314,6 +338,9 @@ private:
   /** The incident angle for a halfedge. */
   std::vector<double> m_halfedge_angle;
 
+  /** The weight of the pole constraint of each vertex, indexed as the rows of the matrix. */
+  std::vector<double> m_pole_weight;
+
   /** The normal of surface points. */
   std::vector<Vector> m_normals;
 
@@ -341,14 +368,38 @@ double diagonal_length(const Bbox_3& bbox)
 }
 
 
-double init_min_edge_length()
+Bbox_3 compute_bbox()
 {
   vertex_iterator vb, ve;
   boost::tie(vb, ve) = vertices(m_tmesh);
   Vertex_to_point v_to_p(m_tmesh_point_pmap);
-  Bbox_3 bbox = CGAL::bbox_3(boost::make_transform_iterator(vb, v_to_p),
-                             boost::make_transform_iterator(ve, v_to_p));
-  return 0.002 * diagonal_length(bbox);
+  return CGAL::bbox_3(boost::make_transform_iterator(vb, v_to_p),
+                      boost::make_transform_iterator(ve, v_to_p));
+}
+
+double init_min_edge_length()
+{
+  return 0.002 * diagonal_length(compute_bbox());
+}
+
+/// Calls `f(i)` for each `i` in `[0, n)`, in parallel if `ConcurrencyTag_` is `Parallel_tag`.
+template <class Function>
+void for_each_index(std::size_t n, const Function& f) const
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag_, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for (std::size_t i = r.begin(); i != r.end(); ++i)
+                          f(i);
+                      });
+    return;
+  }
+#endif
+  for (std::size_t i = 0; i < n; ++i)
+    f(i);
 }
 
 std::size_t collapse_short_edges();
@@ -665,6 +716,8 @@ public:
     {
       nrows = nver * 2;
     }
+    compute_pole_weight();
+
     // Assemble linear system At * A * X = At * B
     typename SolverTraits::Matrix A(nrows, nver);
     assemble_LHS(A);
@@ -925,10 +978,35 @@ private:
   /// Compute cotangent weights of all edges.
   void compute_edge_weight()
   {
-    m_edge_weight.clear();
-    m_edge_weight.reserve(num_halfedges(m_tmesh));
-    for(halfedge_descriptor hd : halfedges(m_tmesh))
-      m_edge_weight.push_back(m_weight_calculator(hd));
+    std::vector<halfedge_descriptor> hds(halfedges(m_tmesh).begin(), halfedges(m_tmesh).end());
+    m_edge_weight.resize(hds.size());
+    for_each_index(hds.size(), [&](std::size_t i)
+    {
+      m_edge_weight[i] = m_weight_calculator(hds[i]);
+    });
+  }
+
+  /// Compute the weight of the pole constraint of all vertices.
+  void compute_pole_weight()
+  {
+    std::vector<vertex_descriptor> vds(vertices(m_tmesh).begin(), vertices(m_tmesh).end());
+    m_pole_weight.assign(vds.size(), 0.);
+    if (!m_is_medially_centered)
+      return;
+
+    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
+
+    // the rows of the matrix follow the traversal order of the vertices
+    for_each_index(vds.size(), [&](std::size_t i)
+    {
+      vertex_descriptor vd = vds[i];
+      if (!vd->is_fixed &&
+          static_cast<int>(get(m_vertex_id_pmap, vd)) < m_max_id &&
+          test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
+      {
+        m_pole_weight[i] = m_omega_P;
+      }
+    });
   }
 
   /// Assemble the left hand side.
@@ -938,8 +1016,6 @@ private:
 
     std::size_t nver = num_vertices(m_tmesh);
 
-    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
-
     for(vertex_descriptor vd : vertices(m_tmesh))
     {
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
@@ -953,15 +1029,9 @@ private:
       else
       {
         A.set_coef(i + nver, i, m_omega_H, true);
-        if (m_is_medially_centered)
+        if (m_pole_weight[i] != 0)
         {
-          if (id < m_max_id)
-          {
-            if (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
-            {
-              A.set_coef(i + nver * 2, i, m_omega_P, true);
-            }
-          }
+          A.set_coef(i + nver * 2, i, m_pole_weight[i], true);
         }
       }
     }
@@ -999,8 +1069,6 @@ private:
   {
     MCFSKEL_DEBUG(std::cerr << "start RHS\n";)
 
-    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
-
     // assemble right columns of linear system
     int nver = static_cast<int>(num_vertices(m_tmesh));
     for (int i = 0; i < nver; ++i)
@@ -1015,25 +1083,8 @@ private:
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
       int i = m_new_id[id];
 
-      double oh, op = 0.0;
-      if (vd->is_fixed)
-      {
-        oh = 1.0 / m_zero_TH;
-      }
-      else
-      {
-        oh = m_omega_H;
-        if (m_is_medially_centered)
-        {
-          if (id < m_max_id)
-          {
-            if (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
-            {
-              op = m_omega_P;
-            }
-          }
-        }
-      }
+      double oh = vd->is_fixed ? 1.0 / m_zero_TH : m_omega_H;
+      double op = m_pole_weight[i];
       Bx[i + nver] = get_x(get(m_tmesh_point_pmap, vd)) * oh;
       By[i + nver] = get_y(get(m_tmesh_point_pmap, vd)) * oh;
       Bz[i + nver] = get_z(get(m_tmesh_point_pmap, vd)) * oh;
@@ -1111,15 +1162,18 @@ private:
     int ne = 2 * static_cast<int>(num_edges(m_tmesh));
     m_halfedge_angle.resize(ne, 0);
 
+    std::vector<halfedge_descriptor> hds;
+    hds.reserve(ne);
     int idx = 0;
     for(halfedge_descriptor hd : halfedges(m_tmesh))
     {
       put(m_hedge_id_pmap, hd, idx++);
+      hds.push_back(hd);
     }
 
-    for(halfedge_descriptor hd : halfedges(m_tmesh))
+    for_each_index(hds.size(), [&](std::size_t e_id)
     {
-      int e_id = static_cast<int>(get(m_hedge_id_pmap, hd));
+      halfedge_descriptor hd = hds[e_id];
 
       if (is_border(hd, m_tmesh))
       {
@@ -1153,7 +1207,7 @@ private:
               acos((dis2_ik + dis2_jk - dis2_ij) / (2.0 * dis_ik * dis_jk));
         }
       }
-    }
+    });
   }
 
   void normalize(Vector& v)
@@ -1261,18 +1315,28 @@ private:
   /// its local neighborhood disk.
   std::size_t detect_degeneracies_in_disk()
   {
-    std::size_t num_fixed = 0;
+    std::vector<vertex_descriptor> vds;
     for(vertex_descriptor v : vertices(m_tmesh))
     {
       if (!v->is_fixed)
+        vds.push_back(v);
+    }
+
+    // the test only depends on the geometry, so vertices can be tested independently
+    std::vector<char> willbefixed(vds.size());
+    for_each_index(vds.size(), [&](std::size_t i)
+    {
+      willbefixed[i] = internal::is_vertex_degenerate(m_tmesh, m_tmesh_point_pmap,
+                                                      vds[i], m_min_edge_length, m_traits);
+    });
+
+    std::size_t num_fixed = 0;
+    for (std::size_t i = 0; i < vds.size(); ++i)
+    {
+      if (willbefixed[i])
       {
-        bool willbefixed = internal::is_vertex_degenerate(m_tmesh, m_tmesh_point_pmap,
-                                                          v, m_min_edge_length, m_traits);
-        if (willbefixed)
-        {
-          v->is_fixed=true;
-          ++num_fixed;
-        }
+        vds[i]->is_fixed=true;
+        ++num_fixed;
       }
     }
 
@@ -1302,23 +1366,15 @@ private:
       points.push_back(std::make_pair(tp, v));
     }
 
-    Delaunay T(points.begin(), points.end());
+    Delaunay T;
+    triangulate(points, T, Concurrency_tag());
 
-    Finite_cells_iterator cit;
     int cell_id = 0;
-    std::vector<Point> cell_dual;
-    cell_dual.reserve(T.number_of_cells());
-    for (cit = T.finite_cells_begin(); cit != T.finite_cells_end(); ++cit)
+    std::vector<Cell_handle> cells;
+    cells.reserve(T.number_of_cells());
+    for (Cell_handle cell : T.finite_cell_handles())
     {
-      Cell_handle cell = cit;
-      Exact_point point = T.dual(cell);
-      cell_dual.push_back(
-        m_traits.construct_point_3_object()(
-          to_double(point.x()),
-          to_double(point.y()),
-          to_double(point.z())
-        )
-      );
+      cells.push_back(cell);
       // each cell has 4 incident vertices
       for (int i = 0; i < 4; ++i)
       {
@@ -1329,10 +1385,22 @@ private:
       ++cell_id;
     }
 
+    std::vector<Point> cell_dual(cells.size());
+    for_each_index(cells.size(), [&](std::size_t i)
+    {
+      Exact_point point = T.dual(cells[i]);
+      cell_dual[i] = m_traits.construct_point_3_object()(
+                       to_double(point.x()),
+                       to_double(point.y()),
+                       to_double(point.z())
+                     );
+    });
+
     typedef std::pair<Exact_point, vertex_descriptor> Pair_type;
-    std::vector<Pair_type> duplicated_points;
-    for(const Pair_type& p : points)
+    std::vector<char> is_duplicated(points.size(), false);
+    for_each_index(points.size(), [&](std::size_t pi)
     {
+      const Pair_type& p = points[pi];
       std::size_t vid = get(m_vertex_id_pmap, p.second);
       Point surface_point = get(m_tmesh_point_pmap, p.second);
 
@@ -1360,11 +1428,14 @@ private:
       if (max_neg_i!=-1)
         p.second->pole = cell_dual[max_neg_i];
       else
-        duplicated_points.push_back(p);
-    }
+        is_duplicated[pi] = true;
+    });
 
-    for (const Pair_type& p : duplicated_points)
+    for (std::size_t pi = 0; pi < points.size(); ++pi)
     {
+      if (!is_duplicated[pi])
+        continue;
+      const Pair_type& p = points[pi];
       typename Delaunay::Locate_type lt;
       int li, lj;
       typename Delaunay::Cell_handle cell = T.locate (p.first, lt, li, lj);
@@ -1375,6 +1446,25 @@ private:
     m_are_poles_computed = true;
   }
 
+  /// Insert the points in the triangulation.
+  template <class Range>
+  void triangulate(const Range& points, Delaunay& T, Sequential_tag)
+  {
+    T.insert(points.begin(), points.end());
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  /// Insert the points in the triangulation in parallel.
+  template <class Range>
+  void triangulate(const Range& points, Delaunay& T, Parallel_tag)
+  {
+    typename Delaunay::Lock_data_structure lock_ds(compute_bbox(), 50);
+    T.set_lock_data_structure(&lock_ds);
+    T.insert(points.begin(), points.end());
+    T.set_lock_data_structure(nullptr);
+  }
+#endif
+
   /// Compute an approximate vertex normal for all vertices.
   void compute_vertex_normal()
   {
@@ -1425,8 +1515,9 @@ private:
 template <class TriangleMesh,
           class Traits_,
           class VertexPointMap_,
-          class SolverTraits_>
-std::size_t Mean_curvature_flow_skeletonization<TriangleMesh, Traits_, VertexPointMap_, SolverTraits_>::collapse_short_edges()
+          class SolverTraits_,
+          class ConcurrencyTag_>
+std::size_t Mean_curvature_flow_skeletonization<TriangleMesh, Traits_, VertexPointMap_, SolverTraits_, ConcurrencyTag_>::collapse_short_edges()
 {
   std::size_t cnt=0, prev_cnt=0;
 
@@ -0,0 +1,122 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Mean_curvature_flow_skeletonization.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                                  Kernel;
+typedef Kernel::Point_3                                                 Point;
+typedef CGAL::Surface_mesh<Point>                                       Triangle_mesh;
+
+typedef CGAL::Mean_curvature_flow_skeletonization<Triangle_mesh>        Sequential_skeletonization;
+typedef CGAL::Mean_curvature_flow_skeletonization<Triangle_mesh,
+                                                  CGAL::Default,
+                                                  CGAL::Default,
+                                                  CGAL::Default,
+                                                  CGAL::Parallel_if_available_tag>
+                                                                        Parallel_skeletonization;
+typedef Sequential_skeletonization::Skeleton                            Skeleton;
+
+typedef boost::graph_traits<Skeleton>::vertex_descriptor                Skeleton_vertex;
+
+// The parallel steps compute exactly the same values as the sequential ones,
+// so the meso-skeletons and the skeletons must be identical.
+template <class Skeletonization>
+bool same_meso_skeletons(const Sequential_skeletonization& expected,
+                         const Skeletonization& mcs)
+{
+  std::vector<Point> expected_points, points, expected_poles, poles;
+  expected.non_fixed_points(expected_points);
+  mcs.non_fixed_points(points);
+  expected.poles(expected_poles);
+  mcs.poles(poles);
+
+  if (expected_points != points)
+  {
+    std::cerr << "The meso-skeletons are different." << std::endl;
+    return false;
+  }
+  if (expected_poles != poles)
+  {
+    std::cerr << "The poles are different." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <class Other_skeleton>
+bool same_skeletons(const Skeleton& expected, const Other_skeleton& skeleton)
+{
+  if (num_vertices(expected) != num_vertices(skeleton) ||
+      num_edges(expected) != num_edges(skeleton))
+  {
+    std::cerr << "The skeletons have different sizes." << std::endl;
+    return false;
+  }
+
+  for (Skeleton_vertex v : CGAL::make_range(vertices(expected)))
+  {
+    if (expected[v].point != skeleton[v].point ||
+        expected[v].vertices != skeleton[v].vertices)
+    {
+      std::cerr << "The skeletons are different." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool test_parallel_skeletonization(const Triangle_mesh& mesh)
+{
+  Sequential_skeletonization expected_mcs(mesh);
+  Parallel_skeletonization mcs(mesh);
+
+  // a few steps of the low level API
+  for (int i = 0; i < 3; ++i)
+  {
+    expected_mcs.contract();
+    mcs.contract();
+    if (!same_meso_skeletons(expected_mcs, mcs))
+      return false;
+  }
+
+  Skeleton expected_skeleton;
+  Parallel_skeletonization::Skeleton skeleton;
+  expected_mcs(expected_skeleton);
+  mcs(skeleton);
+
+  return same_skeletons(expected_skeleton, skeleton);
+}
+
+int main(int argc, char** argv)
+{
+  Triangle_mesh mesh;
+  std::ifstream input((argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off"));
+  if (!input || !(input >> mesh) || mesh.is_empty())
+  {
+    std::cerr << "Cannot open data/elephant.off" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // run the parallel loops on several threads, whatever the number of cores
+  tbb::task_arena arena(4);
+  bool ok = true;
+  arena.execute([&]{ ok = test_parallel_skeletonization(mesh); });
+  if (!ok)
+    return EXIT_FAILURE;
+#else
+  if (!test_parallel_skeletonization(mesh))
+    return EXIT_FAILURE;
+#endif
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+// Times the sweep-based algorithms on synthetic sets of segments, and on a
+// set of segments read from a file.
+//
+// Usage: surface_sweep_2 [number of segments] [segments file]
+//
+// The file contains the number of segments followed by the coordinates of
+// their endpoints, "x1 y1 x2 y2" per segment.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Surface_sweep_2_algorithms.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::Point_2                                   Point_2;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Traits_2;
+typedef Traits_2::Curve_2                                 Segment_2;
+
+void bench(const std::string& name, const std::vector<Segment_2>& segments)
+{
+  std::cout << name << " (" << segments.size() << " segments)" << std::endl;
+  CGAL::Real_timer timer;
+
+  timer.start();
+  std::vector<Traits_2::X_monotone_curve_2> subcurves;
+  CGAL::compute_subcurves(segments.begin(), segments.end(),
+                          std::back_inserter(subcurves));
+  timer.stop();
+  std::cout << "  compute_subcurves:           " << timer.time() << " sec. ("
+            << subcurves.size() << " subcurves)" << std::endl;
+
+  timer.reset();
+  timer.start();
+  std::vector<Point_2> points;
+  CGAL::compute_intersection_points(segments.begin(), segments.end(),
+                                    std::back_inserter(points));
+  timer.stop();
+  std::cout << "  compute_intersection_points: " << timer.time() << " sec. ("
+            << points.size() << " points)" << std::endl;
+
+  timer.reset();
+  timer.start();
+  const bool intersect = CGAL::do_curves_intersect(segments.begin(),
+                                                   segments.end());
+  timer.stop();
+  std::cout << "  do_curves_intersect:         " << timer.time() << " sec. ("
+            << (intersect ? "true" : "false") << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const int n = (argc > 1) ? std::stoi(argv[1]) : 20000;
+  CGAL::Random rnd(0);
+
+  // Short segments, with few intersections.
+  std::vector<Segment_2> short_segments;
+  for (int i = 0; i < n; ++i) {
+    const double x = rnd.get_double(0, 1000), y = rnd.get_double(0, 1000);
+    short_segments.push_back(Segment_2(Point_2(x, y),
+                                       Point_2(x + rnd.get_double(-5, 5),
+                                               y + rnd.get_double(-5, 5))));
+  }
+  bench("Short segments", short_segments);
+
+  // Interior-disjoint segments of a triangulated grid, which only share
+  // their endpoints.
+  std::vector<Segment_2> grid_segments;
+  int m = 1;
+  while (3 * m * m < n) ++m;
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < m; ++j) {
+      const Point_2 p(i, j);
+      grid_segments.push_back(Segment_2(p, Point_2(i + 1, j)));
+      grid_segments.push_back(Segment_2(p, Point_2(i, j + 1)));
+      grid_segments.push_back(Segment_2(p, Point_2(i + 1, j + 1)));
+    }
+  bench("Grid segments", grid_segments);
+
+  // Long segments, with a quadratic number of intersections.
+  std::vector<Segment_2> long_segments;
+  for (int i = 0; i < n / 20; ++i)
+    long_segments.push_back(Segment_2(Point_2(rnd.get_double(0, 1000),
+                                              rnd.get_double(0, 1000)),
+                                      Point_2(rnd.get_double(0, 1000),
+                                              rnd.get_double(0, 1000))));
+  bench("Long segments", long_segments);
+
+  // Overlapping horizontal segments.
+  std::vector<Segment_2> overlapping_segments;
+  for (int i = 0; i < n / 4; ++i) {
+    const int x = rnd.get_int(0, 1000), y = rnd.get_int(0, 100);
+    overlapping_segments.push_back(Segment_2(Point_2(x, y),
+                                             Point_2(x + rnd.get_int(1, 50),
+                                                     y)));
+  }
+  bench("Overlapping segments", overlapping_segments);
+
+  if (argc > 2) {
+    std::ifstream in(argv[2]);
+    if (! in) {
+      std::cerr << "Failed to open " << argv[2] << std::endl;
+      return 1;
+    }
+    std::size_t nb_segments = 0;
+    in >> nb_segments;
+    std::vector<Segment_2> segments;
+    for (std::size_t i = 0; i < nb_segments; ++i) {
+      Point_2 p, q;
+      in >> p >> q;
+      segments.push_back(Segment_2(p, q));
+    }
+    bench(argv[2], segments);
+  }
+
+  return 0;
+}
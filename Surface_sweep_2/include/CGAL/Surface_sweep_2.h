@@ -21,6 +21,7 @@
  * Definition of the Surface_sweep_2 class.
  */
 
+#include <deque>
 #include <list>
 #include <vector>
 
@@ -107,6 +108,7 @@ public:
   typedef Random_access_output_iterator<Intersection_vector>
                                                         vector_inserter;
   typedef typename Base::Subcurve_alloc                 Subcurve_alloc;
+  typedef std::deque<Subcurve, Subcurve_alloc>          Overlap_subcurves;
 protected:
   typedef typename Base::All_sides_oblivious_category
     All_sides_oblivious_category;
@@ -119,9 +121,11 @@ protected:
     Sides_category;
 
   // Data members:
-  Subcurve_container m_overlap_subCurves;
+  Overlap_subcurves m_overlap_subCurves;
                                      // Contains all of the new sub-curves
-                                     // created by an overlap.
+                                     // created by an overlap. They are
+                                     // allocated in blocks and have stable
+                                     // addresses.
 
   Intersection_vector m_x_objects;   // Auxiliary vector for storing the
                                      // intersection objects.
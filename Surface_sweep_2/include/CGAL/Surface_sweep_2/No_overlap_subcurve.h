@@ -70,7 +70,9 @@ private:
 
 public:
   typedef Curve_comparer<Gt2, Event, Subcurve>          Compare_curves;
-  typedef Multiset<Subcurve*, Compare_curves, Allocator>
+  // The nodes of the status line are allocated in blocks by a compact
+  // container, as the sweep inserts and erases a node per curve end.
+  typedef Multiset<Subcurve*, Compare_curves, Allocator, Tag_true>
                                                         Status_line;
   typedef typename Status_line::iterator                Status_line_iterator;
 
@@ -51,14 +51,6 @@ void Surface_sweep_2<Vis>::_complete_sweep()
   Base::_complete_sweep();
 
   // Free all overlapping subcurves we have created.
-  Subcurve_iterator   itr;
-  for (itr = m_overlap_subCurves.begin(); itr != m_overlap_subCurves.end();
-       ++itr)
-  {
-    std::allocator_traits<Subcurve_alloc>::destroy(this->m_subCurveAlloc, *itr);
-    this->m_subCurveAlloc.deallocate(*itr, 1);
-  }
-
   m_overlap_subCurves.clear();
 
   CGAL_SS_PRINT_END_EOL("completing the sweep");
@@ -988,13 +980,12 @@ _create_overlapping_curve(const X_monotone_curve_2& overlap_cv,
       CGAL_SS_PRINT_TEXT("Allocate a new subcurve for the overlap (no common subcurves)");
       CGAL_SS_PRINT_EOL();
       // no duplicate only one curve is needed
-      overlap_sc = this->m_subCurveAlloc.allocate(1);
-      std::allocator_traits<Subcurve_alloc>::construct(this->m_subCurveAlloc,overlap_sc, this->m_masterSubcurve);
+      m_overlap_subCurves.push_back(this->m_masterSubcurve);
+      overlap_sc = &m_overlap_subCurves.back();
       overlap_sc->set_hint(this->m_statusLine.end());
       overlap_sc->init(overlap_cv);
       overlap_sc->set_left_event(left_event);
       overlap_sc->set_right_event(right_event);
-      m_overlap_subCurves.push_back(overlap_sc);
       // sets the two originating subcurves of overlap_sc
       overlap_sc->set_originating_subcurve1(c1);
       overlap_sc->set_originating_subcurve2(c2);
@@ -1009,13 +1000,12 @@ _create_overlapping_curve(const X_monotone_curve_2& overlap_cv,
          sc_it != all_leaves_diff.end();
          ++sc_it)
     {
-      overlap_sc = this->m_subCurveAlloc.allocate(1);
-      std::allocator_traits<Subcurve_alloc>::construct(this->m_subCurveAlloc,overlap_sc, this->m_masterSubcurve);
+      m_overlap_subCurves.push_back(this->m_masterSubcurve);
+      overlap_sc = &m_overlap_subCurves.back();
       overlap_sc->set_hint(this->m_statusLine.end());
       overlap_sc->init(overlap_cv);
       overlap_sc->set_left_event(left_event);
       overlap_sc->set_right_event(right_event);
-      m_overlap_subCurves.push_back(overlap_sc);
       // sets the two originating subcurves of overlap_sc
       overlap_sc->set_originating_subcurve1(first_parent);
       overlap_sc->set_originating_subcurve2(*sc_it);
@@ -0,0 +1,28 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Compact_triangulation_ds_cell_base_3` is a base cell
+for a 3D-triangulation data structure that stores the indices of its
+four vertices and of its four neighbors on 32 bits, instead of handles.
+Its size is thus half the size of `Triangulation_ds_cell_base_3` on 64-bit systems.
+It is a model of the concept `TriangulationDSCellBase_3`.
+
+The indices are offsets in ranges of addresses reserved per type,
+as described in `Compact_triangulation_ds_vertex_base_3`.
+
+\cgalModels{TriangulationDSCellBase_3}
+
+\tparam TDS should not be specified (see Section \ref tds3cyclic and examples)
+
+\sa `CGAL::Triangulation_ds_cell_base_3`
+\sa `CGAL::Compact_triangulation_ds_vertex_base_3`
+
+*/
+template< typename TDS = void >
+class Compact_triangulation_ds_cell_base_3 {
+
+}; /* end Compact_triangulation_ds_cell_base_3 */
+} /* end namespace CGAL */
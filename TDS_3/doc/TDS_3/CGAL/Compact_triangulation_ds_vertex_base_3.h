@@ -0,0 +1,41 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Compact_triangulation_ds_vertex_base_3` is a base vertex
+for a 3D-triangulation data structure that stores the index of its
+incident cell on 32 bits, instead of a handle.
+It is a model of the concept `TriangulationDSVertexBase_3`, and
+it is meant to be used together with `Compact_triangulation_ds_cell_base_3`.
+
+When one of these two base classes is used, `Triangulation_data_structure_3`
+allocates its vertices and its cells in a range of addresses reserved per type, and
+the index of a vertex or a cell is its offset in this range. The handles of the
+triangulation data structure are unchanged, so that the compact base classes can be used
+with any geometric triangulation, and in particular for the meshes of the 3D Mesh Generation package
+through `Mesh_vertex_base_3` and `Mesh_cell_base_3`.
+
+This range is reserved at the first allocation without being backed by memory,
+which requires a 64-bit system, and memory is committed in chunks as the range is used.
+The blocks are allocated without locks, so that the parallel triangulations allocate
+concurrently, and the released blocks are merged and reused.
+The maximal number of objects of a given type, for all triangulations of the program,
+is given by the macro `CGAL_INDEX_ARENA_MAX_SIZE`, which is \f$ 2^{32}-2\f$ by default.
+The reserved range is also limited to an eighth of the address space limit of the process, if any,
+and a smaller range is reserved if the system refuses the larger one.
+
+\cgalModels{TriangulationDSVertexBase_3}
+
+\tparam TDS should not be specified (see Section \ref tds3cyclic and examples)
+
+\sa `CGAL::Triangulation_ds_vertex_base_3`
+\sa `CGAL::Compact_triangulation_ds_cell_base_3`
+
+*/
+template< typename TDS = void >
+class Compact_triangulation_ds_vertex_base_3 {
+
+}; /* end Compact_triangulation_ds_vertex_base_3 */
+} /* end namespace CGAL */
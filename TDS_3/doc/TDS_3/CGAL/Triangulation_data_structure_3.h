@@ -98,6 +98,33 @@ Returns a reference to the container of vertices.
 */
 Vertex_range & vertices();
 
+/*!
+moves the vertices and the cells to contiguous memory. The vertices keep their order,
+and the cells are sorted by their first vertex in this order, so that the memory of
+the cells incident to a vertex is close. This is useful after a parallel construction.
+
+The handles stored in the vertices and the cells are updated. Before the memory of the
+old vertices is released, `update_vertices(forward)` is called, where `forward(v)` returns
+the new handle of the vertex of handle `v`, to update the vertex handles stored elsewhere,
+for example the infinite vertex of a triangulation. The same is done with `update_cells`
+for the cells. All other handles and iterators are invalidated.
+
+See `Compact_container::defragment()`.
+*/
+template <class UpdateVertices, class UpdateCells>
+void defragment(const UpdateVertices& update_vertices, const UpdateCells& update_cells);
+
+/*!
+same as above, without cell handles to update.
+*/
+template <class UpdateVertices>
+void defragment(const UpdateVertices& update_vertices);
+
+/*!
+same as above, without handles to update.
+*/
+void defragment();
+
 /// @}
 
 }; /* end Triangulation_data_structure_3 */
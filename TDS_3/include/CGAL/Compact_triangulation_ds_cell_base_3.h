@@ -0,0 +1,266 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+// cell of a triangulation data structure of any dimension <=3,
+// storing 32-bit indices instead of handles
+
+#ifndef CGAL_COMPACT_TRIANGULATION_DS_CELL_BASE_3_H
+#define CGAL_COMPACT_TRIANGULATION_DS_CELL_BASE_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+
+#include <CGAL/basic.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+#include <CGAL/TDS_3/internal/Dummy_tds_3.h>
+#include <CGAL/STL_Extension/internal/Index_arena.h>
+
+#include <cstdint>
+
+namespace CGAL {
+
+template < typename TDS = void >
+class Compact_triangulation_ds_cell_base_3
+{
+public:
+  typedef TDS                           Triangulation_data_structure;
+  typedef typename TDS::Vertex_handle   Vertex_handle;
+  typedef typename TDS::Cell_handle     Cell_handle;
+  typedef typename TDS::Vertex          Vertex;
+  typedef typename TDS::Cell            Cell;
+  typedef typename TDS::Cell_data       TDS_data;
+
+  // Tells the TDS to allocate the vertices and the cells in index arenas.
+  typedef Tag_true                      Stores_handles_as_indices;
+
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Compact_triangulation_ds_cell_base_3<TDS2> Other; };
+
+private:
+  typedef internal::Index_arena<Cell>    Cell_arena;
+  typedef internal::Index_arena<Vertex>  Vertex_arena;
+  typedef typename Cell_arena::index_type Index;
+
+  static Index index_of(Cell_handle c) { return Cell_arena::index(c.operator->()); }
+  static Index index_of(Vertex_handle v) { return Vertex_arena::index(v.operator->()); }
+
+  static Cell_handle cell_handle(Index i) { return Cell_handle(Cell_arena::pointer(i)); }
+  static Vertex_handle vertex_handle(Index i) { return Vertex_handle(Vertex_arena::pointer(i)); }
+
+public:
+  Compact_triangulation_ds_cell_base_3()
+  {
+    set_vertices();
+    set_neighbors();
+  }
+
+  Compact_triangulation_ds_cell_base_3(Vertex_handle v0, Vertex_handle v1,
+                                       Vertex_handle v2, Vertex_handle v3)
+  {
+    set_vertices(v0, v1, v2, v3);
+    set_neighbors();
+  }
+
+  Compact_triangulation_ds_cell_base_3(Vertex_handle v0, Vertex_handle v1,
+                                       Vertex_handle v2, Vertex_handle v3,
+                                       Cell_handle   n0, Cell_handle   n1,
+                                       Cell_handle   n2, Cell_handle   n3)
+  {
+    set_vertices(v0, v1, v2, v3);
+    N[0] = index_of(n0);
+    N[1] = index_of(n1);
+    N[2] = index_of(n2);
+    N[3] = index_of(n3);
+  }
+
+  // ACCESS FUNCTIONS
+
+  Vertex_handle vertex(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3 );
+    CGAL_assume( i >= 0 && i <= 3 );
+    return vertex_handle(V[i]);
+  }
+
+  bool has_vertex(Vertex_handle v) const
+  {
+    const Index iv = index_of(v);
+    return (V[0] == iv) || (V[1] == iv) || (V[2] == iv) || (V[3] == iv);
+  }
+
+  bool has_vertex(Vertex_handle v, int & i) const
+  {
+    const Index iv = index_of(v);
+    if (iv == V[0]) { i = 0; return true; }
+    if (iv == V[1]) { i = 1; return true; }
+    if (iv == V[2]) { i = 2; return true; }
+    if (iv == V[3]) { i = 3; return true; }
+    return false;
+  }
+
+  int index(Vertex_handle v) const
+  {
+    const Index iv = index_of(v);
+    if (iv == V[0]) { return 0; }
+    if (iv == V[1]) { return 1; }
+    if (iv == V[2]) { return 2; }
+    CGAL_assertion( iv == V[3] );
+    return 3;
+  }
+
+  Cell_handle neighbor(int i) const
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    return cell_handle(N[i]);
+  }
+
+  bool has_neighbor(Cell_handle n) const
+  {
+    const Index in = index_of(n);
+    return (N[0] == in) || (N[1] == in) || (N[2] == in) || (N[3] == in);
+  }
+
+  bool has_neighbor(Cell_handle n, int & i) const
+  {
+    const Index in = index_of(n);
+    if(in == N[0]){ i = 0; return true; }
+    if(in == N[1]){ i = 1; return true; }
+    if(in == N[2]){ i = 2; return true; }
+    if(in == N[3]){ i = 3; return true; }
+    return false;
+  }
+
+  int index(Cell_handle n) const
+  {
+    const Index in = index_of(n);
+    if (in == N[0]) return 0;
+    if (in == N[1]) return 1;
+    if (in == N[2]) return 2;
+    CGAL_assertion( in == N[3] );
+    return 3;
+  }
+
+  // SETTING
+
+  void set_vertex(int i, Vertex_handle v)
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    V[i] = index_of(v);
+  }
+
+  void set_neighbor(int i, Cell_handle n)
+  {
+    CGAL_precondition( i >= 0 && i <= 3);
+    CGAL_precondition( this != n.operator->() );
+    N[i] = index_of(n);
+  }
+
+  void set_vertices()
+  {
+    V[0] = V[1] = V[2] = V[3] = Vertex_arena::null_index;
+  }
+
+  void set_vertices(Vertex_handle v0, Vertex_handle v1,
+                    Vertex_handle v2, Vertex_handle v3)
+  {
+    V[0] = index_of(v0);
+    V[1] = index_of(v1);
+    V[2] = index_of(v2);
+    V[3] = index_of(v3);
+  }
+
+  void set_neighbors()
+  {
+    N[0] = N[1] = N[2] = N[3] = Cell_arena::null_index;
+  }
+
+  void set_neighbors(Cell_handle n0, Cell_handle n1,
+                     Cell_handle n2, Cell_handle n3)
+  {
+    CGAL_precondition( this != n0.operator->() );
+    CGAL_precondition( this != n1.operator->() );
+    CGAL_precondition( this != n2.operator->() );
+    CGAL_precondition( this != n3.operator->() );
+    N[0] = index_of(n0);
+    N[1] = index_of(n1);
+    N[2] = index_of(n2);
+    N[3] = index_of(n3);
+  }
+
+  // CHECKING
+
+  // the following trivial is_valid allows
+  // the user of derived cell base classes
+  // to add their own purpose checking
+  bool is_valid(bool = false, int = 0) const
+  { return true; }
+
+  // For use by Compact_container.
+  // The pointer is stored as an index in N[0], and its two type bits apart.
+  void * for_compact_container() const
+  {
+    return reinterpret_cast<void*>(
+      reinterpret_cast<std::uintptr_t>(Cell_arena::pointer(N[0])) | _cc_type);
+  }
+  void for_compact_container(void* p)
+  {
+    const std::uintptr_t u = reinterpret_cast<std::uintptr_t>(p);
+    _cc_type = static_cast<unsigned char>(u & 3);
+    N[0] = Cell_arena::index(reinterpret_cast<Cell*>(u & ~std::uintptr_t(3)));
+  }
+
+  // TDS internal data access functions.
+        TDS_data& tds_data()       { return _tds_data; }
+  const TDS_data& tds_data() const { return _tds_data; }
+
+private:
+
+  Index         N[4];
+  Index         V[4];
+  TDS_data      _tds_data;
+  unsigned char _cc_type = 0;
+};
+
+template < class TDS >
+inline
+std::istream&
+operator>>(std::istream &is, Compact_triangulation_ds_cell_base_3<TDS> &)
+  // non combinatorial information. Default = nothing
+{
+  return is;
+}
+
+template < class TDS >
+inline
+std::ostream&
+operator<<(std::ostream &os, const Compact_triangulation_ds_cell_base_3<TDS> &)
+  // non combinatorial information. Default = nothing
+{
+  return os;
+}
+
+// Specialization for void.
+template <>
+class Compact_triangulation_ds_cell_base_3<void>
+{
+public:
+  typedef internal::Dummy_tds_3                         Triangulation_data_structure;
+  typedef Triangulation_data_structure::Vertex_handle   Vertex_handle;
+  typedef Triangulation_data_structure::Cell_handle     Cell_handle;
+  typedef Tag_true                                      Stores_handles_as_indices;
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Compact_triangulation_ds_cell_base_3<TDS2> Other; };
+};
+
+} //namespace CGAL
+
+#endif // CGAL_COMPACT_TRIANGULATION_DS_CELL_BASE_3_H
@@ -0,0 +1,137 @@
+// Copyright (c) 2025 GeometryFactory Sarl (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent
+
+// vertex of a triangulation data structure of any dimension <=3,
+// storing a 32-bit index instead of a cell handle
+
+#ifndef CGAL_COMPACT_TRIANGULATION_DS_VERTEX_BASE_3_H
+#define CGAL_COMPACT_TRIANGULATION_DS_VERTEX_BASE_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+
+#include <CGAL/basic.h>
+#include <CGAL/tags.h>
+#include <CGAL/TDS_3/internal/Dummy_tds_3.h>
+#include <CGAL/STL_Extension/internal/Index_arena.h>
+
+#include <cstdint>
+
+namespace CGAL {
+
+template < typename TDS = void >
+class Compact_triangulation_ds_vertex_base_3
+{
+public:
+  typedef TDS                          Triangulation_data_structure;
+  typedef typename TDS::Vertex_handle  Vertex_handle;
+  typedef typename TDS::Cell_handle    Cell_handle;
+  typedef typename TDS::Vertex         Vertex;
+  typedef typename TDS::Cell           Cell;
+
+  // Tells the TDS to allocate the vertices and the cells in index arenas.
+  typedef Tag_true                     Stores_handles_as_indices;
+
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Compact_triangulation_ds_vertex_base_3<TDS2> Other; };
+
+private:
+  typedef internal::Index_arena<Cell>    Cell_arena;
+  typedef internal::Index_arena<Vertex>  Vertex_arena;
+  typedef typename Cell_arena::index_type Index;
+
+public:
+  Compact_triangulation_ds_vertex_base_3()
+    : _c(Cell_arena::null_index), visited_for_vertex_extractor(false)
+  {}
+
+  Compact_triangulation_ds_vertex_base_3(Cell_handle c)
+    : _c(Cell_arena::index(c.operator->())), visited_for_vertex_extractor(false)
+  {}
+
+  Cell_handle cell() const
+  { return Cell_handle(Cell_arena::pointer(_c)); }
+
+  void set_cell(Cell_handle c)
+  {
+    _c = Cell_arena::index(c.operator->());
+  }
+
+  // the following trivial is_valid allows
+  // the user of derived cell base classes
+  // to add their own purpose checking
+  bool is_valid(bool = false, int = 0) const
+  {
+    return _c != Cell_arena::null_index;
+  }
+
+  // For use by the Compact_container.
+  // A free vertex stores the index of a vertex in `_c`, and the type bits apart.
+  void *   for_compact_container() const
+  {
+    if(_cc_type == 0)
+      return nullptr;
+    return reinterpret_cast<void*>(
+      reinterpret_cast<std::uintptr_t>(Vertex_arena::pointer(_c)) | _cc_type);
+  }
+  void for_compact_container(void* p)
+  {
+    const std::uintptr_t u = reinterpret_cast<std::uintptr_t>(p);
+    _cc_type = static_cast<unsigned char>(u & 3);
+    _c = Vertex_arena::index(reinterpret_cast<Vertex*>(u & ~std::uintptr_t(3)));
+  }
+
+private:
+  Index _c;
+  unsigned char _cc_type = 0;
+
+  // The typedef and the bool are used by Triangulation_data_structure::Vertex_extractor
+  // The names are chooses complicated so that we do not have to document them
+  // (privacy by obfuscation)
+  public:
+  typedef bool Has_visited_for_vertex_extractor;
+  bool visited_for_vertex_extractor;
+};
+
+template < class TDS >
+inline
+std::istream&
+operator>>(std::istream &is, Compact_triangulation_ds_vertex_base_3<TDS> &)
+  // no combinatorial information.
+{
+  return is;
+}
+
+template < class TDS >
+inline
+std::ostream&
+operator<<(std::ostream &os, const Compact_triangulation_ds_vertex_base_3<TDS> &)
+  // no combinatorial information.
+{
+  return os;
+}
+
+// Specialization for void.
+template <>
+class Compact_triangulation_ds_vertex_base_3<void>
+{
+public:
+  typedef internal::Dummy_tds_3                         Triangulation_data_structure;
+  typedef Triangulation_data_structure::Vertex_handle   Vertex_handle;
+  typedef Triangulation_data_structure::Cell_handle     Cell_handle;
+  typedef Tag_true                                      Stores_handles_as_indices;
+  template <typename TDS2>
+  struct Rebind_TDS { typedef Compact_triangulation_ds_vertex_base_3<TDS2> Other; };
+};
+
+} //namespace CGAL
+
+#endif // CGAL_COMPACT_TRIANGULATION_DS_VERTEX_BASE_3_H
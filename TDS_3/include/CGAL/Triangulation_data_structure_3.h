@@ -33,6 +33,7 @@
 #include <boost/unordered_set.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/container/small_vector.hpp>
+#include <boost/mpl/has_xxx.hpp>
 #include <boost/iterator/function_output_iterator.hpp>
 #include <CGAL/utility.h>
 #include <CGAL/iterator.h>
@@ -52,6 +53,7 @@
 
 #include <CGAL/TDS_3/internal/Triangulation_ds_iterators_3.h>
 #include <CGAL/TDS_3/internal/Triangulation_ds_circulators_3.h>
+#include <CGAL/STL_Extension/internal/Index_arena.h>
 #include <CGAL/tss.h>
 
 #ifdef CGAL_LINKED_WITH_TBB
@@ -62,6 +64,14 @@
 
 namespace CGAL {
 
+namespace internal {
+
+  BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_handles_as_indices,
+                                    Stores_handles_as_indices,
+                                    false)
+
+} // namespace internal
+
 // TODO : noms : Vb != Vertex_base : clarifier.
 
 template < class Vb = Triangulation_ds_vertex_base_3<>,
@@ -114,6 +124,17 @@ public:
 
 private:
 
+  // The compact vertex and cell bases store 32-bit indices instead of handles,
+  // which requires that the vertices and the cells are allocated in index arenas.
+  static constexpr bool stores_handles_as_indices =
+    internal::Has_handles_as_indices<Vb>::value ||
+    internal::Has_handles_as_indices<Cb>::value;
+
+  template < class T, class Allocator >
+  using Element_allocator = std::conditional_t<stores_handles_as_indices,
+                                               internal::Index_arena_allocator<T>,
+                                               Allocator>;
+
   friend class internal::Triangulation_ds_facet_iterator_3<Tds>;
   friend class internal::Triangulation_ds_edge_iterator_3<Tds>;
 
@@ -128,8 +149,8 @@ public:
   typedef typename std::conditional
   <
     std::is_convertible<Concurrency_tag, Parallel_tag>::value,
-    Concurrent_compact_container<Cell, tbb::scalable_allocator<Cell> >,
-    Compact_container<Cell>
+    Concurrent_compact_container<Cell, Element_allocator<Cell, tbb::scalable_allocator<Cell> > >,
+    Compact_container<Cell, Element_allocator<Cell, Default> >
   >::type                                                Cell_range;
 
 # else
@@ -137,7 +158,7 @@ public:
     (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
      "In CGAL triangulations, `Parallel_tag` can only be used with the Intel TBB library. "
      "Make TBB available in the build system and then define the macro `CGAL_LINKED_WITH_TBB`.");
-  typedef Compact_container<Cell>                        Cell_range;
+  typedef Compact_container<Cell, Element_allocator<Cell, Default> > Cell_range;
 #endif
 
   // Vertices
@@ -146,12 +167,12 @@ public:
   typedef typename std::conditional
   <
     std::is_convertible<Concurrency_tag, Parallel_tag>::value,
-    Concurrent_compact_container<Vertex, tbb::scalable_allocator<Vertex> >,
-    Compact_container<Vertex>
+    Concurrent_compact_container<Vertex, Element_allocator<Vertex, tbb::scalable_allocator<Vertex> > >,
+    Compact_container<Vertex, Element_allocator<Vertex, Default> >
   >::type                                                Vertex_range;
 
 # else
-  typedef Compact_container<Vertex>                      Vertex_range;
+  typedef Compact_container<Vertex, Element_allocator<Vertex, Default> > Vertex_range;
 #endif
 
 
@@ -1549,6 +1570,32 @@ public:
 
   void clear();
 
+  // Moves the vertices and the cells to contiguous memory. The vertices keep
+  // their order, and the cells are grouped by their first vertex in this order,
+  // so that a traversal of the vertices and their incident cells, such as the
+  // location of points in a triangulation, accesses the memory in sequence.
+  // This is useful after a parallel construction, which interleaves the
+  // elements created by the different threads.
+  // The handles stored in the vertices and the cells are updated; the handles
+  // stored elsewhere can be updated by `update_vertices(forward)` and
+  // `update_cells(forward)`, where `forward(h)` returns the new handle of the
+  // element of handle `h` (see `Compact_container::defragment()`).
+  // All other handles and iterators are invalidated.
+  // Do not call this function while others are modifying the TDS.
+  template <class UpdateVertices, class UpdateCells>
+  void defragment(const UpdateVertices& update_vertices, const UpdateCells& update_cells);
+
+  template <class UpdateVertices>
+  void defragment(const UpdateVertices& update_vertices)
+  {
+    defragment(update_vertices, [](const auto&) {});
+  }
+
+  void defragment()
+  {
+    defragment([](const auto&) {}, [](const auto&) {});
+  }
+
   void set_adjacency(Cell_handle c0, int i0,
                      Cell_handle c1, int i1) const
   {
@@ -4208,6 +4255,59 @@ clear()
   set_dimension(-2);
 }
 
+template <class Vb, class Cb, class Ct>
+template <class UpdateVertices, class UpdateCells>
+void
+Triangulation_data_structure_3<Vb,Cb,Ct>::
+defragment(const UpdateVertices& update_vertices, const UpdateCells& update_cells)
+{
+  // in dimension -1, the only cell stores the only vertex
+  const int dim = (std::max)(dimension(), 0);
+
+  vertices().defragment([&](const auto& forward)
+  {
+    for(Cell& c : cells())
+      for(int i = 0; i <= dim; ++i)
+        c.set_vertex(i, forward(c.vertex(i)));
+    update_vertices(forward);
+  });
+
+  // The vertices are now in a single block: the cells are sorted by the
+  // position of their first vertex in this block, with a counting sort.
+  const size_type nv = number_of_vertices();
+  std::vector<Cell_handle> order;
+  if(nv != 0)
+  {
+    const Vertex* first_vertex = &*vertices().begin();
+    auto first_index = [&](Cell_handle c)
+    {
+      size_type k = nv;
+      for(int i = 0; i <= dim; ++i)
+        k = (std::min)(k, size_type(&*c->vertex(i) - first_vertex));
+      return k;
+    };
+
+    std::vector<size_type> start(nv + 1, 0);
+    for(Cell_iterator c = cells().begin(); c != cells().end(); ++c)
+      ++start[first_index(c) + 1];
+    for(size_type k = 0; k < nv; ++k)
+      start[k + 1] += start[k];
+    order.resize(cells().size());
+    for(Cell_iterator c = cells().begin(); c != cells().end(); ++c)
+      order[start[first_index(c)]++] = c;
+  }
+
+  cells().defragment(order.begin(), order.end(), [&](const auto& forward)
+  {
+    for(Vertex& v : vertices())
+      v.set_cell(forward(v.cell()));
+    for(Cell& c : cells())
+      for(int i = 0; i <= dim; ++i)
+        c.set_neighbor(i, forward(c.neighbor(i)));
+    update_cells(forward);
+  });
+}
+
 template <class Vb, class Cb, class Ct>
 bool
 Triangulation_data_structure_3<Vb,Cb,Ct>::
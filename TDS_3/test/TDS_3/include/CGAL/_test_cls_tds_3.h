@@ -288,6 +288,52 @@ _test_cls_tds_3( const Tds &)
   std::cout << nbflips << " flips 3-2" << std::endl;
   assert(tds6.number_of_vertices()==8);
 
+  std::cout << "    test defragment" << std::endl;
+  for(const Tds* t : { &tds1, &tds2, &tds3, &tds4, &tds5, &tds6 })
+  {
+    Tds tds(*t);
+    const std::size_t nv = tds.vertices().size();
+    const std::size_t nc = tds.cells().size();
+    Vertex_handle v = (nv == 0) ? Vertex_handle() : Vertex_handle(tds.vertices_begin());
+    Cell_handle c = (nc == 0) ? Cell_handle() : Cell_handle(--tds.cells_end());
+    const std::size_t degree = (tds.dimension() == 3) ? tds.degree(v) : 0;
+
+    tds.defragment([&](const auto& forward) { v = forward(v); },
+                   [&](const auto& forward) { c = forward(c); });
+    assert(tds.is_valid());
+    assert(tds.vertices().size() == nv);
+    assert(tds.cells().size() == nc);
+    if(nv == 0)
+      continue;
+
+    // the vertices keep their order, the cells are sorted by their first vertex
+    assert(v == tds.vertices_begin());
+    assert(tds.cells().owns_dereferenceable(c));
+    if(tds.dimension() == 3)
+      assert(tds.degree(v) == degree);
+    std::size_t k = 0;
+    for(Vertex_iterator it = tds.vertices_begin(); it != tds.vertices_end(); ++it, ++k)
+      assert(&*it == &*tds.vertices_begin() + k);
+    k = 0;
+    std::ptrdiff_t previous = 0;
+    for(Cell_iterator it = tds.cells_begin(); it != tds.cells_end(); ++it, ++k)
+    {
+      assert(&*it == &*tds.cells_begin() + k);
+      std::ptrdiff_t first = std::ptrdiff_t(nv);
+      for(int j = 0; j <= (std::max)(tds.dimension(), 0); ++j)
+        first = (std::min)(first, &*it->vertex(j) - &*tds.vertices_begin());
+      assert(previous <= first);
+      previous = first;
+    }
+
+    // the TDS can still be modified
+    if(tds.dimension() == 3)
+    {
+      tds.insert_in_cell(tds.cells_begin());
+      assert(tds.is_valid());
+    }
+  }
+
   // test destructor and return
   std::cout << "    test destructors and return" << std::endl;
 
@@ -0,0 +1,86 @@
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Compact_triangulation_ds_cell_base_3.h>
+#include <CGAL/Compact_triangulation_ds_vertex_base_3.h>
+
+#include <CGAL/_test_cls_tds_3.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/parallel_for.h>
+#  include <tbb/task_arena.h>
+#endif
+
+#include <cassert>
+#include <vector>
+
+typedef CGAL::Compact_triangulation_ds_vertex_base_3<>      Vb;
+typedef CGAL::Compact_triangulation_ds_cell_base_3<>        Cb;
+
+typedef CGAL::Triangulation_data_structure_3<Vb, Cb>        Tds;
+typedef CGAL::Triangulation_data_structure_3<
+          CGAL::Triangulation_ds_vertex_base_3<>, Cb>       Tds_with_compact_cells;
+
+// Explicit instantiation :
+template class CGAL::Triangulation_data_structure_3<Vb, Cb>;
+
+struct Item { double d[3]; };
+typedef CGAL::internal::Index_arena<Item>                   Arena;
+
+void test_index_arena()
+{
+  Arena& arena = Arena::instance();
+  Item* a = arena.allocate(10);
+  Item* b = arena.allocate(20);
+  Item* c = arena.allocate(5);
+  assert(b == a + 10 && c == b + 20);
+  assert(Arena::pointer(Arena::index(c)) == c);
+  assert(Arena::index(nullptr) == Arena::null_index);
+  c[4].d[2] = 1.;
+
+  // the released blocks are merged, and reused by a smaller block
+  arena.deallocate(a, 10);
+  arena.deallocate(b, 20);
+  Item* d = arena.allocate(25);
+  assert(d == a);
+  Item* e = arena.allocate(5);
+  assert(e == a + 25);
+
+  // the released blocks at the top are given back to the top
+  arena.deallocate(c, 5);
+  arena.deallocate(d, 25);
+  arena.deallocate(e, 5);
+  assert(arena.allocate(100) == a);
+  arena.deallocate(a, 100);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // concurrent allocations do not overlap
+  const int n = 1000;
+  std::vector<Item*> blocks(n);
+  tbb::task_arena(4).execute([&]{
+    tbb::parallel_for(0, n, [&](int i) {
+      blocks[i] = arena.allocate(1 + i % 7);
+      for(int j = 0; j < 1 + i % 7; ++j)
+        blocks[i][j].d[0] = i;
+    });
+  });
+  for(int i = 0; i < n; ++i)
+    for(int j = 0; j < 1 + i % 7; ++j)
+      assert(blocks[i][j].d[0] == i);
+  for(int i = 0; i < n; ++i)
+    arena.deallocate(blocks[i], 1 + i % 7);
+  assert(arena.allocate(1) == a);
+  arena.deallocate(a, 1);
+#endif
+}
+
+int main()
+{
+  test_index_arena();
+
+  // the cells store 32-bit indices instead of pointers
+  static_assert(2 * sizeof(Tds::Cell) <=
+                sizeof(CGAL::Triangulation_data_structure_3<>::Cell));
+
+  _test_cls_tds_3(Tds());
+  _test_cls_tds_3(Tds_with_compact_cells());
+  return 0;
+}
@@ -26,6 +26,7 @@
 
 #include <CGAL/iterator.h>
 #include <CGAL/Location_policy.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/tools.h>
 
 #ifdef CGAL_CONCURRENT_TRIANGULATION_3_PROFILING
 # define CGAL_PROFILE
@@ -58,6 +59,7 @@
 #include <CGAL/point_generators_3.h>
 #endif
 
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -734,6 +736,55 @@ private:
   side_of_sphere(Vertex_handle v0, Vertex_handle v1,
                  Vertex_handle v2, Vertex_handle v3,
                  const Point& p, bool perturb) const;
+#ifdef CGAL_BATCHED_STATIC_FILTERS
+  // Conflict tests are evaluated by groups of cells when the kernel
+  // provides a semi-static filter of several predicates at once.
+  static constexpr bool batched_conflict_tests =
+    std::is_same<typename Geom_traits::FT, double>::value &&
+    internal::Has_filter_batch<typename Geom_traits::Side_of_oriented_sphere_3>::value;
+
+  // Sets `in_conflict[l]` to `side_of_sphere(cells[l], p, true) == ON_BOUNDED_SIDE`
+  // for the `n <= 4` cells of `cells`.
+  void in_conflict_with_spheres(const Cell_handle* cells, int n, const Point& p,
+                                bool* in_conflict) const
+  {
+    CGAL_precondition(dimension() == 3 && n <= 4);
+
+    // unused lanes and infinite cells are filled with null coordinates
+    double x[5][4] = {}, y[5][4] = {}, z[5][4] = {};
+    bool finite[4] = { false, false, false, false };
+    for(int l=0; l<n; ++l)
+    {
+      finite[l] = !is_infinite(cells[l]);
+      if(finite[l])
+      {
+        for(int j=0; j<4; ++j)
+        {
+          const Point& q = cells[l]->vertex(j)->point();
+          x[j][l] = q.x();
+          y[j][l] = q.y();
+          z[j][l] = q.z();
+        }
+      }
+      x[4][l] = p.x();
+      y[4][l] = p.y();
+      z[4][l] = p.z();
+    }
+
+    int res[4];
+    Geom_traits::Side_of_oriented_sphere_3::filter_batch(x, y, z, res);
+
+    for(int l=0; l<n; ++l)
+    {
+      // null determinants need the symbolic perturbation
+      if(finite[l] && (res[l] == ON_POSITIVE_SIDE || res[l] == ON_NEGATIVE_SIDE))
+        in_conflict[l] = (res[l] == ON_POSITIVE_SIDE);
+      else
+        in_conflict[l] = (side_of_sphere(cells[l], p, true) == ON_BOUNDED_SIDE);
+    }
+  }
+#endif
+
 public:
   // Queries
   Bounded_side side_of_sphere(Cell_handle c, const Point& p, bool perturb = false) const
@@ -815,6 +866,15 @@ protected:
       return t->side_of_sphere(c, p, true) == ON_BOUNDED_SIDE;
     }
 
+#ifdef CGAL_BATCHED_STATIC_FILTERS
+    // Tests `n <= 4` cells at once
+    template <bool b = batched_conflict_tests, std::enable_if_t<b, int> = 0>
+    void operator()(const Cell_handle* cells, int n, bool* in_conflict) const
+    {
+      t->in_conflict_with_spheres(cells, n, p, in_conflict);
+    }
+#endif
+
     Oriented_side compare_weight(const Point& , const Point& ) const
     {
       return ZERO;
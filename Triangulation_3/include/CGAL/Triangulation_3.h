@@ -76,6 +76,7 @@
 #include <utility>
 #include <stack>
 #include <array>
+#include <type_traits>
 
 #define CGAL_TRIANGULATION_3_USE_THE_4_POINTS_CONSTRUCTOR
 
@@ -113,6 +114,21 @@ struct Structural_filtering_selector_3<true>
 } // namespace internal
 #endif // no CGAL_NO_STRUCTURAL_FILTERING
 
+namespace internal {
+
+// Whether the conflict tester `Test` can test several cells at once,
+// with `test(cells, n, in_conflict)` (see `Triangulation_3::find_conflicts()`).
+template <typename Test, typename Cell_handle, typename = void>
+struct Has_batched_conflict_test : std::false_type {};
+
+template <typename Test, typename Cell_handle>
+struct Has_batched_conflict_test<Test, Cell_handle,
+  std::void_t<decltype(std::declval<const Test&>()(std::declval<const Cell_handle*>(), 0,
+                                                   std::declval<bool*>()))> >
+  : std::true_type {};
+
+} // namespace internal
+
 /************************************************
 // Class Triangulation_3_base
 // Two versions: Sequential (no locking) / Parallel (with locking)
@@ -1363,6 +1379,20 @@ protected:
       Cell_handle c = cell_stack.top();
       cell_stack.pop();
 
+      // If the tester can test several cells at once, the neighbors
+      // that have not been tested yet are tested together.
+      Cell_handle candidates[4];
+      bool candidate_in_conflict[4];
+      int nb_candidates = 0, next_candidate = 0;
+      if constexpr(internal::Has_batched_conflict_test<Conflict_test, Cell_handle>::value)
+      {
+        for(int i=0; i<dimension()+1; ++i)
+          if(c->neighbor(i)->tds_data().is_clear())
+            candidates[nb_candidates++] = c->neighbor(i);
+        if(nb_candidates > 0)
+          tester(candidates, nb_candidates, candidate_in_conflict);
+      }
+
       // For each neighbor cell
       for(int i=0; i<dimension()+1; ++i)
       {
@@ -1388,7 +1418,13 @@ protected:
         }
         if(test->tds_data().is_clear())
         {
-          if(tester(test))
+          bool in_conflict;
+          if(next_candidate < nb_candidates && candidates[next_candidate] == test)
+            in_conflict = candidate_in_conflict[next_candidate++];
+          else
+            in_conflict = tester(test);
+
+          if(in_conflict)
           {
             // "test" is in the conflict zone
             if(could_lock_zone)
@@ -93,6 +93,19 @@ _test_cls_parallel_triangulation_3(const Parallel_triangulation &)
   std::cout << "Now, " << tr.number_of_vertices() << " vertices are left" << std::endl;
   assert(tr.is_valid());
 
+  // The elements inserted by the different threads are interleaved in memory,
+  // the defragmentation sorts them.
+  std::cout << "Defragmentation" << std::endl;
+  const std::size_t num_vertices = tr.number_of_vertices();
+  const std::size_t num_cells = tr.number_of_cells();
+  tr.tds().defragment([&](const auto& forward)
+                      { tr.set_infinite_vertex(forward(tr.infinite_vertex())); });
+  assert(tr.is_valid());
+  assert(tr.number_of_vertices() == num_vertices);
+  assert(tr.number_of_cells() == num_cells);
+  tr.insert(points.begin(), points.end());
+  assert(tr.is_valid());
+
   tr.clear();
   assert(tr.is_valid());
   assert(tr.dimension()==-1);
@@ -19,6 +19,8 @@
 #include <CGAL/Triangulation_vertex_base_3.h>
 #include <CGAL/Delaunay_triangulation_cell_base_3.h>
 #include <CGAL/Delaunay_triangulation_cell_base_with_circumcenter_3.h>
+#include <CGAL/Compact_triangulation_ds_cell_base_3.h>
+#include <CGAL/Compact_triangulation_ds_vertex_base_3.h>
 
 bool del=true;
 
@@ -45,6 +47,19 @@ int main()
 
   _test_cls_delaunay_3( Cls_with_Delaunay_Cb() );
 
+  // Vertices and cells storing 32-bit indices instead of handles.
+  typedef CGAL::Triangulation_vertex_base_3<
+    EPIC, CGAL::Compact_triangulation_ds_vertex_base_3<> >  Compact_Vb;
+  typedef CGAL::Delaunay_triangulation_cell_base_3<
+    EPIC, CGAL::Triangulation_cell_base_3<
+            EPIC, CGAL::Compact_triangulation_ds_cell_base_3<> > > Compact_Cb;
+  typedef CGAL::Triangulation_data_structure_3<
+    Compact_Vb, Compact_Cb>                         Tds_compact;
+  typedef CGAL::Delaunay_triangulation_3<
+    EPIC, Tds_compact>                              Cls_compact;
+
+  _test_cls_delaunay_3( Cls_compact() );
+
 #ifdef CGAL_LINKED_WITH_TBB
   typedef CGAL::Spatial_lock_grid_3<
     CGAL::Tag_priority_blocking>                      Lock_ds;
@@ -59,6 +74,12 @@ int main()
   _test_cls_delaunay_3( Cls_parallel() );
   // This test performs parallel operations
   _test_cls_parallel_triangulation_3( Cls_parallel() );
+
+  typedef CGAL::Triangulation_data_structure_3<
+    Compact_Vb, Compact_Cb, CGAL::Parallel_tag >    Tds_compact_parallel;
+  typedef CGAL::Delaunay_triangulation_3<
+    EPIC, Tds_compact_parallel, CGAL::Default, Lock_ds> Cls_compact_parallel;
+  _test_cls_parallel_triangulation_3( Cls_compact_parallel() );
 #endif
 
   // Second version for the circumcenter storing cell base class.